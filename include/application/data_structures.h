@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -20,6 +21,8 @@ enum class Position : uint8_t {
     REAR_RIGHT  = 3
 };
 
+constexpr size_t POSITION_COUNT = 4;
+
 // 通用结果枚举
 enum class Result : uint8_t {
     FAIL    = 0,
@@ -79,6 +82,8 @@ enum class LightType : uint8_t {
     POSITION_LIGHT = 2
 };
 
+constexpr size_t LIGHT_TYPE_COUNT = 3;
+
 // 座椅调节轴
 enum class SeatAxis : uint8_t {
     FORWARD_BACKWARD = 0,
@@ -270,6 +275,23 @@ struct SetPositionLightStateResp {
     SetPositionLightStateResp(PositionLightState state, Result res) : newState(state), result(res) {}
 };
 
+// 获取灯光状态请求
+struct GetLightStateReq {
+    LightType lightType;    // 灯光类型
+    
+    GetLightStateReq() : lightType(LightType::HEADLIGHT) {}
+    GetLightStateReq(LightType type) : lightType(type) {}
+};
+
+// 获取灯光状态响应
+struct GetLightStateResp {
+    LightType lightType;    // 灯光类型
+    uint8_t state;          // 当前状态值
+    
+    GetLightStateResp() : lightType(LightType::HEADLIGHT), state(0) {}
+    GetLightStateResp(LightType type, uint8_t value) : lightType(type), state(value) {}
+};
+
 // 灯光状态变化事件数据
 struct OnLightStateChangedData {
     LightType lightType;    // 灯光类型
@@ -287,9 +309,11 @@ struct OnLightStateChangedData {
 struct AdjustSeatReq {
     SeatAxis axis;          // 调节轴
     SeatDirection direction; // 调节方向
+    Position seatID;        // 座椅ID
     
-    AdjustSeatReq() : axis(SeatAxis::FORWARD_BACKWARD), direction(SeatDirection::STOP) {}
-    AdjustSeatReq(SeatAxis ax, SeatDirection dir) : axis(ax), direction(dir) {}
+    AdjustSeatReq() : axis(SeatAxis::FORWARD_BACKWARD), direction(SeatDirection::STOP), seatID(Position::FRONT_LEFT) {}
+    AdjustSeatReq(SeatAxis ax, SeatDirection dir, Position seat = Position::FRONT_LEFT)
+        : axis(ax), direction(dir), seatID(seat) {}
 };
 
 // 调节座椅响应
@@ -304,9 +328,12 @@ struct AdjustSeatResp {
 // 恢复记忆位置请求
 struct RecallMemoryPositionReq {
     uint8_t presetID;       // 记忆位置ID (1-3)
+    uint8_t userID;         // 用户ID (0-3)
+    Position seatID;        // 座椅ID
     
-    RecallMemoryPositionReq() : presetID(1) {}
-    RecallMemoryPositionReq(uint8_t id) : presetID(id) {}
+    RecallMemoryPositionReq() : presetID(1), userID(0), seatID(Position::FRONT_LEFT) {}
+    RecallMemoryPositionReq(uint8_t id, uint8_t user = 0, Position seat = Position::FRONT_LEFT)
+        : presetID(id), userID(user), seatID(seat) {}
 };
 
 // 恢复记忆位置响应
@@ -321,9 +348,12 @@ struct RecallMemoryPositionResp {
 // 保存记忆位置请求
 struct SaveMemoryPositionReq {
     uint8_t presetID;       // 记忆位置ID (1-3)
+    uint8_t userID;         // 用户ID (0-3)
+    Position seatID;        // 座椅ID
     
-    SaveMemoryPositionReq() : presetID(1) {}
-    SaveMemoryPositionReq(uint8_t id) : presetID(id) {}
+    SaveMemoryPositionReq() : presetID(1), userID(0), seatID(Position::FRONT_LEFT) {}
+    SaveMemoryPositionReq(uint8_t id, uint8_t user = 0, Position seat = Position::FRONT_LEFT)
+        : presetID(id), userID(user), seatID(seat) {}
 };
 
 // 保存记忆位置响应
@@ -339,9 +369,11 @@ struct SaveMemoryPositionResp {
 struct OnSeatPositionChangedData {
     SeatAxis axis;          // 调节轴
     uint8_t newPosition;    // 新位置 (0-100%)
+    Position seatID;        // 座椅ID
     
-    OnSeatPositionChangedData() : axis(SeatAxis::FORWARD_BACKWARD), newPosition(0) {}
-    OnSeatPositionChangedData(SeatAxis ax, uint8_t pos) : axis(ax), newPosition(pos) {}
+    OnSeatPositionChangedData() : axis(SeatAxis::FORWARD_BACKWARD), newPosition(0), seatID(Position::FRONT_LEFT) {}
+    OnSeatPositionChangedData(SeatAxis ax, uint8_t pos, Position seat = Position::FRONT_LEFT)
+        : axis(ax), newPosition(pos), seatID(seat) {}
 };
 
 // 记忆保存确认事件数据
@@ -353,5 +385,15 @@ struct OnMemorySaveConfirmData {
     OnMemorySaveConfirmData(uint8_t id, Result res) : presetID(id), saveResult(res) {}
 };
 
+// 记忆位置恢复完成事件数据
+struct OnSeatRecallCompleteData {
+    Position seatID;        // 座椅ID
+    uint8_t presetID;       // 记忆位置ID
+    Result result;          // SUCCESS=到达目标位置，FAIL=被手动调节或新的恢复打断
+    
+    OnSeatRecallCompleteData() : seatID(Position::FRONT_LEFT), presetID(1), result(Result::FAIL) {}
+    OnSeatRecallCompleteData(Position seat, uint8_t id, Result res) : seatID(seat), presetID(id), result(res) {}
+};
+
 } // namespace application
 } // namespace body_controller
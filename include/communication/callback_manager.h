@@ -0,0 +1,241 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "communication/timer_wheel.h"
+#include "communication/someip_service_definitions.h"
+
+namespace body_controller {
+namespace communication {
+
+/**
+ * @brief 挂起请求的完成状态
+ *
+ * 独立于application::Result（线上协议枚举），用于区分"收到响应"与"本地判定失败"。
+ */
+enum class CallbackStatus : uint8_t {
+    COMPLETED = 0,  ///< 收到响应
+    TIMEOUT   = 1,  ///< 超时未收到响应
+    CANCELLED = 2,  ///< 被取消（客户端停止或显式取消）
+    FAILED    = 3   ///< 请求未能发出或响应无法解析
+};
+
+/**
+ * @brief 获取完成状态名称
+ */
+inline const char* ToString(CallbackStatus status) {
+    switch (status) {
+        case CallbackStatus::COMPLETED: return "COMPLETED";
+        case CallbackStatus::TIMEOUT:   return "TIMEOUT";
+        case CallbackStatus::CANCELLED: return "CANCELLED";
+        case CallbackStatus::FAILED:    return "FAILED";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * @brief 回调管理器（挂起请求注册表）
+ *
+ * 以调用者给定的ID（如方法ID+会话ID）登记挂起请求，保证每个回调恰好被调用一次：
+ * - 收到响应：COMPLETED
+ * - 超时：由分层时间轮O(1)触发，回调TIMEOUT
+ * - 取消/清理：CANCELLED
+ *
+ * 登记表按ID哈希分片以降低锁竞争；回调总是在锁外调用。
+ */
+template<typename ResponseType>
+class CallbackManager {
+public:
+    using CallbackType = std::function<void(CallbackStatus, const ResponseType&)>;
+    using CallbackId = uint64_t;
+
+    static constexpr size_t SHARD_COUNT = 16;
+
+    /**
+     * @brief 构造函数
+     * @param tick 超时检测精度
+     */
+    explicit CallbackManager(std::chrono::milliseconds tick = std::chrono::milliseconds(10))
+        : wheel_(tick) {
+        wheel_.Start([this](const std::vector<TimerWheel::Expired>& expired) { OnExpired(expired); });
+    }
+
+    ~CallbackManager() {
+        wheel_.Stop();
+        Clear();
+    }
+
+    CallbackManager(const CallbackManager&) = delete;
+    CallbackManager& operator=(const CallbackManager&) = delete;
+
+    /**
+     * @brief 注册回调函数
+     * @param id 回调ID（由调用者保证在挂起期间唯一）
+     * @param callback 回调函数
+     * @param timeout_ms 超时时间（毫秒）
+     * @return 成功返回true，ID已被占用返回false（回调不会被调用）
+     */
+    bool RegisterCallback(CallbackId id, CallbackType callback,
+                          uint32_t timeout_ms = timeouts::METHOD_CALL_TIMEOUT_MS) {
+        const uint64_t token = next_token_.fetch_add(1, std::memory_order_relaxed);
+        {
+            Shard& shard = GetShard(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (!shard.callbacks.emplace(id, CallbackInfo{std::move(callback), token}).second) {
+                return false;
+            }
+        }
+        active_count_.fetch_add(1, std::memory_order_relaxed);
+        wheel_.Schedule(id, token, timeout_ms);
+        return true;
+    }
+
+    /**
+     * @brief 以响应完成回调
+     * @param id 回调ID
+     * @param response 响应数据
+     * @return 找到挂起回调返回true
+     */
+    bool ExecuteCallback(CallbackId id, const ResponseType& response) {
+        return ResolveCallback(id, CallbackStatus::COMPLETED, response);
+    }
+
+    /**
+     * @brief 以指定状态完成回调
+     * @param id 回调ID
+     * @param status 完成状态
+     * @param response 响应数据
+     * @return 找到挂起回调返回true
+     */
+    bool ResolveCallback(CallbackId id, CallbackStatus status, const ResponseType& response) {
+        CallbackType callback;
+        if (!Extract(id, 0, callback)) {
+            return false;
+        }
+        Invoke(callback, status, response);
+        return true;
+    }
+
+    /**
+     * @brief 取消回调函数（以CANCELLED完成）
+     * @param id 回调ID
+     * @return 找到挂起回调返回true
+     */
+    bool CancelCallback(CallbackId id) {
+        return ResolveCallback(id, CallbackStatus::CANCELLED, ResponseType{});
+    }
+
+    /**
+     * @brief 获取活跃回调数量
+     */
+    size_t GetActiveCallbackCount() const {
+        return active_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 获取累计超时数量
+     */
+    uint64_t GetTimeoutCount() const {
+        return timeout_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 清理所有回调函数（全部以CANCELLED完成）
+     */
+    void Clear() {
+        for (auto& shard : shards_) {
+            std::unordered_map<CallbackId, CallbackInfo> callbacks;
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                callbacks.swap(shard.callbacks);
+            }
+            active_count_.fetch_sub(callbacks.size(), std::memory_order_relaxed);
+            for (auto& entry : callbacks) {
+                Invoke(entry.second.callback, CallbackStatus::CANCELLED, ResponseType{});
+            }
+        }
+    }
+
+private:
+    struct CallbackInfo {
+        CallbackType callback;
+        uint64_t token;     ///< 与时间轮条目对应，防止ID复用后误判超时
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<CallbackId, CallbackInfo> callbacks;
+    };
+
+    Shard& GetShard(CallbackId id) {
+        // 会话ID连续递增，乘法散列后取高位使相邻ID落在不同分片
+        return shards_[(id * 0x9E3779B97F4A7C15ULL) >> 60];
+    }
+
+    /**
+     * @brief 取出挂起回调
+     * @param token 非0时仅当令牌匹配才取出（超时路径）
+     */
+    bool Extract(CallbackId id, uint64_t token, CallbackType& callback) {
+        Shard& shard = GetShard(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.callbacks.find(id);
+        if (it == shard.callbacks.end() || (token != 0 && it->second.token != token)) {
+            return false;
+        }
+        callback = std::move(it->second.callback);
+        shard.callbacks.erase(it);
+        active_count_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void OnExpired(const std::vector<TimerWheel::Expired>& expired) {
+        for (const auto& entry : expired) {
+            CallbackType callback;
+            if (Extract(entry.key, entry.token, callback)) {
+                timeout_count_.fetch_add(1, std::memory_order_relaxed);
+                Invoke(callback, CallbackStatus::TIMEOUT, ResponseType{});
+            }
+        }
+    }
+
+    static void Invoke(const CallbackType& callback, CallbackStatus status, const ResponseType& response) {
+        if (!callback) {
+            return;
+        }
+        try {
+            callback(status, response);
+        } catch (const std::exception& e) {
+            std::cerr << "[CallbackManager] Callback error (" << ToString(status) << "): " << e.what() << std::endl;
+        }
+    }
+
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::atomic<uint64_t> next_token_{1};
+    std::atomic<size_t> active_count_{0};
+    std::atomic<uint64_t> timeout_count_{0};
+    TimerWheel wheel_;
+};
+
+/**
+ * @brief 回调管理器工厂
+ */
+class CallbackManagerFactory {
+public:
+    template<typename ResponseType>
+    static std::shared_ptr<CallbackManager<ResponseType>> Create() {
+        return std::make_shared<CallbackManager<ResponseType>>();
+    }
+};
+
+} // namespace communication
+} // namespace body_controller
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace body_controller {
+namespace communication {
+
+/**
+ * @brief 熔断器选项
+ */
+struct CircuitBreakerOptions {
+    uint32_t failure_threshold = 5;     ///< 连续失败次数阈值（0表示禁用熔断）
+    uint32_t open_duration_ms = 2000;   ///< 熔断持续时间
+};
+
+/**
+ * @brief 服务级熔断器
+ *
+ * - CLOSED：正常放行，连续失败达到阈值后转为OPEN
+ * - OPEN：直接拒绝（快速失败），持续open_duration_ms后转为HALF_OPEN
+ * - HALF_OPEN：只放行一个探测请求，成功则CLOSED，失败则重新OPEN
+ */
+class CircuitBreaker {
+public:
+    enum class State : uint8_t {
+        CLOSED    = 0,
+        OPEN      = 1,
+        HALF_OPEN = 2
+    };
+
+    using Options = CircuitBreakerOptions;
+
+    explicit CircuitBreaker(const Options& options = Options());
+
+    /**
+     * @brief 更新选项
+     */
+    void SetOptions(const Options& options);
+
+    /**
+     * @brief 是否允许发送请求
+     * @param probe_token 可选输出：放行的是HALF_OPEN探测请求时写入非0令牌，否则写入0
+     */
+    bool AllowRequest(uint64_t* probe_token = nullptr);
+
+    /**
+     * @brief 记录一次成功
+     */
+    void RecordSuccess();
+
+    /**
+     * @brief 记录一次失败（超时或错误响应）
+     */
+    void RecordFailure();
+
+    /**
+     * @brief 放弃探测请求（已放行但未产生成功/失败结果，如未能发出或被取消）
+     * @param probe_token AllowRequest给出的令牌；只有当前探测的持有者才能归还名额
+     */
+    void ReleaseProbe(uint64_t probe_token);
+
+    /**
+     * @brief 获取当前状态
+     */
+    State GetState() const;
+
+    /**
+     * @brief 获取累计被拒绝的请求数
+     */
+    uint64_t GetRejectedCount() const { return rejected_count_.load(std::memory_order_relaxed); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    mutable std::mutex mutex_;
+    Options options_;
+    State state_ = State::CLOSED;
+    uint32_t consecutive_failures_ = 0;
+    Clock::time_point opened_at_;
+    bool probe_in_flight_ = false;
+    uint64_t probe_token_ = 0;          ///< 当前探测请求的令牌
+    uint64_t next_probe_token_ = 1;
+    std::atomic<uint64_t> rejected_count_{0};
+};
+
+/**
+ * @brief 获取熔断器状态名称
+ */
+const char* ToString(CircuitBreaker::State state);
+
+} // namespace communication
+} // namespace body_controller
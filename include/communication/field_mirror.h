@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace body_controller {
+namespace communication {
+
+/**
+ * @brief 服务端字段在客户端的本地镜像
+ *
+ * 每个条目（车门、车窗、灯光类型等）只由字段通知填充，保存最近一次通知中的值（getter响应不写入），
+ * 可在任意线程同步读取而无需SOME/IP往返。服务不可用时整体失效，
+ * 重新订阅后由字段的初始通知重新填充。
+ * @tparam N 条目数量
+ */
+template<size_t N>
+class FieldMirror {
+public:
+    /**
+     * @brief 写入条目的最新值（越界索引被忽略）
+     */
+    void Update(size_t index, uint8_t value) {
+        if (index < N) {
+            entries_[index].store(VALID_BIT | value, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief 读取条目的镜像值
+     * @return 条目已被填充时返回true，否则返回false（value不变）
+     */
+    bool Get(size_t index, uint8_t& value) const {
+        if (index >= N) {
+            return false;
+        }
+        const uint16_t entry = entries_[index].load(std::memory_order_acquire);
+        if ((entry & VALID_BIT) == 0) {
+            return false;
+        }
+        value = static_cast<uint8_t>(entry & 0xFF);
+        return true;
+    }
+
+    /**
+     * @brief 使所有条目失效（服务下线时调用）
+     */
+    void Invalidate() {
+        for (auto& entry : entries_) {
+            entry.store(0, std::memory_order_release);
+        }
+    }
+
+private:
+    static constexpr uint16_t VALID_BIT = 0x100;
+
+    std::array<std::atomic<uint16_t>, N> entries_{};
+};
+
+} // namespace communication
+} // namespace body_controller
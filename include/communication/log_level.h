@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace body_controller {
+namespace communication {
+
+/**
+ * @brief 日志级别
+ *
+ * 逐请求、逐事件的日志属于DEBUG级别，默认INFO级别下不输出，
+ * 避免高频调用路径上的控制台输出成为瓶颈。
+ */
+enum class LogLevel : uint8_t {
+    DEBUG = 0,
+    INFO  = 1,
+    WARN  = 2,
+    ERROR = 3
+};
+
+/**
+ * @brief 进程级当前日志级别
+ */
+inline std::atomic<LogLevel>& CurrentLogLevel() {
+    static std::atomic<LogLevel> level{LogLevel::INFO};
+    return level;
+}
+
+/**
+ * @brief 设置日志级别
+ */
+inline void SetLogLevel(LogLevel level) {
+    CurrentLogLevel().store(level, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 指定级别的日志是否输出
+ */
+inline bool IsLogEnabled(LogLevel level) {
+    return level >= CurrentLogLevel().load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 解析日志级别名称（debug/info/warn/error）
+ * @return 名称有效返回true
+ */
+inline bool ParseLogLevel(const std::string& name, LogLevel& level) {
+    if (name == "debug") {
+        level = LogLevel::DEBUG;
+    } else if (name == "info") {
+        level = LogLevel::INFO;
+    } else if (name == "warn" || name == "warning") {
+        level = LogLevel::WARN;
+    } else if (name == "error") {
+        level = LogLevel::ERROR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace communication
+} // namespace body_controller
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include "communication/callback_manager.h"
+
+namespace body_controller {
+namespace communication {
+
+/**
+ * @brief 请求上下文（截止时间与失败通知）
+ *
+ * 由入口（如HTTP处理线程）通过Scope设置为当前线程上下文，下游在同步调用链上
+ * 用Current()捕获一份副本，从而把截止时间带到排队、合并和挂起请求表中，
+ * 且无需修改各层的回调签名。
+ */
+struct RequestContext {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point deadline = Clock::time_point::max();     ///< 截止时间（max表示不限）
+    std::function<void(CallbackStatus)> on_failure;             ///< 请求未以COMPLETED结束时的通知
+
+    /**
+     * @brief 是否设置了截止时间
+     */
+    bool HasDeadline() const { return deadline != Clock::time_point::max(); }
+
+    /**
+     * @brief 是否已过截止时间
+     */
+    bool Expired() const { return HasDeadline() && Clock::now() >= deadline; }
+
+    /**
+     * @brief 剩余预算（毫秒）；未设置截止时间返回0（表示使用方法默认超时），已过期返回1
+     */
+    uint32_t RemainingMs() const {
+        if (!HasDeadline()) {
+            return 0;
+        }
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        if (remaining <= 1) {
+            return 1;
+        }
+        return remaining > std::numeric_limits<uint32_t>::max()
+            ? std::numeric_limits<uint32_t>::max()
+            : static_cast<uint32_t>(remaining);
+    }
+
+    /**
+     * @brief 通知失败
+     */
+    void NotifyFailure(CallbackStatus status) const {
+        if (on_failure) {
+            on_failure(status);
+        }
+    }
+
+    /**
+     * @brief 获取当前线程的请求上下文（未设置时为空上下文）
+     */
+    static const RequestContext& Current() {
+        return CurrentSlot() ? *CurrentSlot() : Empty();
+    }
+
+    /**
+     * @brief 当前线程上下文作用域（RAII，可嵌套）
+     */
+    class Scope {
+    public:
+        explicit Scope(const RequestContext& context) : previous_(CurrentSlot()) {
+            CurrentSlot() = &context;
+        }
+        ~Scope() { CurrentSlot() = previous_; }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const RequestContext* previous_;
+    };
+
+private:
+    static const RequestContext*& CurrentSlot() {
+        static thread_local const RequestContext* current = nullptr;
+        return current;
+    }
+
+    static const RequestContext& Empty() {
+        static const RequestContext empty;
+        return empty;
+    }
+};
+
+} // namespace communication
+} // namespace body_controller
@@ -309,6 +309,30 @@ public:
                DeserializeEnum(buffer, offset, resp.result);
     }
     
+    static ByteBuffer Serialize(const application::GetLightStateReq& req) {
+        ByteBuffer buffer;
+        SerializeEnum(buffer, req.lightType);
+        return buffer;
+    }
+    
+    static bool Deserialize(const ByteBuffer& buffer, application::GetLightStateReq& req) {
+        size_t offset = 0;
+        return DeserializeEnum(buffer, offset, req.lightType);
+    }
+    
+    static ByteBuffer Serialize(const application::GetLightStateResp& resp) {
+        ByteBuffer buffer;
+        SerializeEnum(buffer, resp.lightType);
+        Serialize(buffer, resp.state);
+        return buffer;
+    }
+    
+    static bool Deserialize(const ByteBuffer& buffer, application::GetLightStateResp& resp) {
+        size_t offset = 0;
+        return DeserializeEnum(buffer, offset, resp.lightType) &&
+               Deserialize(buffer, offset, resp.state);
+    }
+    
     static ByteBuffer Serialize(const application::OnLightStateChangedData& data) {
         ByteBuffer buffer;
         SerializeEnum(buffer, data.lightType);
@@ -330,13 +354,17 @@ public:
         ByteBuffer buffer;
         SerializeEnum(buffer, req.axis);
         SerializeEnum(buffer, req.direction);
+        SerializeEnum(buffer, req.seatID);
         return buffer;
     }
     
+    // seatID为后加字段，旧格式的请求按主驾座椅处理
     static bool Deserialize(const ByteBuffer& buffer, application::AdjustSeatReq& req) {
         size_t offset = 0;
+        req.seatID = application::Position::FRONT_LEFT;
         return DeserializeEnum(buffer, offset, req.axis) &&
-               DeserializeEnum(buffer, offset, req.direction);
+               DeserializeEnum(buffer, offset, req.direction) &&
+               (offset >= buffer.size() || DeserializeEnum(buffer, offset, req.seatID));
     }
     
     static ByteBuffer Serialize(const application::AdjustSeatResp& resp) {
@@ -355,12 +383,19 @@ public:
     static ByteBuffer Serialize(const application::RecallMemoryPositionReq& req) {
         ByteBuffer buffer;
         Serialize(buffer, req.presetID);
+        Serialize(buffer, req.userID);
+        SerializeEnum(buffer, req.seatID);
         return buffer;
     }
     
+    // userID、seatID为后加字段，旧格式的请求按用户0、主驾座椅处理
     static bool Deserialize(const ByteBuffer& buffer, application::RecallMemoryPositionReq& req) {
         size_t offset = 0;
-        return Deserialize(buffer, offset, req.presetID);
+        req.userID = 0;
+        req.seatID = application::Position::FRONT_LEFT;
+        return Deserialize(buffer, offset, req.presetID) &&
+               (offset >= buffer.size() || Deserialize(buffer, offset, req.userID)) &&
+               (offset >= buffer.size() || DeserializeEnum(buffer, offset, req.seatID));
     }
     
     static ByteBuffer Serialize(const application::RecallMemoryPositionResp& resp) {
@@ -379,12 +414,19 @@ public:
     static ByteBuffer Serialize(const application::SaveMemoryPositionReq& req) {
         ByteBuffer buffer;
         Serialize(buffer, req.presetID);
+        Serialize(buffer, req.userID);
+        SerializeEnum(buffer, req.seatID);
         return buffer;
     }
     
+    // userID、seatID为后加字段，旧格式的请求按用户0、主驾座椅处理
     static bool Deserialize(const ByteBuffer& buffer, application::SaveMemoryPositionReq& req) {
         size_t offset = 0;
-        return Deserialize(buffer, offset, req.presetID);
+        req.userID = 0;
+        req.seatID = application::Position::FRONT_LEFT;
+        return Deserialize(buffer, offset, req.presetID) &&
+               (offset >= buffer.size() || Deserialize(buffer, offset, req.userID)) &&
+               (offset >= buffer.size() || DeserializeEnum(buffer, offset, req.seatID));
     }
     
     static ByteBuffer Serialize(const application::SaveMemoryPositionResp& resp) {
@@ -404,13 +446,16 @@ public:
         ByteBuffer buffer;
         SerializeEnum(buffer, data.axis);
         Serialize(buffer, data.newPosition);
+        SerializeEnum(buffer, data.seatID);
         return buffer;
     }
     
     static bool Deserialize(const ByteBuffer& buffer, application::OnSeatPositionChangedData& data) {
         size_t offset = 0;
+        data.seatID = application::Position::FRONT_LEFT;
         return DeserializeEnum(buffer, offset, data.axis) &&
-               Deserialize(buffer, offset, data.newPosition);
+               Deserialize(buffer, offset, data.newPosition) &&
+               (offset >= buffer.size() || DeserializeEnum(buffer, offset, data.seatID));
     }
     
     static ByteBuffer Serialize(const application::OnMemorySaveConfirmData& data) {
@@ -425,6 +470,21 @@ public:
         return Deserialize(buffer, offset, data.presetID) &&
                DeserializeEnum(buffer, offset, data.saveResult);
     }
+    
+    static ByteBuffer Serialize(const application::OnSeatRecallCompleteData& data) {
+        ByteBuffer buffer;
+        SerializeEnum(buffer, data.seatID);
+        Serialize(buffer, data.presetID);
+        SerializeEnum(buffer, data.result);
+        return buffer;
+    }
+    
+    static bool Deserialize(const ByteBuffer& buffer, application::OnSeatRecallCompleteData& data) {
+        size_t offset = 0;
+        return DeserializeEnum(buffer, offset, data.seatID) &&
+               Deserialize(buffer, offset, data.presetID) &&
+               DeserializeEnum(buffer, offset, data.result);
+    }
 };
 
 } // namespace communication
@@ -1,13 +1,21 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <functional>
 #include <mutex>
 #include <condition_variable>
+#include <unordered_map>
 #include <vsomeip/vsomeip.hpp>
 
 #include "communication/someip_service_definitions.h"
 #include "communication/serialization.h"
+#include "communication/callback_manager.h"
+#include "communication/circuit_breaker.h"
+#include "communication/field_mirror.h"
+#include "communication/log_level.h"
 #include "application/data_structures.h"
 
 namespace body_controller {
@@ -24,6 +32,36 @@ public:
     using MessageHandler = std::function<void(const std::shared_ptr<vsomeip::message>&)>;
     using AvailabilityHandler = std::function<void(vsomeip::service_t, vsomeip::instance_t, bool)>;
     using StateHandler = std::function<void(vsomeip::state_type_e)>;
+    using PendingResponseHandler = std::function<void(CallbackStatus, const std::shared_ptr<vsomeip::message>&)>;
+    template<typename ResponseType>
+    using ResponseCallback = std::function<void(CallbackStatus, const ResponseType&)>;
+
+    /**
+     * @brief 客户端调用策略
+     */
+    struct ClientPolicy {
+        uint32_t default_timeout_ms = timeouts::METHOD_CALL_TIMEOUT_MS;    ///< 未单独配置的方法超时
+        std::unordered_map<vsomeip::method_t, uint32_t> method_timeouts_ms; ///< 按方法的单次调用超时
+        uint32_t max_retry_attempts = 3;        ///< 幂等查询超时或服务忙碌拒绝时的最大尝试次数（含首次）
+        uint32_t retry_base_delay_ms = 100;     ///< 重试退避基准（指数增长，带随机抖动）
+        uint32_t retry_max_delay_ms = 2000;     ///< 重试退避上限
+        CircuitBreaker::Options circuit_breaker;
+        uint32_t max_in_flight = 4;             ///< 非安全类命令的在途窗口（0表示不限），安全类命令不占窗口
+        std::array<uint32_t, COMMAND_CLASS_COUNT> latency_budget_ms{{200, 1000, 1000}};  ///< 各类命令的延迟预算
+    };
+
+    /**
+     * @brief 单个优先级分道的统计
+     */
+    struct LaneStats {
+        uint64_t dispatched = 0;        ///< 发出的尝试数（含重试）
+        uint64_t completed = 0;         ///< 以COMPLETED结束的调用数
+        uint64_t failed = 0;            ///< 以超时、失败或取消结束的调用数
+        uint64_t over_budget = 0;       ///< 端到端延迟超出预算的调用数
+        size_t queued = 0;              ///< 当前排队等待窗口的调用数
+        uint64_t p50_latency_us = 0;    ///< 端到端延迟中位数（按2的幂分桶，取桶上界）
+        uint64_t p99_latency_us = 0;    ///< 端到端延迟p99
+    };
 
 protected:
     std::shared_ptr<vsomeip::runtime> runtime_;
@@ -59,6 +97,48 @@ public:
      */
     bool IsServiceAvailable(vsomeip::service_t service_id, vsomeip::instance_t instance_id) const;
 
+    /**
+     * @brief 获取挂起（等待响应）的请求数
+     */
+    size_t GetPendingRequestCount() const { return pending_requests_.GetActiveCallbackCount(); }
+
+    /**
+     * @brief 获取累计超时的请求数
+     */
+    uint64_t GetTimedOutRequestCount() const { return pending_requests_.GetTimeoutCount(); }
+
+    /**
+     * @brief 设置调用策略（超时、重试、熔断）
+     *
+     * 运行期间可随时调用：新策略整体替换旧快照，已发出的请求不受影响。
+     */
+    void SetPolicy(const ClientPolicy& policy);
+
+    /**
+     * @brief 获取调用策略
+     */
+    ClientPolicy GetPolicy() const;
+
+    /**
+     * @brief 获取方法的单次调用超时（毫秒）
+     */
+    uint32_t GetMethodTimeout(vsomeip::method_t method_id) const;
+
+    /**
+     * @brief 获取熔断器状态
+     */
+    CircuitBreaker::State GetCircuitState() const { return circuit_breaker_.GetState(); }
+
+    /**
+     * @brief 获取累计重试次数
+     */
+    uint64_t GetRetryCount() const { return retry_count_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 获取指定命令类别的分道统计
+     */
+    LaneStats GetLaneStats(CommandClass command_class) const;
+
 protected:
     /**
      * @brief 状态变化处理器
@@ -77,19 +157,117 @@ protected:
 
     /**
      * @brief 发送请求消息
+     * @param handler 非空时按(方法ID, 会话ID)登记为挂起请求，响应、超时或失败时恰好回调一次；
+     *        幂等方法超时后在剩余预算内按抖动退避重试，熔断期间直接以FAILED结束；
+     *        按ClassifyCommand分道，安全类命令直接发出，其余命令在在途窗口满时按优先级排队
+     * @param timeout_ms 调用方剩余预算（毫秒），0表示只受方法超时限制
+     * @return 请求（首次尝试）已发出或已排队返回true
      */
-    void SendRequest(vsomeip::service_t service_id, 
+    bool SendRequest(vsomeip::service_t service_id, 
                     vsomeip::instance_t instance_id,
                     vsomeip::method_t method_id,
-                    const std::vector<uint8_t>& payload_data);
+                    const std::vector<uint8_t>& payload_data,
+                    PendingResponseHandler handler = nullptr,
+                    uint32_t timeout_ms = 0);
+
+    /**
+     * @brief 将响应交给对应的挂起请求
+     * @return 找到挂起请求返回true（子类不再分发给全局响应处理器）
+     */
+    bool ResolvePendingRequest(const std::shared_ptr<vsomeip::message>& response);
+
+    /**
+     * @brief 将类型化响应回调包装为挂起请求处理器（负责反序列化）
+     */
+    template<typename ResponseType>
+    static PendingResponseHandler MakeResponseHandler(ResponseCallback<ResponseType> callback) {
+        return [callback](CallbackStatus status, const std::shared_ptr<vsomeip::message>& message) {
+            ResponseType response{};
+            if (status == CallbackStatus::COMPLETED) {
+                auto payload = message ? message->get_payload() : nullptr;
+                if (!payload || message->get_message_type() != vsomeip::message_type_e::MT_RESPONSE ||
+                    !Serializer::Deserialize(std::vector<uint8_t>(payload->get_data(),
+                                                                  payload->get_data() + payload->get_length()),
+                                             response)) {
+                    status = CallbackStatus::FAILED;
+                }
+            }
+            if (callback) {
+                callback(status, response);
+            }
+        };
+    }
 
     /**
      * @brief 订阅事件
+     * @param event_type 服务端以字段提供的状态使用ET_FIELD，订阅后立即收到当前值
      */
     void SubscribeEvent(vsomeip::service_t service_id,
                        vsomeip::instance_t instance_id,
                        vsomeip::event_t event_id,
-                       vsomeip::eventgroup_t eventgroup_id);
+                       vsomeip::eventgroup_t eventgroup_id,
+                       vsomeip::event_type_e event_type = vsomeip::event_type_e::ET_EVENT);
+
+private:
+    struct PendingCall;
+
+    static constexpr size_t LATENCY_BUCKETS = 32;
+
+    /**
+     * @brief 分道计数（每个分道独占缓存行）
+     */
+    struct alignas(64) LaneMetrics {
+        std::atomic<uint64_t> dispatched{0};
+        std::atomic<uint64_t> completed{0};
+        std::atomic<uint64_t> failed{0};
+        std::atomic<uint64_t> over_budget{0};
+        std::array<std::atomic<uint64_t>, LATENCY_BUCKETS> latency_buckets{};     ///< 按log2(微秒)分桶
+    };
+
+    static uint64_t MakeRequestKey(vsomeip::method_t method_id, vsomeip::session_t session_id) {
+        return (static_cast<uint64_t>(method_id) << 16) | session_id;
+    }
+
+    std::shared_ptr<vsomeip::message> CreateRequest(vsomeip::service_t service_id,
+                                                    vsomeip::instance_t instance_id,
+                                                    vsomeip::method_t method_id,
+                                                    const std::vector<uint8_t>& payload_data);
+    bool Dispatch(const std::shared_ptr<PendingCall>& call);
+    void PumpLanes();
+    void ReleaseSlot(const std::shared_ptr<PendingCall>& call);
+    void CancelQueued();
+    void RecordLaneResult(CommandClass command_class, CallbackStatus status, uint64_t latency_us);
+    bool StartAttempt(const std::shared_ptr<PendingCall>& call);
+    void OnAttemptFinished(const std::shared_ptr<PendingCall>& call, CallbackStatus status,
+                           const std::shared_ptr<vsomeip::message>& response);
+    void OnRetryTimer(const std::vector<TimerWheel::Expired>& expired);
+    void CancelRetries();
+
+    // 发送与登记在同一临界区内完成，避免响应先于登记到达
+    std::mutex send_mutex_;
+    CallbackManager<std::shared_ptr<vsomeip::message>> pending_requests_;
+
+    /**
+     * @brief 获取当前策略快照（请求路径上只做一次原子读，不加锁）
+     */
+    std::shared_ptr<const ClientPolicy> PolicySnapshot() const;
+
+    std::shared_ptr<const ClientPolicy> policy_;
+    CircuitBreaker circuit_breaker_;
+
+    // 等待退避结束的重试
+    std::mutex retry_mutex_;
+    std::unordered_map<uint64_t, std::shared_ptr<PendingCall>> pending_retries_;
+    uint64_t next_retry_token_ = 1;
+    std::atomic<uint64_t> retry_count_{0};
+
+    // 优先级分道：非安全类命令超出在途窗口时排队，窗口释放后从高优先级分道取下一条
+    mutable std::mutex lane_mutex_;
+    std::array<std::deque<std::shared_ptr<PendingCall>>, COMMAND_CLASS_COUNT> lanes_;
+    uint32_t in_flight_ = 0;
+    std::array<LaneMetrics, COMMAND_CLASS_COUNT> lane_metrics_;
+
+    TimerWheel retry_timer_;
 };
 
 /**
@@ -118,16 +296,45 @@ public:
      */
     void SetWindowPosition(const application::SetWindowPositionReq& request);
 
+    /**
+     * @brief 设置车窗位置（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool SetWindowPosition(const application::SetWindowPositionReq& request,
+                           ResponseCallback<application::SetWindowPositionResp> callback,
+                           uint32_t timeout_ms = 0);
+
     /**
      * @brief 控制车窗
      */
     void ControlWindow(const application::ControlWindowReq& request);
 
+    /**
+     * @brief 控制车窗（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool ControlWindow(const application::ControlWindowReq& request,
+                       ResponseCallback<application::ControlWindowResp> callback,
+                       uint32_t timeout_ms = 0);
+
     /**
      * @brief 获取车窗位置
      */
     void GetWindowPosition(const application::GetWindowPositionReq& request);
 
+    /**
+     * @brief 获取车窗位置（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool GetWindowPosition(const application::GetWindowPositionReq& request,
+                           ResponseCallback<application::GetWindowPositionResp> callback,
+                           uint32_t timeout_ms = 0);
+
+    /**
+     * @brief 从本地字段镜像读取车窗位置（不发起SOME/IP请求）
+     * @return 镜像已由字段通知填充时返回true
+     */
+    bool GetCachedWindowPosition(application::Position window_id, uint8_t& position) const {
+        return position_mirror_.Get(static_cast<size_t>(window_id), position);
+    }
+
     /**
      * @brief 设置事件处理器
      */
@@ -156,6 +363,9 @@ private:
     void HandleSetWindowPositionResponse(const std::shared_ptr<vsomeip::message>& message);
     void HandleControlWindowResponse(const std::shared_ptr<vsomeip::message>& message);
     void HandleGetWindowPositionResponse(const std::shared_ptr<vsomeip::message>& message);
+
+    // 车窗位置字段镜像
+    FieldMirror<application::POSITION_COUNT> position_mirror_;
 };
 
 /**
@@ -184,11 +394,37 @@ public:
      */
     void SetLockState(const application::SetLockStateReq& request);
 
+    /**
+     * @brief 设置车门锁定状态（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool SetLockState(const application::SetLockStateReq& request,
+                      ResponseCallback<application::SetLockStateResp> callback,
+                      uint32_t timeout_ms = 0);
+
     /**
      * @brief 获取车门锁定状态
      */
     void GetLockState(const application::GetLockStateReq& request);
 
+    /**
+     * @brief 获取车门锁定状态（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool GetLockState(const application::GetLockStateReq& request,
+                      ResponseCallback<application::GetLockStateResp> callback,
+                      uint32_t timeout_ms = 0);
+
+    /**
+     * @brief 从本地字段镜像读取锁定状态（不发起SOME/IP请求）
+     * @return 镜像已由字段通知填充时返回true
+     */
+    bool GetCachedLockState(application::Position door_id, application::LockState& state) const;
+
+    /**
+     * @brief 从本地字段镜像读取车门开关状态
+     * @return 镜像已由通知填充时返回true
+     */
+    bool GetCachedDoorState(application::Position door_id, application::DoorState& state) const;
+
     /**
      * @brief 设置事件处理器
      */
@@ -217,6 +453,10 @@ private:
     void HandleDoorStateChangedEvent(const std::shared_ptr<vsomeip::message>& message);
     void HandleSetLockStateResponse(const std::shared_ptr<vsomeip::message>& message);
     void HandleGetLockStateResponse(const std::shared_ptr<vsomeip::message>& message);
+
+    // 锁定状态与车门开关状态字段镜像
+    FieldMirror<application::POSITION_COUNT> lock_state_mirror_;
+    FieldMirror<application::POSITION_COUNT> door_state_mirror_;
 };
 
 /**
@@ -228,6 +468,7 @@ public:
     using SetHeadlightStateResponseHandler = std::function<void(const application::SetHeadlightStateResp&)>;
     using SetIndicatorStateResponseHandler = std::function<void(const application::SetIndicatorStateResp&)>;
     using SetPositionLightStateResponseHandler = std::function<void(const application::SetPositionLightStateResp&)>;
+    using GetLightStateResponseHandler = std::function<void(const application::GetLightStateResp&)>;
 
 public:
     explicit LightServiceClient(const std::string& app_name = "body_controller");
@@ -239,16 +480,57 @@ public:
      */
     void SetHeadlightState(const application::SetHeadlightStateReq& request);
 
+    /**
+     * @brief 设置前大灯状态（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool SetHeadlightState(const application::SetHeadlightStateReq& request,
+                           ResponseCallback<application::SetHeadlightStateResp> callback,
+                           uint32_t timeout_ms = 0);
+
     /**
      * @brief 设置转向灯状态
      */
     void SetIndicatorState(const application::SetIndicatorStateReq& request);
 
+    /**
+     * @brief 设置转向灯状态（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool SetIndicatorState(const application::SetIndicatorStateReq& request,
+                           ResponseCallback<application::SetIndicatorStateResp> callback,
+                           uint32_t timeout_ms = 0);
+
     /**
      * @brief 设置位置灯状态
      */
     void SetPositionLightState(const application::SetPositionLightStateReq& request);
 
+    /**
+     * @brief 设置位置灯状态（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool SetPositionLightState(const application::SetPositionLightStateReq& request,
+                               ResponseCallback<application::SetPositionLightStateResp> callback,
+                               uint32_t timeout_ms = 0);
+
+    /**
+     * @brief 获取灯光状态
+     */
+    void GetLightState(const application::GetLightStateReq& request);
+
+    /**
+     * @brief 获取灯光状态（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool GetLightState(const application::GetLightStateReq& request,
+                       ResponseCallback<application::GetLightStateResp> callback,
+                       uint32_t timeout_ms = 0);
+
+    /**
+     * @brief 从本地字段镜像读取灯光状态（不发起SOME/IP请求）
+     * @return 镜像已由字段通知填充时返回true
+     */
+    bool GetCachedLightState(application::LightType light_type, uint8_t& state) const {
+        return light_state_mirror_.Get(static_cast<size_t>(light_type), state);
+    }
+
     /**
      * @brief 设置事件处理器
      */
@@ -268,6 +550,10 @@ public:
         set_position_light_response_handler_ = handler;
     }
 
+    void SetGetLightStateResponseHandler(const GetLightStateResponseHandler& handler) {
+        get_light_state_response_handler_ = handler;
+    }
+
 protected:
     void OnAvailability(vsomeip::service_t service, vsomeip::instance_t instance, bool is_available) override;
     void OnMessage(const std::shared_ptr<vsomeip::message>& message) override;
@@ -277,12 +563,17 @@ private:
     void HandleSetHeadlightStateResponse(const std::shared_ptr<vsomeip::message>& message);
     void HandleSetIndicatorStateResponse(const std::shared_ptr<vsomeip::message>& message);
     void HandleSetPositionLightStateResponse(const std::shared_ptr<vsomeip::message>& message);
+    void HandleGetLightStateResponse(const std::shared_ptr<vsomeip::message>& message);
 
     // 私有成员变量
     LightStateChangedHandler light_state_changed_handler_;
     SetHeadlightStateResponseHandler set_headlight_response_handler_;
     SetIndicatorStateResponseHandler set_indicator_response_handler_;
     SetPositionLightStateResponseHandler set_position_light_response_handler_;
+    GetLightStateResponseHandler get_light_state_response_handler_;
+
+    // 灯光状态字段镜像
+    FieldMirror<application::LIGHT_TYPE_COUNT> light_state_mirror_;
 };
 
 /**
@@ -292,6 +583,7 @@ class SeatServiceClient : public SomeipClient {
 public:
     using SeatPositionChangedHandler = std::function<void(const application::OnSeatPositionChangedData&)>;
     using MemorySaveConfirmHandler = std::function<void(const application::OnMemorySaveConfirmData&)>;
+    using RecallCompleteHandler = std::function<void(const application::OnSeatRecallCompleteData&)>;
     using AdjustSeatResponseHandler = std::function<void(const application::AdjustSeatResp&)>;
     using RecallMemoryPositionResponseHandler = std::function<void(const application::RecallMemoryPositionResp&)>;
     using SaveMemoryPositionResponseHandler = std::function<void(const application::SaveMemoryPositionResp&)>;
@@ -306,16 +598,37 @@ public:
      */
     void AdjustSeat(const application::AdjustSeatReq& request);
 
+    /**
+     * @brief 调节座椅（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool AdjustSeat(const application::AdjustSeatReq& request,
+                    ResponseCallback<application::AdjustSeatResp> callback,
+                    uint32_t timeout_ms = 0);
+
     /**
      * @brief 恢复记忆位置
      */
     void RecallMemoryPosition(const application::RecallMemoryPositionReq& request);
 
+    /**
+     * @brief 恢复记忆位置（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool RecallMemoryPosition(const application::RecallMemoryPositionReq& request,
+                              ResponseCallback<application::RecallMemoryPositionResp> callback,
+                              uint32_t timeout_ms = 0);
+
     /**
      * @brief 保存记忆位置
      */
     void SaveMemoryPosition(const application::SaveMemoryPositionReq& request);
 
+    /**
+     * @brief 保存记忆位置（响应按会话关联到callback；timeout_ms为调用方剩余预算）
+     */
+    bool SaveMemoryPosition(const application::SaveMemoryPositionReq& request,
+                            ResponseCallback<application::SaveMemoryPositionResp> callback,
+                            uint32_t timeout_ms = 0);
+
     /**
      * @brief 设置事件处理器
      */
@@ -327,6 +640,10 @@ public:
         memory_save_confirm_handler_ = handler;
     }
 
+    void SetRecallCompleteHandler(const RecallCompleteHandler& handler) {
+        recall_complete_handler_ = handler;
+    }
+
     void SetAdjustSeatResponseHandler(const AdjustSeatResponseHandler& handler) {
         adjust_seat_response_handler_ = handler;
     }
@@ -346,6 +663,7 @@ protected:
 private:
     void HandleSeatPositionChangedEvent(const std::shared_ptr<vsomeip::message>& message);
     void HandleMemorySaveConfirmEvent(const std::shared_ptr<vsomeip::message>& message);
+    void HandleRecallCompleteEvent(const std::shared_ptr<vsomeip::message>& message);
     void HandleAdjustSeatResponse(const std::shared_ptr<vsomeip::message>& message);
     void HandleRecallMemoryPositionResponse(const std::shared_ptr<vsomeip::message>& message);
     void HandleSaveMemoryPositionResponse(const std::shared_ptr<vsomeip::message>& message);
@@ -353,6 +671,7 @@ private:
     // 私有成员变量
     SeatPositionChangedHandler seat_position_changed_handler_;
     MemorySaveConfirmHandler memory_save_confirm_handler_;
+    RecallCompleteHandler recall_complete_handler_;
     AdjustSeatResponseHandler adjust_seat_response_handler_;
     RecallMemoryPositionResponseHandler recall_memory_response_handler_;
     SaveMemoryPositionResponseHandler save_memory_response_handler_;
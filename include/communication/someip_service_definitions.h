@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 #include <vsomeip/vsomeip.hpp>
 
 namespace body_controller {
@@ -56,6 +58,9 @@ namespace light_service {
     constexpr vsomeip::method_t SET_HEADLIGHT_STATE    = 0x0001;
     constexpr vsomeip::method_t SET_INDICATOR_STATE    = 0x0002;
     constexpr vsomeip::method_t SET_POSITION_LIGHT_STATE = 0x0003;
+    constexpr vsomeip::method_t GET_LIGHT_STATE        = 0x0004;
+
+    constexpr uint8_t INDICATOR_HAZARD = 0x03;   // SET_INDICATOR_STATE请求首字节：危险警示灯
 }
 
 // 座椅服务方法
@@ -89,6 +94,7 @@ namespace light_events {
 namespace seat_events {
     constexpr vsomeip::event_t ON_SEAT_POSITION_CHANGED = 0x8001;
     constexpr vsomeip::event_t ON_MEMORY_SAVE_CONFIRM   = 0x8002;
+    constexpr vsomeip::event_t ON_RECALL_COMPLETE       = 0x8003;
 }
 
 // ============================================================================
@@ -175,6 +181,61 @@ namespace timeouts {
     constexpr uint32_t CONNECTION_TIMEOUT_MS = 3000;     // 连接超时
 }
 
+// ============================================================================
+// 方法语义
+// ============================================================================
+
+/**
+ * @brief 方法是否幂等（只读查询，可安全重试）
+ */
+constexpr bool IsIdempotentMethod(vsomeip::service_t service_id, vsomeip::method_t method_id) {
+    return (service_id == DOOR_SERVICE_ID && method_id == door_service::GET_LOCK_STATE) ||
+           (service_id == WINDOW_SERVICE_ID && method_id == window_service::GET_WINDOW_POSITION) ||
+           (service_id == LIGHT_SERVICE_ID && method_id == light_service::GET_LIGHT_STATE);
+}
+
+// ============================================================================
+// 命令优先级分类
+// ============================================================================
+
+/**
+ * @brief 命令类别（数值越小优先级越高）
+ */
+enum class CommandClass : uint8_t {
+    SAFETY  = 0,    // 安全相关命令：车门锁、危险警示灯
+    CONTROL = 1,    // 普通控制命令：车窗、座椅、其他灯光
+    QUERY   = 2     // 状态查询
+};
+
+constexpr size_t COMMAND_CLASS_COUNT = 3;
+
+/**
+ * @brief 按服务、方法和请求内容确定命令类别
+ */
+inline CommandClass ClassifyCommand(vsomeip::service_t service_id, vsomeip::method_t method_id,
+                                    const std::vector<uint8_t>& payload) {
+    if (service_id == DOOR_SERVICE_ID && method_id == door_service::SET_LOCK_STATE) {
+        return CommandClass::SAFETY;
+    }
+    if (service_id == LIGHT_SERVICE_ID && method_id == light_service::SET_INDICATOR_STATE &&
+        !payload.empty() && payload[0] == light_service::INDICATOR_HAZARD) {
+        return CommandClass::SAFETY;
+    }
+    return IsIdempotentMethod(service_id, method_id) ? CommandClass::QUERY : CommandClass::CONTROL;
+}
+
+/**
+ * @brief 获取命令类别名称
+ */
+inline const char* ToString(CommandClass command_class) {
+    switch (command_class) {
+        case CommandClass::SAFETY:  return "SAFETY";
+        case CommandClass::CONTROL: return "CONTROL";
+        case CommandClass::QUERY:   return "QUERY";
+    }
+    return "UNKNOWN";
+}
+
 // ============================================================================
 // 服务发现配置
 // ============================================================================
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace body_controller {
+namespace communication {
+
+/**
+ * @brief 分层时间轮
+ *
+ * 4级 × 64槽，每级槽宽为下一级整圈：以10ms刻度计可覆盖约46小时。
+ * 插入O(1)；到期时按槽整体取出，高层槽在低层转完一圈时向下级联。
+ * 时间轮只保存(key, token)，取消由持有者通过token比对惰性完成，
+ * 因此取消同样为O(1)，不需要在槽中查找。
+ */
+class TimerWheel {
+public:
+    /**
+     * @brief 到期条目
+     */
+    struct Expired {
+        uint64_t key;       ///< 持有者定义的键
+        uint64_t token;     ///< 注册时分配的唯一令牌，用于识别已被取消或复用的键
+    };
+
+    /**
+     * @brief 到期处理器（在时间轮线程中、锁外调用）
+     */
+    using ExpiryHandler = std::function<void(const std::vector<Expired>&)>;
+
+    static constexpr size_t LEVEL_COUNT = 4;
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS_PER_LEVEL = 1u << SLOT_BITS;
+
+    /**
+     * @brief 构造函数
+     * @param tick 刻度（超时精度）
+     */
+    explicit TimerWheel(std::chrono::milliseconds tick = std::chrono::milliseconds(10));
+
+    /**
+     * @brief 析构函数
+     */
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief 启动时间轮线程
+     * @param handler 到期处理器
+     */
+    void Start(ExpiryHandler handler);
+
+    /**
+     * @brief 停止时间轮线程（未到期条目被丢弃）
+     */
+    void Stop();
+
+    /**
+     * @brief 添加定时条目
+     * @param key 持有者定义的键
+     * @param token 唯一令牌
+     * @param timeout_ms 超时时间（毫秒），至少为一个刻度
+     */
+    void Schedule(uint64_t key, uint64_t token, uint32_t timeout_ms);
+
+    /**
+     * @brief 获取时间轮中的条目数（含已被惰性取消的条目）
+     */
+    size_t GetScheduledCount() const { return scheduled_count_.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry {
+        uint64_t key;
+        uint64_t token;
+        uint64_t expiry_tick;
+    };
+
+    using Slot = std::vector<Entry>;
+
+    void Run();
+    std::chrono::milliseconds TicksToDuration(uint64_t ticks) const;
+    void Insert(const Entry& entry);
+    void Cascade(size_t level);
+    void AdvanceTick(std::vector<Expired>& expired);
+
+    const std::chrono::milliseconds tick_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::array<std::array<Slot, SLOTS_PER_LEVEL>, LEVEL_COUNT> levels_;
+    uint64_t current_tick_ = 0;
+    std::chrono::steady_clock::time_point base_time_;
+    std::atomic<size_t> scheduled_count_{0};
+
+    ExpiryHandler handler_;
+    std::thread thread_;
+    bool running_ = false;
+};
+
+} // namespace communication
+} // namespace body_controller
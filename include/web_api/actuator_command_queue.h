@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "communication/someip_client.h"
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 按执行器排队的命令队列
+ *
+ * 每个执行器（如2号车窗、1号车门锁）同一时刻只有一条命令在ECU上执行，
+ * 其余命令按到达顺序排队：
+ * - 离散命令（上锁/解锁、车窗点动等）严格保序，不合并
+ * - 设定值命令（如车窗目标位置）若队尾是同类未发送的设定值，则就地替换（后写者胜），
+ *   被替换请求的回调挂到获胜命令上，收到获胜命令的响应和获胜命令的ID
+ *
+ * 只替换队尾可保证设定值不会越过其后提交的离散命令。
+ */
+class ActuatorCommandQueue {
+public:
+    using ActuatorKey = uint32_t;
+    using CommandId = uint64_t;
+
+    template<typename ResponseType>
+    using Sender = std::function<void(communication::SomeipClient::ResponseCallback<ResponseType>)>;
+
+    template<typename ResponseType>
+    using Callback = communication::SomeipClient::ResponseCallback<ResponseType>;
+
+    /**
+     * @brief 设定值命令的归属：提交时分配的ID与实际发送到ECU的（获胜）命令ID
+     */
+    struct SetPointOutcome {
+        CommandId submitted_id = 0;
+        CommandId executed_id = 0;
+
+        bool Collapsed() const { return submitted_id != executed_id; }
+    };
+
+    template<typename ResponseType>
+    using SetPointCallback = std::function<void(communication::CallbackStatus, const ResponseType&,
+                                                const SetPointOutcome&)>;
+
+    /**
+     * @brief 生成执行器键
+     * @param service_id 服务ID
+     * @param actuator_id 服务内的执行器编号（车窗/车门ID、灯光方法ID等）
+     */
+    static ActuatorKey MakeKey(uint16_t service_id, uint16_t actuator_id) {
+        return (static_cast<ActuatorKey>(service_id) << 16) | actuator_id;
+    }
+
+    /**
+     * @brief 提交离散命令（保序，不合并）
+     * @param key 执行器键
+     * @param send 实际发送命令的函数，完成回调必须恰好调用一次
+     * @param callback 完成回调（响应、超时或失败）
+     * @return 命令ID
+     */
+    template<typename ResponseType>
+    CommandId Submit(ActuatorKey key, Sender<ResponseType> send, Callback<ResponseType> callback) {
+        SetPointCallback<ResponseType> waiter;
+        if (callback) {
+            waiter = [callback = std::move(callback)](communication::CallbackStatus status, const ResponseType& response,
+                                                      const SetPointOutcome&) {
+                callback(status, response);
+            };
+        }
+        return Enqueue<ResponseType>(key, 0, std::move(send), std::move(waiter));
+    }
+
+    /**
+     * @brief 提交设定值命令（后写者胜）
+     * @param key 执行器键
+     * @param kind 设定值类别（非0，同类别的命令才会互相替换，且须对应同一响应类型）
+     * @param send 实际发送命令的函数
+     * @param callback 响应回调（被合并时收到获胜命令的响应，outcome.executed_id为获胜命令ID）
+     * @return 本次提交分配的命令ID
+     */
+    template<typename ResponseType>
+    CommandId SubmitSetPoint(ActuatorKey key, uint16_t kind, Sender<ResponseType> send,
+                             SetPointCallback<ResponseType> callback) {
+        return Enqueue<ResponseType>(key, kind, std::move(send), std::move(callback));
+    }
+
+    /**
+     * @brief 获取排队中（未发送）的命令数
+     */
+    size_t GetQueuedCount() const;
+
+    /**
+     * @brief 获取累计发送到ECU的命令数
+     */
+    uint64_t GetDispatchedCount() const { return dispatched_count_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 获取累计被合并（未发送）的设定值命令数
+     */
+    uint64_t GetCollapsedCount() const { return collapsed_count_.load(std::memory_order_relaxed); }
+
+private:
+    using Done = std::function<void()>;
+
+    template<typename ResponseType>
+    struct Waiter {
+        CommandId submitted_id;
+        SetPointCallback<ResponseType> callback;
+    };
+
+    template<typename ResponseType>
+    struct CommandState {
+        Sender<ResponseType> send;
+        std::vector<Waiter<ResponseType>> waiters;
+        CommandId id = 0;
+    };
+
+    struct Command {
+        CommandId id;
+        uint16_t kind;                          ///< 0表示离散命令
+        std::shared_ptr<void> state;            ///< CommandState<ResponseType>
+        std::function<void(Done)> dispatch;
+    };
+
+    struct Actuator {
+        std::deque<Command> pending;
+        bool busy = false;                      ///< 是否有命令在ECU上执行
+    };
+
+    template<typename ResponseType>
+    CommandId Enqueue(ActuatorKey key, uint16_t kind, Sender<ResponseType> send, SetPointCallback<ResponseType> callback) {
+        CommandId id = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            id = next_id_++;
+            Actuator& actuator = actuators_[key];
+
+            if (kind != 0 && !actuator.pending.empty() && actuator.pending.back().kind == kind) {
+                // 队尾同类设定值尚未发送：替换为最新目标，保留所有等待者
+                Command& tail = actuator.pending.back();
+                auto state = std::static_pointer_cast<CommandState<ResponseType>>(tail.state);
+                if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+                    std::cout << "[ActuatorCommandQueue] Command #" << state->id
+                              << " superseded by #" << id << std::endl;
+                }
+                state->send = std::move(send);
+                state->id = id;
+                state->waiters.push_back({id, std::move(callback)});
+                tail.id = id;
+                collapsed_count_.fetch_add(1, std::memory_order_relaxed);
+                return id;
+            }
+
+            auto state = std::make_shared<CommandState<ResponseType>>();
+            state->send = std::move(send);
+            state->id = id;
+            state->waiters.push_back({id, std::move(callback)});
+
+            Command command;
+            command.id = id;
+            command.kind = kind;
+            command.state = state;
+            command.dispatch = [state](Done done) {
+                state->send([state, done](communication::CallbackStatus status, const ResponseType& response) {
+                    if (status != communication::CallbackStatus::COMPLETED) {
+                        std::cerr << "[ActuatorCommandQueue] Command #" << state->id << " finished with "
+                                  << communication::ToString(status) << std::endl;
+                    }
+                    for (const auto& waiter : state->waiters) {
+                        if (waiter.callback) {
+                            SetPointOutcome outcome;
+                            outcome.submitted_id = waiter.submitted_id;
+                            outcome.executed_id = state->id;
+                            waiter.callback(status, response, outcome);
+                        }
+                    }
+                    done();
+                });
+            };
+            actuator.pending.push_back(std::move(command));
+        }
+
+        Pump(key);
+        return id;
+    }
+
+    /**
+     * @brief 执行器空闲时发送下一条命令
+     */
+    void Pump(ActuatorKey key);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<ActuatorKey, Actuator> actuators_;
+    CommandId next_id_ = 1;
+    std::atomic<uint64_t> dispatched_count_{0};
+    std::atomic<uint64_t> collapsed_count_{0};
+};
+
+} // namespace web_api
+} // namespace body_controller
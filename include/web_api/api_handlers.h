@@ -3,10 +3,17 @@
 #include <memory>
 #include <functional>
 #include <atomic>
+#include <unordered_map>
 #include <nlohmann/json.hpp>
 #include "communication/someip_client.h"
+#include "communication/request_context.h"
 #include "application/data_structures.h"
 #include "web_api/json_converter.h"
+#include "web_api/event_bus.h"
+#include "web_api/event_coalescer.h"
+#include "web_api/single_flight.h"
+#include "web_api/actuator_command_queue.h"
+#include "web_api/config_manager.h"
 
 namespace body_controller {
 namespace web_api {
@@ -15,6 +22,18 @@ namespace web_api {
 class WebSocketServer;
 class HttpServer;
 
+/**
+ * @brief 车窗目标位置请求的HTTP结果
+ *
+ * 同一车窗排队中的目标会被后提交的目标替换，被替换的请求收到获胜命令的响应，
+ * commandID指向实际执行的命令，collapsed表示本请求的目标已被取代
+ */
+struct SetWindowPositionResult {
+    application::SetWindowPositionResp response;
+    uint64_t commandID = 0;     ///< 实际发送到ECU的（获胜）命令ID
+    bool collapsed = false;     ///< 本请求是否被后提交的目标合并
+};
+
 /**
  * @brief API处理器类
  * 
@@ -56,6 +75,33 @@ public:
      */
     void SetHttpServer(std::shared_ptr<HttpServer> http_server);
 
+    /**
+     * @brief 获取内部事件总线（供SSE以外的消费者订阅SOME/IP事件）
+     * @return 事件总线实例
+     */
+    std::shared_ptr<EventBus> GetEventBus() const;
+
+    /**
+     * @brief 设置SSE高频事件合并选项（需在Initialize之前调用）
+     * @param options 合并选项
+     */
+    void SetSseCoalescingOptions(const EventCoalescer::Options& options);
+
+    /**
+     * @brief 应用Web服务器配置
+     *
+     * 设置SSE合并窗口与订阅缓冲区，以及各服务客户端的超时、重试、熔断与分道策略。
+     * 可在运行期间重复调用（配置热加载），SSE缓冲区容量只在Initialize时生效。
+     * @param config Web服务器配置
+     */
+    void ApplyConfig(const WebServerConfig& config);
+
+    /**
+     * @brief 获取各服务客户端按命令类别的分道统计
+     * @return JSON对象（服务名 -> 类别 -> 统计）
+     */
+    nlohmann::json GetLaneMetrics() const;
+
     // WebSocket服务器已移除，使用SSE替代事件广播
     
     // ============================================================================
@@ -88,7 +134,7 @@ public:
      * @param callback 响应回调函数
      */
     void HandleWindowPositionRequest(const application::SetWindowPositionReq& request,
-                                    std::function<void(const application::SetWindowPositionResp&)> callback);
+                                    std::function<void(const SetWindowPositionResult&)> callback);
     
     /**
      * @brief 处理车窗控制请求
@@ -134,6 +180,14 @@ public:
     void HandlePositionLightRequest(const application::SetPositionLightStateReq& request,
                                    std::function<void(const application::SetPositionLightStateResp&)> callback);
     
+    /**
+     * @brief 处理灯光状态查询请求
+     * @param request 状态查询请求
+     * @param callback 响应回调函数
+     */
+    void HandleLightStatusRequest(const application::GetLightStateReq& request,
+                                 std::function<void(const application::GetLightStateResp&)> callback);
+    
     // ============================================================================
     // 座椅服务处理
     // ============================================================================
@@ -200,13 +254,40 @@ private:
      * @brief 设置事件处理器
      */
     void SetupEventHandlers();
-    
+
+    /**
+     * @brief 将client_policies_应用到已创建的服务客户端
+     */
+    void ApplyClientPolicies();
+
     /**
-     * @brief 广播事件到WebSocket客户端
-     * @param event_type 事件类型
-     * @param data 事件数据
+     * @brief 将一批总线事件通过SSE推送到前端（在SSE订阅者线程中调用）
+     * @param events 事件批次
      */
-    void BroadcastEvent(const std::string& event_type, const nlohmann::json& data);
+    void ForwardEventsToSse(const std::vector<BusEvent>& events);
+
+    /**
+     * @brief 将HTTP层回调适配为客户端挂起请求回调
+     *
+     * 捕获当前线程的RequestContext，非COMPLETED状态通过其on_failure通知调用方。
+     */
+    template<typename ResponseType>
+    static communication::SomeipClient::ResponseCallback<ResponseType> MakeClientCallback(
+        std::function<void(const ResponseType&)> callback);
+
+    /**
+     * @brief 生成延迟发送函数（携带当前请求的截止时间，发送时按剩余预算设定超时）
+     */
+    template<typename Client, typename Request, typename ResponseType>
+    static ActuatorCommandQueue::Sender<ResponseType> MakeSender(
+        std::shared_ptr<Client> client,
+        bool (Client::*method)(const Request&, communication::SomeipClient::ResponseCallback<ResponseType>, uint32_t),
+        const Request& request);
+
+    /**
+     * @brief 生成查询合并键（服务ID + 方法ID + 请求payload）
+     */
+    static std::string MakeQueryKey(uint16_t service_id, uint16_t method_id, const std::vector<uint8_t>& payload);
 
 private:
     // SOME/IP服务客户端
@@ -220,6 +301,25 @@ private:
     // HTTP服务器引用（用于SSE事件推送）
     std::weak_ptr<HttpServer> http_server_;
 
+    // SOME/IP事件总线及SSE订阅
+    std::shared_ptr<EventBus> event_bus_;
+    EventBus::SubscriptionId sse_subscription_ = 0;
+    EventCoalescer::Options sse_coalescing_options_;
+    size_t sse_queue_capacity_ = 1024;
+    size_t sse_max_batch_size_ = 64;
+
+    // 各服务客户端策略（按服务ID）
+    std::unordered_map<uint16_t, communication::SomeipClient::ClientPolicy> client_policies_;
+    std::unique_ptr<EventCoalescer> sse_coalescer_;
+
+    // 状态查询的single-flight合并（仅在字段镜像尚未填充时发起getter调用）
+    SingleFlight<application::GetLockStateResp> door_status_flights_;
+    SingleFlight<application::GetWindowPositionResp> window_status_flights_;
+    SingleFlight<application::GetLightStateResp> light_status_flights_;
+
+    // 控制命令按执行器排队，车窗目标位置按后写者胜合并
+    ActuatorCommandQueue command_queue_;
+
     // 运行状态
     std::atomic<bool> running_{false};
 };
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "web_api/json_converter.h"
+#include "web_api/fast_json_codec.h"
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 请求/响应体编码格式
+ */
+enum class BodyFormat : uint8_t {
+    JSON    = 0,    ///< application/json（浏览器默认）
+    MSGPACK = 1,    ///< application/msgpack
+    CBOR    = 2     ///< application/cbor
+};
+
+/**
+ * @brief 内容协商编解码器
+ *
+ * 二进制格式复用JsonConverter的字段映射，仅替换序列化层，
+ * 保证JSON与MessagePack/CBOR客户端看到相同的数据模型。
+ * JSON格式仍走FastJsonCodec快速路径。
+ */
+class BodyCodec {
+public:
+    /**
+     * @brief 根据Content-Type确定请求体格式（未识别时为JSON）
+     */
+    static BodyFormat FromContentType(const std::string& content_type);
+
+    /**
+     * @brief 根据Accept确定响应体格式（按列出顺序取第一个支持的类型，未识别时为JSON）
+     */
+    static BodyFormat FromAccept(const std::string& accept);
+
+    /**
+     * @brief 获取格式对应的MIME类型
+     */
+    static const char* GetContentType(BodyFormat format);
+
+    /**
+     * @brief 解析请求体
+     * @throws nlohmann::json::exception 格式错误时抛出
+     */
+    static nlohmann::json Parse(const std::string& body, BodyFormat format);
+
+    /**
+     * @brief 序列化JSON值
+     */
+    static std::string Serialize(const nlohmann::json& value, BodyFormat format);
+
+    /**
+     * @brief 解码请求结构体
+     */
+    template<typename T>
+    static T DecodeRequest(const std::string& body, BodyFormat format) {
+        if (format == BodyFormat::JSON) {
+            return FastJsonCodec::DecodeRequest<T>(body);
+        }
+        return JsonConverter::FromJson<T>(Parse(body, format));
+    }
+};
+
+} // namespace web_api
+} // namespace body_controller
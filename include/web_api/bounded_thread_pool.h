@@ -0,0 +1,76 @@
+#pragma once
+
+#include <httplib.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 有界队列的HTTP工作线程池
+ *
+ * 替代httplib默认的无界ThreadPool：已接受的连接（执行中+排队）达到上限后
+ * enqueue返回false，httplib直接关闭新连接，排队不会无限增长。
+ * 排队深度通过Stats公开，HttpServer据此在饱和前以503 + Retry-After快速拒绝请求。
+ */
+class BoundedThreadPool : public httplib::TaskQueue {
+public:
+    /**
+     * @brief 线程池统计（由HttpServer持有，生命周期长于httplib管理的线程池）
+     */
+    struct Stats {
+        std::atomic<size_t> threads{0};         ///< 工作线程数
+        std::atomic<size_t> active{0};          ///< 正在处理的连接数
+        std::atomic<size_t> queued{0};          ///< 等待工作线程的连接数
+        std::atomic<uint64_t> completed{0};     ///< 处理完成的连接数
+        std::atomic<uint64_t> rejected{0};      ///< 超过上限被直接关闭的连接数
+        std::atomic<uint64_t> shed{0};          ///< 以503拒绝的请求数
+    };
+
+    /**
+     * @brief 构造函数
+     * @param thread_count 工作线程数
+     * @param max_connections 执行中与排队连接总数上限（0表示不限）
+     * @param stats 统计对象
+     */
+    BoundedThreadPool(size_t thread_count, size_t max_connections, std::shared_ptr<Stats> stats);
+
+    ~BoundedThreadPool() override;
+
+    BoundedThreadPool(const BoundedThreadPool&) = delete;
+    BoundedThreadPool& operator=(const BoundedThreadPool&) = delete;
+
+    /**
+     * @brief 提交连接处理任务
+     * @return 达到连接上限或已关闭时返回false
+     */
+    bool enqueue(std::function<void()> fn) override;
+
+    /**
+     * @brief 停止接收任务，处理完已排队的任务后结束工作线程
+     */
+    void shutdown() override;
+
+private:
+    void WorkerLoop();
+
+    const size_t max_connections_;
+    std::shared_ptr<Stats> stats_;
+
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool shutdown_ = false;
+    std::vector<std::thread> workers_;
+};
+
+} // namespace web_api
+} // namespace body_controller
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 namespace body_controller {
@@ -16,25 +21,43 @@ struct WebServerConfig {
     std::string http_host = "0.0.0.0";
     bool enable_cors = true;
     size_t max_request_size = 1024 * 1024; // 1MB
+    size_t thread_pool_size = 8;             // HTTP工作线程数（0表示按CPU核数）
+    size_t keep_alive_max_count = 100;       // 单个keep-alive连接最多处理的请求数
+    uint32_t keep_alive_timeout_s = 5;       // keep-alive空闲超时（秒）
+    uint32_t read_timeout_ms = 5000;         // 读取请求超时
+    uint32_t write_timeout_ms = 5000;        // 写出响应超时
+    size_t shed_queue_depth = 32;            // 排队连接达到该深度后以503拒绝新请求（0表示不主动拒绝）
+    uint32_t retry_after_s = 1;              // 503响应的Retry-After（秒）
     
     // WebSocket服务器配置
     int websocket_port = 8081;
     std::string websocket_host = "0.0.0.0";
-    size_t max_connections = 100;
+    size_t max_connections = 100;            // HTTP执行中与排队连接总数上限，超出时直接关闭新连接
     uint32_t ping_interval_ms = 30000; // 30秒
     
+    // SSE配置
+    uint32_t sse_coalesce_window_ms = 50;    // 高频位置事件合并窗口（0表示不合并）
+    size_t sse_queue_capacity = 1024;        // SSE订阅者环形缓冲区容量
+    size_t sse_max_batch_size = 64;          // SSE单批最大事件数
+    uint32_t sse_heartbeat_interval_ms = 30000;
+    
     // 静态文件配置
     std::string web_root = "./web";
     bool enable_directory_listing = false;
+    uint32_t static_max_age_s = 0;           // 未带版本资源的缓存时间（0表示每次按ETag重新验证）
+    uint32_t versioned_max_age_s = 31536000; // 带版本资源的缓存时间（1年）
     
     // 日志配置
     std::string log_level = "info";
     bool enable_access_log = true;
     std::string log_file = "";
+    bool enable_config_watch = true;         // 监视配置文件变化并热加载
     
     // 安全配置
     bool enable_rate_limiting = true;
-    uint32_t rate_limit_requests = 100;
+    uint32_t rate_limit_requests = 600;        // 每个客户端每个窗口的查询数
+    uint32_t rate_limit_commands = 120;        // 每个客户端每个窗口的执行器命令数
+    uint32_t rate_limit_sse_connects = 10;     // 每个客户端每个窗口的SSE连接数
     uint32_t rate_limit_window_ms = 60000; // 1分钟
     
     // 超时配置
@@ -44,13 +67,34 @@ struct WebServerConfig {
     // SOME/IP配置
     std::string vsomeip_config_path = "./config/vsomeip.json";
     std::string vsomeip_app_name = "web_server";
+    uint32_t method_call_timeout_ms = 5000;  // 未单独配置的方法超时
+    uint32_t max_retry_attempts = 3;         // 幂等查询超时或服务忙碌拒绝时的最大尝试次数
+    uint32_t circuit_open_duration_ms = 2000; // 熔断持续时间
+    uint32_t max_in_flight = 4;              // 非安全类命令的在途窗口
+    uint32_t safety_budget_ms = 200;         // 安全类命令延迟预算
+    uint32_t control_budget_ms = 1000;       // 控制类命令延迟预算
+    uint32_t query_budget_ms = 1000;         // 查询类命令延迟预算
+    std::unordered_map<uint32_t, uint32_t> method_timeouts_ms; // (服务ID << 16 | 方法ID) -> 单次调用超时
 };
 
 /**
  * @brief 配置管理器
+ *
+ * 当前生效的配置以不可变快照发布：重新加载时构造新快照并原子替换指针，
+ * 读者拿到的快照在其持有期间保持不变，读路径不加锁（RCU方式）。
  */
 class ConfigManager {
 public:
+    using ReloadListener = std::function<void(const WebServerConfig&)>;
+
+    /**
+     * @brief 按 配置文件 -> 环境变量 -> 命令行 的顺序加载配置
+     *
+     * 配置文件路径取自--config参数或BODY_CONTROLLER_CONFIG环境变量，
+     * 默认为./config/system_config.json；后一来源覆盖前一来源。
+     */
+    static WebServerConfig Load(int argc, char* argv[]);
+    
     /**
      * @brief 从文件加载配置
      */
@@ -108,6 +152,67 @@ public:
      * @brief 打印配置信息
      */
     static void PrintConfig(const WebServerConfig& config);
+    
+    /**
+     * @brief 获取当前配置快照
+     */
+    static std::shared_ptr<const WebServerConfig> GetSnapshot();
+    
+    /**
+     * @brief 获取当前配置（请求热路径使用）
+     *
+     * 每个线程缓存一份快照，版本未变化时只有一次原子读。
+     * 返回的引用在本线程下一次调用Current()之前有效，不要跨调用保存。
+     */
+    static const WebServerConfig& Current();
+    
+    /**
+     * @brief 获取快照版本（每次发布加1，0表示尚未发布）
+     */
+    static uint64_t GetVersion();
+    
+    /**
+     * @brief 发布新的配置快照并通知监听者
+     *
+     * 首次发布之后，监听地址、线程池、连接参数、缓冲区容量等只在启动时生效的字段
+     * 保持原值并打印警告，快照始终反映实际生效的配置。
+     */
+    static void Publish(const WebServerConfig& config);
+    
+    /**
+     * @brief 注册配置发布监听者（在发布线程中调用，监听者之间串行）
+     */
+    static void AddReloadListener(ReloadListener listener);
+    
+    /**
+     * @brief 按启动时的来源（配置文件 -> 环境变量 -> 命令行）重新加载并发布
+     * @param error_message 失败原因
+     * @return 成功返回true；文件缺失、解析失败或校验失败时保持当前快照
+     */
+    static bool Reload(std::string& error_message);
+    
+    /**
+     * @brief 将部分配置（与配置文件结构相同）合并到当前快照并发布
+     * @param patch JSON合并补丁
+     * @param error_message 失败原因
+     * @return 成功返回true
+     */
+    static bool ApplyPatch(const nlohmann::json& patch, std::string& error_message);
+    
+    /**
+     * @brief 获取Load使用的配置文件路径
+     */
+    static std::string GetConfigFile();
+    
+    /**
+     * @brief 是否为可识别的命令行选项
+     */
+    static bool IsKnownOption(const std::string& option);
+    
+    /**
+     * @brief 打印命令行选项及对应环境变量
+     */
+    static void PrintOptions();
 
 private:
     /**
@@ -119,6 +224,22 @@ private:
      * @brief 解析命令行参数
      */
     static std::unordered_map<std::string, std::string> ParseCommandLine(int argc, char* argv[]);
+    
+    /**
+     * @brief 将环境变量覆盖到已有配置
+     */
+    static void ApplyEnvironment(WebServerConfig& config);
+    
+    /**
+     * @brief 将命令行参数覆盖到已有配置
+     */
+    static void ApplyCommandLine(WebServerConfig& config, int argc, char* argv[]);
+    
+    /**
+     * @brief 将只在启动时生效的字段恢复为当前值
+     * @return 被恢复的字段名
+     */
+    static std::vector<std::string> PinStartupFields(const WebServerConfig& current, WebServerConfig& next);
 };
 
 } // namespace web_api
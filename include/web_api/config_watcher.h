@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 配置文件变化监视器（inotify）
+ *
+ * 监视配置文件所在目录而不是文件本身：编辑器通常写临时文件再rename覆盖，
+ * 直接监视文件会在第一次保存后丢失watch。目标文件被写入关闭或rename到位后，
+ * 等待一个去抖窗口（合并同一次保存产生的多个事件）再调用变化回调。
+ */
+class ConfigWatcher {
+public:
+    using ChangeHandler = std::function<void()>;
+
+    /**
+     * @brief 构造函数
+     * @param config_file 配置文件路径
+     * @param handler 变化回调（在监视线程中调用）
+     * @param debounce 去抖窗口
+     */
+    ConfigWatcher(const std::string& config_file, ChangeHandler handler,
+                  std::chrono::milliseconds debounce = std::chrono::milliseconds(200));
+
+    /**
+     * @brief 析构函数
+     */
+    ~ConfigWatcher();
+
+    ConfigWatcher(const ConfigWatcher&) = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    /**
+     * @brief 启动监视线程
+     * @return 成功返回true
+     */
+    bool Start();
+
+    /**
+     * @brief 停止监视线程
+     */
+    void Stop();
+
+    /**
+     * @brief 是否正在监视
+     */
+    bool IsRunning() const { return running_; }
+
+private:
+    void WatchLoop();
+
+    /**
+     * @brief 读取并过滤inotify事件
+     * @return 是否有目标文件的变化事件
+     */
+    bool DrainEvents();
+
+    std::string directory_;
+    std::string file_name_;
+    ChangeHandler handler_;
+    std::chrono::milliseconds debounce_;
+
+    int inotify_fd_ = -1;
+    int wake_fd_ = -1;                          ///< eventfd，用于唤醒并停止监视线程
+    std::thread watch_thread_;
+    std::atomic<bool> running_{false};
+};
+
+} // namespace web_api
+} // namespace body_controller
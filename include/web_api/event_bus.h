@@ -0,0 +1,277 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+#include "application/data_structures.h"
+
+namespace body_controller {
+namespace web_api {
+
+// ============================================================================
+// 事件主题定义
+// ============================================================================
+
+/**
+ * @brief 事件主题
+ *
+ * 与data_structures.h中的On*Data结构一一对应，
+ * 枚举值顺序必须与EventPayload中的类型顺序保持一致
+ */
+enum class EventTopic : uint8_t {
+    LOCK_STATE_CHANGED      = 0,
+    DOOR_STATE_CHANGED      = 1,
+    WINDOW_POSITION_CHANGED = 2,
+    LIGHT_STATE_CHANGED     = 3,
+    SEAT_POSITION_CHANGED   = 4,
+    MEMORY_SAVE_CONFIRM     = 5,
+    SEAT_RECALL_COMPLETE    = 6
+};
+
+constexpr size_t EVENT_TOPIC_COUNT = 7;
+
+/**
+ * @brief 事件负载（类型化主题）
+ */
+using EventPayload = std::variant<
+    application::OnLockStateChangedData,
+    application::OnDoorStateChangedData,
+    application::OnWindowPositionChangedData,
+    application::OnLightStateChangedData,
+    application::OnSeatPositionChangedData,
+    application::OnMemorySaveConfirmData,
+    application::OnSeatRecallCompleteData
+>;
+
+static_assert(std::variant_size_v<EventPayload> == EVENT_TOPIC_COUNT,
+              "EventTopic and EventPayload must stay in sync");
+
+/**
+ * @brief 总线事件
+ */
+struct BusEvent {
+    EventTopic topic;                                   ///< 事件主题
+    uint64_t sequence;                                  ///< 全局发布序号
+    std::chrono::steady_clock::time_point publish_time; ///< 发布时间
+    EventPayload payload;                               ///< 事件数据
+
+    BusEvent() : topic(EventTopic::LOCK_STATE_CHANGED), sequence(0) {}
+
+    template<typename T>
+    const T* As() const { return std::get_if<T>(&payload); }
+};
+
+/**
+ * @brief 获取事件的实体键（车门/车窗ID、灯光类型、座椅轴等）
+ * 用于按（主题，实体）进行合并
+ */
+uint8_t GetEventEntityKey(const BusEvent& event);
+
+/**
+ * @brief 主题名称（用于日志）
+ */
+const char* ToString(EventTopic topic);
+
+// ============================================================================
+// 无锁MPSC环形缓冲区
+// ============================================================================
+
+/**
+ * @brief 有界多生产者单消费者环形缓冲区
+ *
+ * 基于每个槽位的序号实现，生产者之间通过CAS竞争写入位置，
+ * 缓冲区满时TryPush立即返回false，生产者永不阻塞
+ */
+template<typename T>
+class MpscRingBuffer {
+public:
+    /**
+     * @brief 构造函数
+     * @param capacity 容量（向上取整为2的幂）
+     */
+    explicit MpscRingBuffer(size_t capacity)
+        : capacity_(RoundUpToPowerOfTwo(capacity))
+        , mask_(capacity_ - 1)
+        , cells_(new Cell[capacity_]) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer&) = delete;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+
+    /**
+     * @brief 写入元素（可被多个线程并发调用）
+     * @return 缓冲区已满时返回false
+     */
+    bool TryPush(const T& value) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief 读取元素（仅允许单个消费者线程调用）
+     * @return 缓冲区为空时返回false
+     */
+    bool TryPop(T& value) {
+        Cell& cell = cells_[dequeue_pos_ & mask_];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(dequeue_pos_ + 1) < 0) {
+            return false;
+        }
+        value = std::move(cell.data);
+        cell.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+        ++dequeue_pos_;
+        return true;
+    }
+
+    size_t Capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    static size_t RoundUpToPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) size_t dequeue_pos_ = 0;
+};
+
+// ============================================================================
+// 事件总线
+// ============================================================================
+
+/**
+ * @brief 进程内发布/订阅事件总线
+ *
+ * SOME/IP客户端回调（vsomeip分发线程）作为生产者发布类型化事件，
+ * 每个订阅者拥有独立的MPSC环形缓冲区和投递线程，批量接收事件。
+ * 发布路径不执行任何消费者代码，慢消费者只会导致自身缓冲区溢出丢弃。
+ */
+class EventBus {
+public:
+    using SubscriptionId = uint64_t;
+    using BatchHandler = std::function<void(const std::vector<BusEvent>&)>;
+
+    /**
+     * @brief 订阅选项
+     */
+    struct SubscriptionOptions {
+        std::string name = "subscriber";                        ///< 订阅者名称（用于日志和统计）
+        std::bitset<EVENT_TOPIC_COUNT> topics = std::bitset<EVENT_TOPIC_COUNT>().set(); ///< 订阅的主题
+        std::bitset<EVENT_TOPIC_COUNT> coalesce_topics;         ///< 批内只保留每个实体最新值的主题
+        size_t queue_capacity = 1024;                           ///< 环形缓冲区容量
+        size_t max_batch_size = 64;                             ///< 单批最大事件数
+        std::chrono::milliseconds idle_wait{100};               ///< 空闲时最长等待时间
+    };
+
+    /**
+     * @brief 订阅者统计信息
+     */
+    struct SubscriberStats {
+        std::string name;
+        uint64_t delivered;   ///< 已投递事件数
+        uint64_t coalesced;   ///< 被合并的事件数
+        uint64_t dropped;     ///< 缓冲区满被丢弃的事件数
+    };
+
+    EventBus();
+    ~EventBus();
+
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    /**
+     * @brief 添加订阅者，并启动其投递线程
+     * @param options 订阅选项
+     * @param handler 批量事件处理函数（在订阅者自己的线程中调用）
+     * @return 订阅ID
+     */
+    SubscriptionId Subscribe(const SubscriptionOptions& options, BatchHandler handler);
+
+    /**
+     * @brief 移除订阅者（不可在该订阅者的处理函数中调用）
+     */
+    void Unsubscribe(SubscriptionId id);
+
+    /**
+     * @brief 发布类型化事件
+     * @tparam T On*Data事件数据类型
+     */
+    template<typename T>
+    void Publish(const T& data) {
+        BusEvent event;
+        event.payload = data;
+        event.topic = static_cast<EventTopic>(event.payload.index());
+        PublishEvent(event);
+    }
+
+    /**
+     * @brief 停止所有订阅者线程（剩余事件会在退出前投递）
+     */
+    void Shutdown();
+
+    /**
+     * @brief 获取所有订阅者的统计信息
+     */
+    std::vector<SubscriberStats> GetSubscriberStats() const;
+
+    /**
+     * @brief 获取已发布事件总数
+     */
+    uint64_t GetPublishedCount() const { return next_sequence_.load(std::memory_order_relaxed); }
+
+private:
+    class Subscriber;
+    using SubscriberList = std::vector<std::shared_ptr<Subscriber>>;
+
+    void PublishEvent(BusEvent& event);
+
+    // 订阅者列表采用写时复制，发布路径只做一次原子加载
+    std::shared_ptr<const SubscriberList> subscribers_;
+    std::mutex subscribers_mutex_;
+
+    std::atomic<uint64_t> next_sequence_{0};
+    std::atomic<SubscriptionId> next_subscription_id_{1};
+};
+
+} // namespace web_api
+} // namespace body_controller
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "web_api/event_bus.h"
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 高频事件时间窗口合并器
+ *
+ * 对车窗/座椅位置等高频事件，在一个时间窗口内只保留每个（主题，实体）的最新值，
+ * 在窗口边界统一刷新；到达终止状态（位置0%或100%）时立即刷新。
+ * 其他主题的事件直接透传，保证SSE带宽和CPU开销与ECU上报频率无关。
+ */
+class EventCoalescer {
+public:
+    using FlushHandler = std::function<void(const std::vector<BusEvent>&)>;
+
+    /**
+     * @brief 合并选项
+     */
+    struct Options {
+        bool enabled = true;                            ///< 是否启用合并
+        std::chrono::milliseconds window{50};           ///< 合并时间窗口
+        std::bitset<EVENT_TOPIC_COUNT> topics;          ///< 参与合并的主题
+
+        Options() {
+            topics.set(static_cast<size_t>(EventTopic::WINDOW_POSITION_CHANGED));
+            topics.set(static_cast<size_t>(EventTopic::SEAT_POSITION_CHANGED));
+        }
+    };
+
+    /**
+     * @brief 构造函数
+     * @param options 合并选项
+     * @param handler 事件输出函数（可能在调用者线程或刷新线程中调用，调用之间互斥）
+     */
+    EventCoalescer(const Options& options, FlushHandler handler);
+
+    /**
+     * @brief 析构函数（会刷新剩余事件）
+     */
+    ~EventCoalescer();
+
+    EventCoalescer(const EventCoalescer&) = delete;
+    EventCoalescer& operator=(const EventCoalescer&) = delete;
+
+    /**
+     * @brief 启动窗口刷新线程
+     */
+    void Start();
+
+    /**
+     * @brief 停止刷新线程并输出所有待发送事件
+     */
+    void Stop();
+
+    /**
+     * @brief 运行期间修改合并窗口
+     * @param window 新窗口（0表示停止合并，事件直接透传）
+     *
+     * 新窗口从下一个窗口边界开始生效；关闭合并时立即输出已合并的事件。
+     */
+    void SetWindow(std::chrono::milliseconds window);
+
+    /**
+     * @brief 提交一批事件
+     * @param events 事件批次
+     */
+    void Submit(const std::vector<BusEvent>& events);
+
+    /**
+     * @brief 判断事件是否为终止状态（需要立即刷新）
+     */
+    static bool IsTerminalState(const BusEvent& event);
+
+    /**
+     * @brief 获取被合并（未发送）的事件数
+     */
+    uint64_t GetCoalescedCount() const { return coalesced_.load(std::memory_order_relaxed); }
+
+private:
+    void FlushLoop();
+
+    /**
+     * @brief 输出所有待发送事件（调用者需持有emit_mutex_）
+     */
+    void FlushPending();
+
+    std::chrono::milliseconds Window() const {
+        return std::chrono::milliseconds(window_ms_.load(std::memory_order_relaxed));
+    }
+
+    Options options_;
+    FlushHandler handler_;
+    std::atomic<bool> enabled_{false};
+    std::atomic<int64_t> window_ms_{0};
+
+    // 每个（主题，实体）一个槽位
+    std::vector<BusEvent> slots_;
+    std::vector<bool> slot_dirty_;
+    std::vector<size_t> dirty_keys_;
+    std::mutex slots_mutex_;
+
+    // 保证同一实体的输出顺序
+    std::mutex emit_mutex_;
+
+    std::thread flush_thread_;
+    std::atomic<bool> running_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+
+    std::atomic<uint64_t> coalesced_{0};
+};
+
+} // namespace web_api
+} // namespace body_controller
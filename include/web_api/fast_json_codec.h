@@ -0,0 +1,110 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+#include "application/data_structures.h"
+#include "web_api/json_converter.h"
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 快速JSON编解码器
+ *
+ * 针对json_converter.h中的小型固定结构，绕过nlohmann::json DOM：
+ * - 编码直接格式化到每线程复用的缓冲区，输出与JsonConverter完全一致（键按字母序）
+ * - 解码使用手写的扁平对象解析器，仅接受整数字段；
+ *   遇到不支持的输入（嵌套、转义、非整数值、缺失字段）时回退到JsonConverter，
+ *   错误信息与原有路径保持一致
+ */
+class FastJsonCodec {
+public:
+    /**
+     * @brief 编码成功响应 {"data":{...},"success":true,"timestamp":N}
+     * @return 指向每线程缓冲区的视图，在同一线程下一次编码前有效
+     */
+    template<typename T>
+    static std::string_view EncodeSuccessResponse(const T& data) {
+        std::string& buffer = BeginSuccessResponse();
+        AppendFields(buffer, data);
+        return EndSuccessResponse(buffer);
+    }
+
+    /**
+     * @brief 编码单个对象（与JsonConverter::ToJson(data).dump()一致）
+     * @return 指向每线程缓冲区的视图，在同一线程下一次编码前有效
+     */
+    template<typename T>
+    static std::string_view Encode(const T& data) {
+        std::string& buffer = BeginObject();
+        AppendFields(buffer, data);
+        return std::string_view(buffer);
+    }
+
+    /**
+     * @brief 解码请求体
+     * @tparam T 请求结构体类型
+     * @param body 请求体文本
+     * @return 解析后的请求（失败时抛出与nlohmann路径相同的异常）
+     */
+    template<typename T>
+    static T DecodeRequest(const std::string& body) {
+        T request;
+        if (TryDecode(body, request)) {
+            return request;
+        }
+        return JsonConverter::FromJson<T>(nlohmann::json::parse(body));
+    }
+
+    // ============================================================================
+    // 快速解码（成功返回true，否则调用者应回退到DOM路径）
+    // ============================================================================
+
+    static bool TryDecode(std::string_view body, application::SetLockStateReq& out);
+    static bool TryDecode(std::string_view body, application::GetLockStateReq& out);
+    static bool TryDecode(std::string_view body, application::SetWindowPositionReq& out);
+    static bool TryDecode(std::string_view body, application::ControlWindowReq& out);
+    static bool TryDecode(std::string_view body, application::GetWindowPositionReq& out);
+    static bool TryDecode(std::string_view body, application::SetHeadlightStateReq& out);
+    static bool TryDecode(std::string_view body, application::SetIndicatorStateReq& out);
+    static bool TryDecode(std::string_view body, application::SetPositionLightStateReq& out);
+    static bool TryDecode(std::string_view body, application::AdjustSeatReq& out);
+    static bool TryDecode(std::string_view body, application::RecallMemoryPositionReq& out);
+    static bool TryDecode(std::string_view body, application::SaveMemoryPositionReq& out);
+
+private:
+    static std::string& BeginSuccessResponse();
+    static std::string_view EndSuccessResponse(std::string& buffer);
+    static std::string& BeginObject();
+
+    // 车门服务
+    static void AppendFields(std::string& buffer, const application::SetLockStateResp& resp);
+    static void AppendFields(std::string& buffer, const application::GetLockStateResp& resp);
+    static void AppendFields(std::string& buffer, const application::OnLockStateChangedData& data);
+    static void AppendFields(std::string& buffer, const application::OnDoorStateChangedData& data);
+
+    // 车窗服务
+    static void AppendFields(std::string& buffer, const application::SetWindowPositionResp& resp);
+    static void AppendFields(std::string& buffer, const SetWindowPositionResult& result);
+    static void AppendFields(std::string& buffer, const application::ControlWindowResp& resp);
+    static void AppendFields(std::string& buffer, const application::GetWindowPositionResp& resp);
+    static void AppendFields(std::string& buffer, const application::OnWindowPositionChangedData& data);
+
+    // 灯光服务
+    static void AppendFields(std::string& buffer, const application::SetHeadlightStateResp& resp);
+    static void AppendFields(std::string& buffer, const application::SetIndicatorStateResp& resp);
+    static void AppendFields(std::string& buffer, const application::SetPositionLightStateResp& resp);
+    static void AppendFields(std::string& buffer, const application::GetLightStateResp& resp);
+    static void AppendFields(std::string& buffer, const application::OnLightStateChangedData& data);
+
+    // 座椅服务
+    static void AppendFields(std::string& buffer, const application::AdjustSeatResp& resp);
+    static void AppendFields(std::string& buffer, const application::RecallMemoryPositionResp& resp);
+    static void AppendFields(std::string& buffer, const application::SaveMemoryPositionResp& resp);
+    static void AppendFields(std::string& buffer, const application::OnSeatPositionChangedData& data);
+    static void AppendFields(std::string& buffer, const application::OnMemorySaveConfirmData& data);
+};
+
+} // namespace web_api
+} // namespace body_controller
@@ -3,6 +3,8 @@
 #include <httplib.h>
 #include <nlohmann/json.hpp>
 #include <memory>
+#include <functional>
+#include <vector>
 #include <thread>
 #include <atomic>
 #include <chrono>
@@ -10,6 +12,11 @@
 #include <mutex>
 #include <string>
 #include "application/data_structures.h"
+#include "web_api/body_codec.h"
+#include "web_api/bounded_thread_pool.h"
+#include "web_api/config_manager.h"
+#include "web_api/rate_limiter.h"
+#include "web_api/static_asset_cache.h"
 
 namespace body_controller {
 namespace web_api {
@@ -17,6 +24,18 @@ namespace web_api {
 // 前向声明
 class ApiHandlers;
 
+/**
+ * @brief 从ApiHandlers成员函数签名推导请求/响应类型
+ */
+template<typename T>
+struct ApiMethodTraits;
+
+template<typename Req, typename Resp>
+struct ApiMethodTraits<void (ApiHandlers::*)(const Req&, std::function<void(const Resp&)>)> {
+    using Request = Req;
+    using Response = Resp;
+};
+
 /**
  * @brief HTTP服务器类
  * 
@@ -30,6 +49,12 @@ public:
      * @param port HTTP服务器端口
      */
     explicit HttpServer(int port = 8080);
+
+    /**
+     * @brief 按配置构造（端口、线程池与连接上限、keep-alive、超时、请求大小、SSE心跳、静态资源缓存）
+     * @param config Web服务器配置
+     */
+    explicit HttpServer(const WebServerConfig& config);
     
     /**
      * @brief 析构函数
@@ -123,75 +148,53 @@ private:
     void SetupRoutes();
     
     // ============================================================================
-    // 车门服务请求处理
-    // ============================================================================
-    
-    /**
-     * @brief 处理车门锁定请求
-     */
-    void HandleDoorLockRequest(const httplib::Request& req, httplib::Response& res);
-    
-    /**
-     * @brief 处理车门状态查询请求
-     */
-    void HandleDoorStatusRequest(const httplib::Request& req, httplib::Response& res);
-    
-    // ============================================================================
-    // 车窗服务请求处理
-    // ============================================================================
-    
-    /**
-     * @brief 处理车窗位置设置请求
-     */
-    void HandleWindowPositionRequest(const httplib::Request& req, httplib::Response& res);
-    
-    /**
-     * @brief 处理车窗控制请求
-     */
-    void HandleWindowControlRequest(const httplib::Request& req, httplib::Response& res);
-    
-    /**
-     * @brief 处理车窗位置查询请求
-     */
-    void HandleWindowPositionStatusRequest(const httplib::Request& req, httplib::Response& res);
-    
-    // ============================================================================
-    // 灯光服务请求处理
+    // 路由表
     // ============================================================================
-    
-    /**
-     * @brief 处理前大灯控制请求
-     */
-    void HandleHeadlightRequest(const httplib::Request& req, httplib::Response& res);
-    
+
     /**
-     * @brief 处理转向灯控制请求
+     * @brief HTTP方法
      */
-    void HandleIndicatorRequest(const httplib::Request& req, httplib::Response& res);
-    
+    enum class HttpMethod {
+        GET,
+        POST
+    };
+
     /**
-     * @brief 处理位置灯控制请求
+     * @brief 单个路由的统计指标
      */
-    void HandlePositionLightRequest(const httplib::Request& req, httplib::Response& res);
-    
-    // ============================================================================
-    // 座椅服务请求处理
-    // ============================================================================
-    
+    struct RouteMetrics {
+        std::string method;                         ///< HTTP方法
+        std::string path;                           ///< 路由模式
+        std::atomic<uint64_t> requests{0};          ///< 请求总数
+        std::atomic<uint64_t> completed{0};         ///< 成功完成数
+        std::atomic<uint64_t> errors{0};            ///< 错误数
+        std::atomic<uint64_t> timeouts{0};          ///< 超时数
+        std::atomic<uint64_t> total_latency_us{0};  ///< 成功请求累计耗时（微秒）
+        std::atomic<uint64_t> max_latency_us{0};    ///< 最大耗时（微秒）
+
+        RouteMetrics(std::string m, std::string p) : method(std::move(m)), path(std::move(p)) {}
+    };
+
     /**
-     * @brief 处理座椅调节请求
+     * @brief 注册服务API路由
+     * @tparam Method ApiHandlers成员函数，请求/响应类型由其签名在编译期推导
+     * @param method HTTP方法
+     * @param path 路由模式
      */
-    void HandleSeatAdjustRequest(const httplib::Request& req, httplib::Response& res);
-    
+    template<auto Method>
+    void RegisterApiRoute(HttpMethod method, const char* path);
+
     /**
-     * @brief 处理座椅记忆位置恢复请求
+     * @brief 通用API请求处理：解析 -> 异步调用 -> 超时等待 -> 序列化 -> 指标统计
      */
-    void HandleSeatMemoryRecallRequest(const httplib::Request& req, httplib::Response& res);
-    
+    template<auto Method>
+    void HandleApiRequest(const httplib::Request& req, httplib::Response& res, RouteMetrics& metrics);
+
     /**
-     * @brief 处理座椅记忆位置保存请求
+     * @brief 从HTTP请求中提取请求结构体（默认解析请求体，状态查询从URL路径提取）
      */
-    void HandleSeatMemorySaveRequest(const httplib::Request& req, httplib::Response& res);
+    template<typename Req>
+    Req ExtractRequest(const httplib::Request& req) const;
     
     // ============================================================================
     // 工具方法
@@ -207,6 +210,24 @@ private:
     void SendErrorResponse(httplib::Response& res, const std::string& error,
                           const std::string& message, int status_code = 400);
 
+    /**
+     * @brief 按Content-Type解析请求体（JSON/MessagePack/CBOR）
+     * @tparam T 请求结构体类型
+     * @param req HTTP请求对象
+     * @return 解析后的请求
+     */
+    template<typename T>
+    T ParseRequestBody(const httplib::Request& req) const;
+
+    /**
+     * @brief 按Accept协商格式发送成功响应
+     * @param req HTTP请求对象
+     * @param res HTTP响应对象
+     * @param data 响应数据
+     */
+    template<typename T>
+    void SendSuccessResponse(const httplib::Request& req, httplib::Response& res, const T& data);
+
     // ============================================================================
     // SSE连接管理
     // ============================================================================
@@ -215,8 +236,10 @@ private:
      * @brief 注册SSE连接
      * @param connection_id 连接ID
      * @param sink 数据流对象
+     * @param format 事件流格式（JSON为标准SSE文本帧）
      */
-    void RegisterSSEConnection(uint64_t connection_id, httplib::DataSink* sink);
+    void RegisterSSEConnection(uint64_t connection_id, httplib::DataSink* sink,
+                               BodyFormat format = BodyFormat::JSON);
 
     /**
      * @brief 注销SSE连接
@@ -225,21 +248,41 @@ private:
     void UnregisterSSEConnection(uint64_t connection_id);
 
     /**
-     * @brief 向所有SSE连接推送事件
-     * @param event_data 事件数据
+     * @brief 向所有SSE连接推送事件（按各连接格式编码）
+     * @param event_type 事件类型
+     * @param envelope 事件信封
+     */
+    void BroadcastSSEEvent(const std::string& event_type, const nlohmann::json& envelope);
+
+    /**
+     * @brief 编码单个事件流帧
+     * @param format 流格式
+     * @param event_type 事件类型（为空时不输出event:字段）
+     * @param envelope 事件信封
+     * @return 编码后的帧
      */
-    void BroadcastSSEEvent(const std::string& event_data);
+    static std::string EncodeStreamFrame(BodyFormat format, const std::string& event_type,
+                                         const nlohmann::json& envelope);
 
 private:
     httplib::Server server_;                    ///< HTTP服务器实例
+    WebServerConfig config_;                    ///< 启动配置（可热加载的参数经ConfigManager::Current()读取）
     int port_;                                  ///< 服务器端口
     std::atomic<bool> running_;                 ///< 运行状态标志
     std::thread server_thread_;                 ///< 服务器线程
     std::shared_ptr<ApiHandlers> api_handlers_; ///< API处理器
     std::chrono::steady_clock::time_point start_time_; ///< 启动时间
+    StaticAssetCache asset_cache_;              ///< Web静态资源缓存
+    std::vector<std::unique_ptr<RouteMetrics>> route_metrics_; ///< 路由指标
+    std::shared_ptr<BoundedThreadPool::Stats> pool_stats_;     ///< 工作线程池统计（线程池由httplib持有）
+    RateLimiter rate_limiter_;                  ///< 按客户端与路由类别限流
 
     // SSE连接管理
-    std::unordered_map<uint64_t, httplib::DataSink*> sse_connections_; ///< SSE连接映射
+    struct SSEConnection {
+        httplib::DataSink* sink;
+        BodyFormat format;
+    };
+    std::unordered_map<uint64_t, SSEConnection> sse_connections_; ///< SSE连接映射
     std::mutex sse_connections_mutex_;          ///< SSE连接互斥锁
 };
 
@@ -8,6 +8,9 @@
 namespace body_controller {
 namespace web_api {
 
+// 定义见api_handlers.h
+struct SetWindowPositionResult;
+
 /**
  * @brief JSON转换器类
  * 
@@ -33,6 +36,7 @@ public:
     
     static nlohmann::json ToJson(const application::SetWindowPositionReq& req);
     static nlohmann::json ToJson(const application::SetWindowPositionResp& resp);
+    static nlohmann::json ToJson(const SetWindowPositionResult& result);
     static nlohmann::json ToJson(const application::ControlWindowReq& req);
     static nlohmann::json ToJson(const application::ControlWindowResp& resp);
     static nlohmann::json ToJson(const application::GetWindowPositionReq& req);
@@ -49,6 +53,8 @@ public:
     static nlohmann::json ToJson(const application::SetIndicatorStateResp& resp);
     static nlohmann::json ToJson(const application::SetPositionLightStateReq& req);
     static nlohmann::json ToJson(const application::SetPositionLightStateResp& resp);
+    static nlohmann::json ToJson(const application::GetLightStateReq& req);
+    static nlohmann::json ToJson(const application::GetLightStateResp& resp);
     static nlohmann::json ToJson(const application::OnLightStateChangedData& data);
     
     // ============================================================================
@@ -63,6 +69,7 @@ public:
     static nlohmann::json ToJson(const application::SaveMemoryPositionResp& resp);
     static nlohmann::json ToJson(const application::OnSeatPositionChangedData& data);
     static nlohmann::json ToJson(const application::OnMemorySaveConfirmData& data);
+    static nlohmann::json ToJson(const application::OnSeatRecallCompleteData& data);
     
     // ============================================================================
     // JSON到C++结构体的转换
@@ -81,6 +88,7 @@ public:
     static application::SetHeadlightStateReq FromJson(const nlohmann::json& j, application::SetHeadlightStateReq*);
     static application::SetIndicatorStateReq FromJson(const nlohmann::json& j, application::SetIndicatorStateReq*);
     static application::SetPositionLightStateReq FromJson(const nlohmann::json& j, application::SetPositionLightStateReq*);
+    static application::GetLightStateReq FromJson(const nlohmann::json& j, application::GetLightStateReq*);
     
     // 座椅服务
     static application::AdjustSeatReq FromJson(const nlohmann::json& j, application::AdjustSeatReq*);
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 限流的路由类别
+ */
+enum class RouteClass : uint8_t {
+    READ    = 0,    ///< 状态查询（GET）
+    COMMAND = 1,    ///< 执行器命令（POST）
+    SSE     = 2     ///< SSE事件流连接
+};
+
+constexpr size_t ROUTE_CLASS_COUNT = 3;
+
+/**
+ * @brief 获取路由类别名称
+ */
+const char* ToString(RouteClass route_class);
+
+/**
+ * @brief 按（客户端地址，路由类别）计数的无锁令牌桶限流器
+ *
+ * 每个桶只有一个原子量：理论到达时间TAT（GCRA形式的令牌桶，容量为一个窗口的请求数，
+ * 按窗口均匀补充），放行即一次CAS，不加锁。桶分布在固定大小的分片表中，
+ * 分片内线性探测；表满时复用已经补满（空闲）的桶，仍无空位则放行并计入untracked。
+ */
+class RateLimiter {
+public:
+    /**
+     * @brief 单个类别的预算
+     */
+    struct Budget {
+        uint32_t requests = 0;          ///< 每个窗口允许的请求数（0表示不限）
+        uint32_t window_ms = 60000;     ///< 窗口长度
+    };
+
+    RateLimiter();
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * @brief 判断请求是否放行并消耗一个令牌
+     * @param client 客户端标识（远端地址）
+     * @param route_class 路由类别
+     * @param budget 该类别的预算（每次传入，支持热加载）
+     * @param retry_after_ms 被拒绝时，下一个令牌可用前的等待时间
+     * @return 放行返回true
+     */
+    bool Allow(const std::string& client, RouteClass route_class, const Budget& budget, uint32_t& retry_after_ms);
+
+    /**
+     * @brief 获取某类别被拒绝的请求数
+     */
+    uint64_t GetRejectedCount(RouteClass route_class) const {
+        return rejected_[static_cast<size_t>(route_class)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 获取因桶表已满而未计数放行的请求数
+     */
+    uint64_t GetUntrackedCount() const { return untracked_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t SHARD_COUNT = 64;
+    static constexpr size_t SLOTS_PER_SHARD = 64;
+
+    struct Slot {
+        std::atomic<uint64_t> key{0};   ///< 键哈希（0表示空）
+        std::atomic<uint64_t> tat{0};   ///< 理论到达时间（相对epoch_的微秒）
+    };
+
+    struct alignas(64) Shard {
+        std::array<Slot, SLOTS_PER_SHARD> slots;
+    };
+
+    /**
+     * @brief 查找或分配键对应的桶
+     * @return 无可用桶时返回nullptr
+     */
+    Slot* Acquire(uint64_t key, uint64_t now_us);
+
+    uint64_t NowMicros() const;
+
+    const std::chrono::steady_clock::time_point epoch_;
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::array<std::atomic<uint64_t>, ROUTE_CLASS_COUNT> rejected_{};
+    std::atomic<uint64_t> untracked_{0};
+};
+
+} // namespace web_api
+} // namespace body_controller
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "communication/callback_manager.h"
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief 相同查询的并发合并（single-flight）
+ *
+ * 同一键（服务+方法+请求payload）在途期间到达的查询不再发出新的SOME/IP调用，
+ * 而是挂到在途调用上，与发起者共享同一结果。无论有多少Web客户端，
+ * 每个键在ECU上最多只有一个未完成的查询。
+ */
+template<typename ResponseType>
+class SingleFlight {
+public:
+    using Completion = std::function<void(communication::CallbackStatus, const ResponseType&)>;
+    using Callback = Completion;
+    using Launcher = std::function<void(Completion)>;
+
+    /**
+     * @brief 执行或加入查询
+     * @param key 查询键
+     * @param callback 结果回调（所有等待者收到相同的状态与结果）
+     * @param launch 实际发起调用的函数，仅当本次为首个请求时调用
+     * @return 本次发起了新调用返回true，加入在途调用返回false
+     */
+    bool Do(const std::string& key, Callback callback, const Launcher& launch) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = flights_.find(key);
+            if (it != flights_.end()) {
+                it->second.push_back(std::move(callback));
+                shared_count_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            flights_[key].push_back(std::move(callback));
+        }
+
+        launch([this, key](communication::CallbackStatus status, const ResponseType& response) {
+            Finish(key, status, response);
+        });
+        return true;
+    }
+
+    /**
+     * @brief 获取在途查询数
+     */
+    size_t GetInFlightCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return flights_.size();
+    }
+
+    /**
+     * @brief 获取被合并（未单独发出）的查询累计数
+     */
+    uint64_t GetSharedCount() const {
+        return shared_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void Finish(const std::string& key, communication::CallbackStatus status, const ResponseType& response) {
+        std::vector<Callback> waiters;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = flights_.find(key);
+            if (it == flights_.end()) {
+                return;
+            }
+            waiters.swap(it->second);
+            flights_.erase(it);
+        }
+
+        if (status != communication::CallbackStatus::COMPLETED) {
+            // 失败的调用不缓存结果，下一个请求会重新发起
+            std::cerr << "[SingleFlight] Query finished with " << communication::ToString(status)
+                      << " for " << waiters.size() << " waiter(s)" << std::endl;
+        }
+
+        for (const auto& waiter : waiters) {
+            if (!waiter) {
+                continue;
+            }
+            try {
+                waiter(status, response);
+            } catch (const std::exception& e) {
+                std::cerr << "[SingleFlight] Waiter callback error: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::vector<Callback>> flights_;
+    std::atomic<uint64_t> shared_count_{0};
+};
+
+} // namespace web_api
+} // namespace body_controller
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <httplib.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace body_controller {
+namespace web_api {
+
+/**
+ * @brief Web静态资源缓存
+ *
+ * 启动时将web/目录整体加载到内存，预先计算gzip/brotli压缩版本和强ETag，
+ * 运行期间不再访问磁盘：
+ * - If-None-Match命中时返回304 Not Modified
+ * - 文件名带内容哈希（如app.3f2a9c1b.js）或带?v=版本参数的请求使用
+ *   Cache-Control: immutable，其余资源要求浏览器按ETag重新验证
+ */
+class StaticAssetCache {
+public:
+    /**
+     * @brief 静态资源条目
+     */
+    struct Asset {
+        std::string content_type;   ///< MIME类型
+        std::string identity;       ///< 原始内容
+        std::string gzip;           ///< gzip压缩内容（为空表示不可用或无收益）
+        std::string brotli;         ///< brotli压缩内容（为空表示不可用或无收益）
+        std::string etag;           ///< 原始内容的强ETag（压缩版本追加后缀）
+        bool versioned = false;     ///< 文件名是否带内容哈希
+    };
+
+    /**
+     * @brief 设置浏览器缓存时间
+     * @param max_age_s 未带版本资源的max-age（0表示no-cache，每次按ETag重新验证）
+     * @param versioned_max_age_s 带版本资源的max-age
+     */
+    void SetCachePolicy(uint32_t max_age_s, uint32_t versioned_max_age_s);
+
+    /**
+     * @brief 加载目录下所有文件
+     * @param root_dir 静态资源根目录
+     * @return 成功返回true，目录不存在返回false
+     */
+    bool Load(const std::string& root_dir);
+
+    /**
+     * @brief 处理静态资源请求
+     * @param req HTTP请求对象
+     * @param res HTTP响应对象
+     * @return 命中缓存返回true，否则返回false（由调用者返回404）
+     */
+    bool Serve(const httplib::Request& req, httplib::Response& res) const;
+
+    /**
+     * @brief 获取缓存条目数
+     */
+    size_t GetAssetCount() const { return assets_.size(); }
+
+    /**
+     * @brief 获取缓存占用的总字节数（含压缩版本）
+     */
+    size_t GetTotalBytes() const { return total_bytes_; }
+
+private:
+    static std::string GetContentType(const std::string& path);
+    static bool IsCompressible(const std::string& content_type);
+    static bool IsVersionedName(const std::string& filename);
+    static std::string ComputeETag(const std::string& content);
+    static std::string CompressGzip(const std::string& content);
+    static std::string CompressBrotli(const std::string& content);
+
+    std::unordered_map<std::string, Asset> assets_;    ///< URL路径 -> 资源
+    size_t total_bytes_ = 0;
+    std::string cache_control_ = "no-cache";                                        ///< 未带版本资源
+    std::string cache_control_versioned_ = "public, max-age=31536000, immutable";  ///< 带版本资源
+};
+
+} // namespace web_api
+} // namespace body_controller
@@ -0,0 +1,109 @@
+#include "communication/circuit_breaker.h"
+#include <iostream>
+
+namespace body_controller {
+namespace communication {
+
+CircuitBreaker::CircuitBreaker(const Options& options)
+    : options_(options) {
+}
+
+void CircuitBreaker::SetOptions(const Options& options) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    options_ = options;
+}
+
+bool CircuitBreaker::AllowRequest(uint64_t* probe_token) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (probe_token) {
+        *probe_token = 0;
+    }
+    if (options_.failure_threshold == 0) {
+        return true;
+    }
+
+    switch (state_) {
+        case State::CLOSED:
+            return true;
+
+        case State::OPEN:
+            if (Clock::now() - opened_at_ < std::chrono::milliseconds(options_.open_duration_ms)) {
+                break;
+            }
+            // 熔断期结束，放行一个探测请求
+            state_ = State::HALF_OPEN;
+            probe_in_flight_ = true;
+            probe_token_ = next_probe_token_++;
+            if (probe_token) {
+                *probe_token = probe_token_;
+            }
+            std::cout << "[CircuitBreaker] HALF_OPEN, sending probe request" << std::endl;
+            return true;
+
+        case State::HALF_OPEN:
+            if (!probe_in_flight_) {
+                probe_in_flight_ = true;
+                probe_token_ = next_probe_token_++;
+                if (probe_token) {
+                    *probe_token = probe_token_;
+                }
+                return true;
+            }
+            break;
+    }
+
+    rejected_count_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void CircuitBreaker::RecordSuccess() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ != State::CLOSED) {
+        std::cout << "[CircuitBreaker] CLOSED, service recovered" << std::endl;
+    }
+    state_ = State::CLOSED;
+    consecutive_failures_ = 0;
+    probe_in_flight_ = false;
+}
+
+void CircuitBreaker::RecordFailure() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    probe_in_flight_ = false;
+    ++consecutive_failures_;
+
+    if (options_.failure_threshold == 0) {
+        return;
+    }
+    if (state_ == State::HALF_OPEN ||
+        (state_ == State::CLOSED && consecutive_failures_ >= options_.failure_threshold)) {
+        state_ = State::OPEN;
+        opened_at_ = Clock::now();
+        std::cerr << "[CircuitBreaker] OPEN after " << consecutive_failures_
+                  << " consecutive failure(s), failing fast for " << options_.open_duration_ms << "ms" << std::endl;
+    }
+}
+
+void CircuitBreaker::ReleaseProbe(uint64_t probe_token) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 熔断前发出、此时才结束的普通请求不持有名额，不能放走正在进行的探测
+    if (state_ == State::HALF_OPEN && probe_in_flight_ && probe_token != 0 && probe_token == probe_token_) {
+        probe_in_flight_ = false;
+    }
+}
+
+CircuitBreaker::State CircuitBreaker::GetState() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return state_;
+}
+
+const char* ToString(CircuitBreaker::State state) {
+    switch (state) {
+        case CircuitBreaker::State::CLOSED:    return "CLOSED";
+        case CircuitBreaker::State::OPEN:      return "OPEN";
+        case CircuitBreaker::State::HALF_OPEN: return "HALF_OPEN";
+    }
+    return "UNKNOWN";
+}
+
+} // namespace communication
+} // namespace body_controller
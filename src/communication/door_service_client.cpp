@@ -45,9 +45,11 @@ bool DoorServiceClient::Initialize() {
 }
 
 void DoorServiceClient::SetLockState(const application::SetLockStateReq& request) {
-    std::cout << "[DoorServiceClient] Setting lock state for door: " 
-              << static_cast<int>(request.doorID) 
-              << " Command: " << static_cast<int>(request.command) << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[DoorServiceClient] Setting lock state for door: " 
+                  << static_cast<int>(request.doorID) 
+                  << " Command: " << static_cast<int>(request.command) << std::endl;
+    }
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -56,9 +58,18 @@ void DoorServiceClient::SetLockState(const application::SetLockStateReq& request
     SendRequest(body_controller::communication::DOOR_SERVICE_ID, body_controller::communication::DOOR_INSTANCE_ID, door_service::SET_LOCK_STATE, payload_data);
 }
 
+bool DoorServiceClient::SetLockState(const application::SetLockStateReq& request,
+                                     ResponseCallback<application::SetLockStateResp> callback,
+                                     uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::DOOR_SERVICE_ID, body_controller::communication::DOOR_INSTANCE_ID, door_service::SET_LOCK_STATE,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void DoorServiceClient::GetLockState(const application::GetLockStateReq& request) {
-    std::cout << "[DoorServiceClient] Getting lock state for door: " 
-              << static_cast<int>(request.doorID) << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[DoorServiceClient] Getting lock state for door: " 
+                  << static_cast<int>(request.doorID) << std::endl;
+    }
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -67,19 +78,50 @@ void DoorServiceClient::GetLockState(const application::GetLockStateReq& request
     SendRequest(body_controller::communication::DOOR_SERVICE_ID, body_controller::communication::DOOR_INSTANCE_ID, door_service::GET_LOCK_STATE, payload_data);
 }
 
+bool DoorServiceClient::GetLockState(const application::GetLockStateReq& request,
+                                     ResponseCallback<application::GetLockStateResp> callback,
+                                     uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::DOOR_SERVICE_ID, body_controller::communication::DOOR_INSTANCE_ID, door_service::GET_LOCK_STATE,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
+bool DoorServiceClient::GetCachedLockState(application::Position door_id, application::LockState& state) const {
+    uint8_t value = 0;
+    if (!lock_state_mirror_.Get(static_cast<size_t>(door_id), value)) {
+        return false;
+    }
+    state = static_cast<application::LockState>(value);
+    return true;
+}
+
+bool DoorServiceClient::GetCachedDoorState(application::Position door_id, application::DoorState& state) const {
+    uint8_t value = 0;
+    if (!door_state_mirror_.Get(static_cast<size_t>(door_id), value)) {
+        return false;
+    }
+    state = static_cast<application::DoorState>(value);
+    return true;
+}
+
 void DoorServiceClient::OnAvailability(vsomeip::service_t service, vsomeip::instance_t instance, bool is_available) {
     SomeipClient::OnAvailability(service, instance, is_available);
     
     if (service == body_controller::communication::DOOR_SERVICE_ID && instance == body_controller::communication::DOOR_INSTANCE_ID && is_available) {
         std::cout << "[DoorServiceClient] Door service is available, subscribing to events..." << std::endl;
         
-        // 订阅锁定状态变化事件
+        // 订阅锁定状态字段（订阅后立即收到各车门的当前值）
         SubscribeEvent(body_controller::communication::DOOR_SERVICE_ID, body_controller::communication::DOOR_INSTANCE_ID,
-                      door_events::ON_LOCK_STATE_CHANGED, body_controller::communication::DOOR_EVENTS_GROUP_ID);
+                      door_events::ON_LOCK_STATE_CHANGED, body_controller::communication::DOOR_EVENTS_GROUP_ID,
+                      vsomeip::event_type_e::ET_FIELD);
 
-        // 订阅车门状态变化事件
+        // 订阅车门状态字段
         SubscribeEvent(body_controller::communication::DOOR_SERVICE_ID, body_controller::communication::DOOR_INSTANCE_ID,
-                      door_events::ON_DOOR_STATE_CHANGED, body_controller::communication::DOOR_EVENTS_GROUP_ID);
+                      door_events::ON_DOOR_STATE_CHANGED, body_controller::communication::DOOR_EVENTS_GROUP_ID,
+                      vsomeip::event_type_e::ET_FIELD);
+    } else if (service == body_controller::communication::DOOR_SERVICE_ID && instance == body_controller::communication::DOOR_INSTANCE_ID) {
+        // 服务下线后镜像不再更新，回退到getter直到重新订阅
+        lock_state_mirror_.Invalidate();
+        door_state_mirror_.Invalidate();
     }
 }
 
@@ -96,6 +138,12 @@ void DoorServiceClient::OnMessage(const std::shared_ptr<vsomeip::message>& messa
     auto message_type = message->get_message_type();
     auto method_id = message->get_method();
     
+    // 已登记的挂起请求优先（含MT_ERROR），其余响应交给全局响应处理器
+    if ((message_type == vsomeip::message_type_e::MT_RESPONSE ||
+         message_type == vsomeip::message_type_e::MT_ERROR) && ResolvePendingRequest(message)) {
+        return;
+    }
+
     if (message_type == vsomeip::message_type_e::MT_RESPONSE) {
         // 处理方法响应
         if (method_id == door_service::SET_LOCK_STATE) {
@@ -125,9 +173,11 @@ void DoorServiceClient::HandleSetLockStateResponse(const std::shared_ptr<vsomeip
     application::SetLockStateResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[DoorServiceClient] SetLockState response - Door: " 
-                  << static_cast<int>(response.doorID)
-                  << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[DoorServiceClient] SetLockState response - Door: " 
+                      << static_cast<int>(response.doorID)
+                      << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
         
         // 调用用户回调
         if (set_lock_response_handler_) {
@@ -150,9 +200,11 @@ void DoorServiceClient::HandleGetLockStateResponse(const std::shared_ptr<vsomeip
     application::GetLockStateResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[DoorServiceClient] GetLockState response - Door: " 
-                  << static_cast<int>(response.doorID)
-                  << " State: " << (response.lockState == application::LockState::LOCKED ? "LOCKED" : "UNLOCKED") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[DoorServiceClient] GetLockState response - Door: " 
+                      << static_cast<int>(response.doorID)
+                      << " State: " << (response.lockState == application::LockState::LOCKED ? "LOCKED" : "UNLOCKED") << std::endl;
+        }
         
         // 调用用户回调
         if (get_lock_response_handler_) {
@@ -175,9 +227,13 @@ void DoorServiceClient::HandleLockStateChangedEvent(const std::shared_ptr<vsomei
     application::OnLockStateChangedData event_data;
     
     if (Serializer::Deserialize(payload_data, event_data)) {
-        std::cout << "[DoorServiceClient] LockStateChanged event - Door: " 
-                  << static_cast<int>(event_data.doorID)
-                  << " New State: " << (event_data.newLockState == application::LockState::LOCKED ? "LOCKED" : "UNLOCKED") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[DoorServiceClient] LockStateChanged event - Door: " 
+                      << static_cast<int>(event_data.doorID)
+                      << " New State: " << (event_data.newLockState == application::LockState::LOCKED ? "LOCKED" : "UNLOCKED") << std::endl;
+        }
+        
+        lock_state_mirror_.Update(static_cast<size_t>(event_data.doorID), static_cast<uint8_t>(event_data.newLockState));
         
         // 调用用户回调
         if (lock_state_changed_handler_) {
@@ -200,9 +256,13 @@ void DoorServiceClient::HandleDoorStateChangedEvent(const std::shared_ptr<vsomei
     application::OnDoorStateChangedData event_data;
     
     if (Serializer::Deserialize(payload_data, event_data)) {
-        std::cout << "[DoorServiceClient] DoorStateChanged event - Door: " 
-                  << static_cast<int>(event_data.doorID)
-                  << " New State: " << (event_data.newDoorState == application::DoorState::CLOSED ? "CLOSED" : "OPEN") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[DoorServiceClient] DoorStateChanged event - Door: " 
+                      << static_cast<int>(event_data.doorID)
+                      << " New State: " << (event_data.newDoorState == application::DoorState::CLOSED ? "CLOSED" : "OPEN") << std::endl;
+        }
+        
+        door_state_mirror_.Update(static_cast<size_t>(event_data.doorID), static_cast<uint8_t>(event_data.newDoorState));
         
         // 调用用户回调
         if (door_state_changed_handler_) {
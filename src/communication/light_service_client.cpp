@@ -45,22 +45,24 @@ bool LightServiceClient::Initialize() {
 }
 
 void LightServiceClient::SetHeadlightState(const application::SetHeadlightStateReq& request) {
-    std::cout << "[LightServiceClient] Setting headlight state: ";
-    switch (request.command) {
-        case application::HeadlightState::OFF:
-            std::cout << "OFF";
-            break;
-        case application::HeadlightState::LOW_BEAM:
-            std::cout << "LOW_BEAM";
-            break;
-        case application::HeadlightState::HIGH_BEAM:
-            std::cout << "HIGH_BEAM";
-            break;
-        default:
-            std::cout << "UNKNOWN(" << static_cast<int>(request.command) << ")";
-            break;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[LightServiceClient] Setting headlight state: ";
+        switch (request.command) {
+            case application::HeadlightState::OFF:
+                std::cout << "OFF";
+                break;
+            case application::HeadlightState::LOW_BEAM:
+                std::cout << "LOW_BEAM";
+                break;
+            case application::HeadlightState::HIGH_BEAM:
+                std::cout << "HIGH_BEAM";
+                break;
+            default:
+                std::cout << "UNKNOWN(" << static_cast<int>(request.command) << ")";
+                break;
+        }
+        std::cout << std::endl;
     }
-    std::cout << std::endl;
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -69,26 +71,35 @@ void LightServiceClient::SetHeadlightState(const application::SetHeadlightStateR
     SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::SET_HEADLIGHT_STATE, payload_data);
 }
 
+bool LightServiceClient::SetHeadlightState(const application::SetHeadlightStateReq& request,
+                                           ResponseCallback<application::SetHeadlightStateResp> callback,
+                                           uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::SET_HEADLIGHT_STATE,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void LightServiceClient::SetIndicatorState(const application::SetIndicatorStateReq& request) {
-    std::cout << "[LightServiceClient] Setting indicator state: ";
-    switch (request.command) {
-        case application::IndicatorState::OFF:
-            std::cout << "OFF";
-            break;
-        case application::IndicatorState::LEFT:
-            std::cout << "LEFT";
-            break;
-        case application::IndicatorState::RIGHT:
-            std::cout << "RIGHT";
-            break;
-        case application::IndicatorState::HAZARD:
-            std::cout << "HAZARD";
-            break;
-        default:
-            std::cout << "UNKNOWN(" << static_cast<int>(request.command) << ")";
-            break;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[LightServiceClient] Setting indicator state: ";
+        switch (request.command) {
+            case application::IndicatorState::OFF:
+                std::cout << "OFF";
+                break;
+            case application::IndicatorState::LEFT:
+                std::cout << "LEFT";
+                break;
+            case application::IndicatorState::RIGHT:
+                std::cout << "RIGHT";
+                break;
+            case application::IndicatorState::HAZARD:
+                std::cout << "HAZARD";
+                break;
+            default:
+                std::cout << "UNKNOWN(" << static_cast<int>(request.command) << ")";
+                break;
+        }
+        std::cout << std::endl;
     }
-    std::cout << std::endl;
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -97,9 +108,18 @@ void LightServiceClient::SetIndicatorState(const application::SetIndicatorStateR
     SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::SET_INDICATOR_STATE, payload_data);
 }
 
+bool LightServiceClient::SetIndicatorState(const application::SetIndicatorStateReq& request,
+                                           ResponseCallback<application::SetIndicatorStateResp> callback,
+                                           uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::SET_INDICATOR_STATE,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void LightServiceClient::SetPositionLightState(const application::SetPositionLightStateReq& request) {
-    std::cout << "[LightServiceClient] Setting position light state: " 
-              << (request.command == application::PositionLightState::ON ? "ON" : "OFF") << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[LightServiceClient] Setting position light state: " 
+                  << (request.command == application::PositionLightState::ON ? "ON" : "OFF") << std::endl;
+    }
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -108,15 +128,46 @@ void LightServiceClient::SetPositionLightState(const application::SetPositionLig
     SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::SET_POSITION_LIGHT_STATE, payload_data);
 }
 
+bool LightServiceClient::SetPositionLightState(const application::SetPositionLightStateReq& request,
+                                               ResponseCallback<application::SetPositionLightStateResp> callback,
+                                               uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::SET_POSITION_LIGHT_STATE,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
+void LightServiceClient::GetLightState(const application::GetLightStateReq& request) {
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[LightServiceClient] Getting light state for type: "
+                  << static_cast<int>(request.lightType) << std::endl;
+    }
+    
+    // 序列化请求数据
+    auto payload_data = Serializer::Serialize(request);
+    
+    // 发送请求
+    SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::GET_LIGHT_STATE, payload_data);
+}
+
+bool LightServiceClient::GetLightState(const application::GetLightStateReq& request,
+                                       ResponseCallback<application::GetLightStateResp> callback,
+                                       uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID, light_service::GET_LIGHT_STATE,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void LightServiceClient::OnAvailability(vsomeip::service_t service, vsomeip::instance_t instance, bool is_available) {
     SomeipClient::OnAvailability(service, instance, is_available);
     
     if (service == body_controller::communication::LIGHT_SERVICE_ID && instance == body_controller::communication::LIGHT_INSTANCE_ID && is_available) {
         std::cout << "[LightServiceClient] Light service is available, subscribing to events..." << std::endl;
 
-        // 订阅灯光状态变化事件
+        // 订阅灯光状态字段（订阅后立即收到各灯光类型的当前值）
         SubscribeEvent(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::LIGHT_INSTANCE_ID,
-                      light_events::ON_LIGHT_STATE_CHANGED, body_controller::communication::LIGHT_EVENTS_GROUP_ID);
+                      light_events::ON_LIGHT_STATE_CHANGED, body_controller::communication::LIGHT_EVENTS_GROUP_ID,
+                      vsomeip::event_type_e::ET_FIELD);
+    } else if (service == body_controller::communication::LIGHT_SERVICE_ID && instance == body_controller::communication::LIGHT_INSTANCE_ID) {
+        // 服务下线后镜像不再更新，回退到getter直到重新订阅
+        light_state_mirror_.Invalidate();
     }
 }
 
@@ -133,6 +184,12 @@ void LightServiceClient::OnMessage(const std::shared_ptr<vsomeip::message>& mess
     auto message_type = message->get_message_type();
     auto method_id = message->get_method();
     
+    // 已登记的挂起请求优先（含MT_ERROR），其余响应交给全局响应处理器
+    if ((message_type == vsomeip::message_type_e::MT_RESPONSE ||
+         message_type == vsomeip::message_type_e::MT_ERROR) && ResolvePendingRequest(message)) {
+        return;
+    }
+
     if (message_type == vsomeip::message_type_e::MT_RESPONSE) {
         // 处理方法响应
         if (method_id == light_service::SET_HEADLIGHT_STATE) {
@@ -141,6 +198,8 @@ void LightServiceClient::OnMessage(const std::shared_ptr<vsomeip::message>& mess
             HandleSetIndicatorStateResponse(message);
         } else if (method_id == light_service::SET_POSITION_LIGHT_STATE) {
             HandleSetPositionLightStateResponse(message);
+        } else if (method_id == light_service::GET_LIGHT_STATE) {
+            HandleGetLightStateResponse(message);
         }
     } else if (message_type == vsomeip::message_type_e::MT_NOTIFICATION) {
         // 处理事件通知
@@ -162,22 +221,24 @@ void LightServiceClient::HandleSetHeadlightStateResponse(const std::shared_ptr<v
     application::SetHeadlightStateResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[LightServiceClient] SetHeadlightState response - New State: ";
-        switch (response.newState) {
-            case application::HeadlightState::OFF:
-                std::cout << "OFF";
-                break;
-            case application::HeadlightState::LOW_BEAM:
-                std::cout << "LOW_BEAM";
-                break;
-            case application::HeadlightState::HIGH_BEAM:
-                std::cout << "HIGH_BEAM";
-                break;
-            default:
-                std::cout << "UNKNOWN(" << static_cast<int>(response.newState) << ")";
-                break;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[LightServiceClient] SetHeadlightState response - New State: ";
+            switch (response.newState) {
+                case application::HeadlightState::OFF:
+                    std::cout << "OFF";
+                    break;
+                case application::HeadlightState::LOW_BEAM:
+                    std::cout << "LOW_BEAM";
+                    break;
+                case application::HeadlightState::HIGH_BEAM:
+                    std::cout << "HIGH_BEAM";
+                    break;
+                default:
+                    std::cout << "UNKNOWN(" << static_cast<int>(response.newState) << ")";
+                    break;
+            }
+            std::cout << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
         }
-        std::cout << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
         
         // 调用用户回调
         if (set_headlight_response_handler_) {
@@ -200,25 +261,27 @@ void LightServiceClient::HandleSetIndicatorStateResponse(const std::shared_ptr<v
     application::SetIndicatorStateResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[LightServiceClient] SetIndicatorState response - New State: ";
-        switch (response.newState) {
-            case application::IndicatorState::OFF:
-                std::cout << "OFF";
-                break;
-            case application::IndicatorState::LEFT:
-                std::cout << "LEFT";
-                break;
-            case application::IndicatorState::RIGHT:
-                std::cout << "RIGHT";
-                break;
-            case application::IndicatorState::HAZARD:
-                std::cout << "HAZARD";
-                break;
-            default:
-                std::cout << "UNKNOWN(" << static_cast<int>(response.newState) << ")";
-                break;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[LightServiceClient] SetIndicatorState response - New State: ";
+            switch (response.newState) {
+                case application::IndicatorState::OFF:
+                    std::cout << "OFF";
+                    break;
+                case application::IndicatorState::LEFT:
+                    std::cout << "LEFT";
+                    break;
+                case application::IndicatorState::RIGHT:
+                    std::cout << "RIGHT";
+                    break;
+                case application::IndicatorState::HAZARD:
+                    std::cout << "HAZARD";
+                    break;
+                default:
+                    std::cout << "UNKNOWN(" << static_cast<int>(response.newState) << ")";
+                    break;
+            }
+            std::cout << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
         }
-        std::cout << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
         
         // 调用用户回调
         if (set_indicator_response_handler_) {
@@ -241,9 +304,11 @@ void LightServiceClient::HandleSetPositionLightStateResponse(const std::shared_p
     application::SetPositionLightStateResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[LightServiceClient] SetPositionLightState response - New State: " 
-                  << (response.newState == application::PositionLightState::ON ? "ON" : "OFF")
-                  << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[LightServiceClient] SetPositionLightState response - New State: " 
+                      << (response.newState == application::PositionLightState::ON ? "ON" : "OFF")
+                      << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
         
         // 调用用户回调
         if (set_position_light_response_handler_) {
@@ -254,6 +319,33 @@ void LightServiceClient::HandleSetPositionLightStateResponse(const std::shared_p
     }
 }
 
+void LightServiceClient::HandleGetLightStateResponse(const std::shared_ptr<vsomeip::message>& message) {
+    auto payload = message->get_payload();
+    if (!payload) {
+        std::cerr << "[LightServiceClient] GetLightState response has no payload" << std::endl;
+        return;
+    }
+    
+    // 反序列化响应数据
+    std::vector<uint8_t> payload_data(payload->get_data(), payload->get_data() + payload->get_length());
+    application::GetLightStateResp response;
+    
+    if (Serializer::Deserialize(payload_data, response)) {
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[LightServiceClient] GetLightState response - Light Type: "
+                      << static_cast<int>(response.lightType)
+                      << " State: " << static_cast<int>(response.state) << std::endl;
+        }
+        
+        // 调用用户回调
+        if (get_light_state_response_handler_) {
+            get_light_state_response_handler_(response);
+        }
+    } else {
+        std::cerr << "[LightServiceClient] Failed to deserialize GetLightState response" << std::endl;
+    }
+}
+
 void LightServiceClient::HandleLightStateChangedEvent(const std::shared_ptr<vsomeip::message>& message) {
     auto payload = message->get_payload();
     if (!payload) {
@@ -266,22 +358,26 @@ void LightServiceClient::HandleLightStateChangedEvent(const std::shared_ptr<vsom
     application::OnLightStateChangedData event_data;
     
     if (Serializer::Deserialize(payload_data, event_data)) {
-        std::cout << "[LightServiceClient] LightStateChanged event - Light Type: ";
-        switch (event_data.lightType) {
-            case application::LightType::HEADLIGHT:
-                std::cout << "HEADLIGHT";
-                break;
-            case application::LightType::INDICATOR:
-                std::cout << "INDICATOR";
-                break;
-            case application::LightType::POSITION_LIGHT:
-                std::cout << "POSITION_LIGHT";
-                break;
-            default:
-                std::cout << "UNKNOWN(" << static_cast<int>(event_data.lightType) << ")";
-                break;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[LightServiceClient] LightStateChanged event - Light Type: ";
+            switch (event_data.lightType) {
+                case application::LightType::HEADLIGHT:
+                    std::cout << "HEADLIGHT";
+                    break;
+                case application::LightType::INDICATOR:
+                    std::cout << "INDICATOR";
+                    break;
+                case application::LightType::POSITION_LIGHT:
+                    std::cout << "POSITION_LIGHT";
+                    break;
+                default:
+                    std::cout << "UNKNOWN(" << static_cast<int>(event_data.lightType) << ")";
+                    break;
+            }
+            std::cout << " New State: " << static_cast<int>(event_data.newState) << std::endl;
         }
-        std::cout << " New State: " << static_cast<int>(event_data.newState) << std::endl;
+        
+        light_state_mirror_.Update(static_cast<size_t>(event_data.lightType), event_data.newState);
         
         // 调用用户回调
         if (light_state_changed_handler_) {
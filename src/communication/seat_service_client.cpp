@@ -45,35 +45,37 @@ bool SeatServiceClient::Initialize() {
 }
 
 void SeatServiceClient::AdjustSeat(const application::AdjustSeatReq& request) {
-    std::cout << "[SeatServiceClient] Adjusting seat - Axis: ";
-    switch (request.axis) {
-        case application::SeatAxis::FORWARD_BACKWARD:
-            std::cout << "FORWARD_BACKWARD";
-            break;
-        case application::SeatAxis::RECLINE:
-            std::cout << "RECLINE";
-            break;
-        default:
-            std::cout << "UNKNOWN(" << static_cast<int>(request.axis) << ")";
-            break;
-    }
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[SeatServiceClient] Adjusting seat - Axis: ";
+        switch (request.axis) {
+            case application::SeatAxis::FORWARD_BACKWARD:
+                std::cout << "FORWARD_BACKWARD";
+                break;
+            case application::SeatAxis::RECLINE:
+                std::cout << "RECLINE";
+                break;
+            default:
+                std::cout << "UNKNOWN(" << static_cast<int>(request.axis) << ")";
+                break;
+        }
     
-    std::cout << " Direction: ";
-    switch (request.direction) {
-        case application::SeatDirection::POSITIVE:
-            std::cout << "POSITIVE";
-            break;
-        case application::SeatDirection::NEGATIVE:
-            std::cout << "NEGATIVE";
-            break;
-        case application::SeatDirection::STOP:
-            std::cout << "STOP";
-            break;
-        default:
-            std::cout << "UNKNOWN(" << static_cast<int>(request.direction) << ")";
-            break;
+        std::cout << " Direction: ";
+        switch (request.direction) {
+            case application::SeatDirection::POSITIVE:
+                std::cout << "POSITIVE";
+                break;
+            case application::SeatDirection::NEGATIVE:
+                std::cout << "NEGATIVE";
+                break;
+            case application::SeatDirection::STOP:
+                std::cout << "STOP";
+                break;
+            default:
+                std::cout << "UNKNOWN(" << static_cast<int>(request.direction) << ")";
+                break;
+        }
+        std::cout << std::endl;
     }
-    std::cout << std::endl;
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -82,9 +84,18 @@ void SeatServiceClient::AdjustSeat(const application::AdjustSeatReq& request) {
     SendRequest(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID, seat_service::ADJUST_SEAT, payload_data);
 }
 
+bool SeatServiceClient::AdjustSeat(const application::AdjustSeatReq& request,
+                                   ResponseCallback<application::AdjustSeatResp> callback,
+                                   uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID, seat_service::ADJUST_SEAT,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void SeatServiceClient::RecallMemoryPosition(const application::RecallMemoryPositionReq& request) {
-    std::cout << "[SeatServiceClient] Recalling memory position: " 
-              << static_cast<int>(request.presetID) << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[SeatServiceClient] Recalling memory position: " 
+                  << static_cast<int>(request.presetID) << std::endl;
+    }
     
     // 验证记忆位置ID范围
     if (request.presetID < 1 || request.presetID > 3) {
@@ -100,9 +111,18 @@ void SeatServiceClient::RecallMemoryPosition(const application::RecallMemoryPosi
     SendRequest(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID, seat_service::RECALL_MEMORY_POSITION, payload_data);
 }
 
+bool SeatServiceClient::RecallMemoryPosition(const application::RecallMemoryPositionReq& request,
+                                             ResponseCallback<application::RecallMemoryPositionResp> callback,
+                                             uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID, seat_service::RECALL_MEMORY_POSITION,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void SeatServiceClient::SaveMemoryPosition(const application::SaveMemoryPositionReq& request) {
-    std::cout << "[SeatServiceClient] Saving current position to memory slot: " 
-              << static_cast<int>(request.presetID) << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[SeatServiceClient] Saving current position to memory slot: " 
+                  << static_cast<int>(request.presetID) << std::endl;
+    }
     
     // 验证记忆位置ID范围
     if (request.presetID < 1 || request.presetID > 3) {
@@ -118,6 +138,13 @@ void SeatServiceClient::SaveMemoryPosition(const application::SaveMemoryPosition
     SendRequest(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID, seat_service::SAVE_MEMORY_POSITION, payload_data);
 }
 
+bool SeatServiceClient::SaveMemoryPosition(const application::SaveMemoryPositionReq& request,
+                                           ResponseCallback<application::SaveMemoryPositionResp> callback,
+                                           uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID, seat_service::SAVE_MEMORY_POSITION,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void SeatServiceClient::OnAvailability(vsomeip::service_t service, vsomeip::instance_t instance, bool is_available) {
     SomeipClient::OnAvailability(service, instance, is_available);
     
@@ -131,6 +158,10 @@ void SeatServiceClient::OnAvailability(vsomeip::service_t service, vsomeip::inst
         // 订阅记忆保存确认事件
         SubscribeEvent(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID,
                       seat_events::ON_MEMORY_SAVE_CONFIRM, body_controller::communication::SEAT_EVENTS_GROUP_ID);
+
+        // 订阅记忆位置恢复完成事件
+        SubscribeEvent(body_controller::communication::SEAT_SERVICE_ID, body_controller::communication::SEAT_INSTANCE_ID,
+                      seat_events::ON_RECALL_COMPLETE, body_controller::communication::SEAT_EVENTS_GROUP_ID);
     }
 }
 
@@ -147,6 +178,12 @@ void SeatServiceClient::OnMessage(const std::shared_ptr<vsomeip::message>& messa
     auto message_type = message->get_message_type();
     auto method_id = message->get_method();
     
+    // 已登记的挂起请求优先（含MT_ERROR），其余响应交给全局响应处理器
+    if ((message_type == vsomeip::message_type_e::MT_RESPONSE ||
+         message_type == vsomeip::message_type_e::MT_ERROR) && ResolvePendingRequest(message)) {
+        return;
+    }
+
     if (message_type == vsomeip::message_type_e::MT_RESPONSE) {
         // 处理方法响应
         if (method_id == seat_service::ADJUST_SEAT) {
@@ -162,6 +199,8 @@ void SeatServiceClient::OnMessage(const std::shared_ptr<vsomeip::message>& messa
             HandleSeatPositionChangedEvent(message);
         } else if (method_id == seat_events::ON_MEMORY_SAVE_CONFIRM) {
             HandleMemorySaveConfirmEvent(message);
+        } else if (method_id == seat_events::ON_RECALL_COMPLETE) {
+            HandleRecallCompleteEvent(message);
         }
     }
 }
@@ -178,19 +217,21 @@ void SeatServiceClient::HandleAdjustSeatResponse(const std::shared_ptr<vsomeip::
     application::AdjustSeatResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[SeatServiceClient] AdjustSeat response - Axis: ";
-        switch (response.axis) {
-            case application::SeatAxis::FORWARD_BACKWARD:
-                std::cout << "FORWARD_BACKWARD";
-                break;
-            case application::SeatAxis::RECLINE:
-                std::cout << "RECLINE";
-                break;
-            default:
-                std::cout << "UNKNOWN(" << static_cast<int>(response.axis) << ")";
-                break;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[SeatServiceClient] AdjustSeat response - Axis: ";
+            switch (response.axis) {
+                case application::SeatAxis::FORWARD_BACKWARD:
+                    std::cout << "FORWARD_BACKWARD";
+                    break;
+                case application::SeatAxis::RECLINE:
+                    std::cout << "RECLINE";
+                    break;
+                default:
+                    std::cout << "UNKNOWN(" << static_cast<int>(response.axis) << ")";
+                    break;
+            }
+            std::cout << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
         }
-        std::cout << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
         
         // 调用用户回调
         if (adjust_seat_response_handler_) {
@@ -213,9 +254,11 @@ void SeatServiceClient::HandleRecallMemoryPositionResponse(const std::shared_ptr
     application::RecallMemoryPositionResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[SeatServiceClient] RecallMemoryPosition response - Preset ID: " 
-                  << static_cast<int>(response.presetID)
-                  << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[SeatServiceClient] RecallMemoryPosition response - Preset ID: " 
+                      << static_cast<int>(response.presetID)
+                      << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
         
         // 调用用户回调
         if (recall_memory_response_handler_) {
@@ -238,9 +281,11 @@ void SeatServiceClient::HandleSaveMemoryPositionResponse(const std::shared_ptr<v
     application::SaveMemoryPositionResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[SeatServiceClient] SaveMemoryPosition response - Preset ID: " 
-                  << static_cast<int>(response.presetID)
-                  << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[SeatServiceClient] SaveMemoryPosition response - Preset ID: " 
+                      << static_cast<int>(response.presetID)
+                      << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
         
         // 调用用户回调
         if (save_memory_response_handler_) {
@@ -263,19 +308,22 @@ void SeatServiceClient::HandleSeatPositionChangedEvent(const std::shared_ptr<vso
     application::OnSeatPositionChangedData event_data;
     
     if (Serializer::Deserialize(payload_data, event_data)) {
-        std::cout << "[SeatServiceClient] SeatPositionChanged event - Axis: ";
-        switch (event_data.axis) {
-            case application::SeatAxis::FORWARD_BACKWARD:
-                std::cout << "FORWARD_BACKWARD";
-                break;
-            case application::SeatAxis::RECLINE:
-                std::cout << "RECLINE";
-                break;
-            default:
-                std::cout << "UNKNOWN(" << static_cast<int>(event_data.axis) << ")";
-                break;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[SeatServiceClient] SeatPositionChanged event - Seat: "
+                      << static_cast<int>(event_data.seatID) << " Axis: ";
+            switch (event_data.axis) {
+                case application::SeatAxis::FORWARD_BACKWARD:
+                    std::cout << "FORWARD_BACKWARD";
+                    break;
+                case application::SeatAxis::RECLINE:
+                    std::cout << "RECLINE";
+                    break;
+                default:
+                    std::cout << "UNKNOWN(" << static_cast<int>(event_data.axis) << ")";
+                    break;
+            }
+            std::cout << " New Position: " << static_cast<int>(event_data.newPosition) << "%" << std::endl;
         }
-        std::cout << " New Position: " << static_cast<int>(event_data.newPosition) << "%" << std::endl;
         
         // 调用用户回调
         if (seat_position_changed_handler_) {
@@ -298,9 +346,11 @@ void SeatServiceClient::HandleMemorySaveConfirmEvent(const std::shared_ptr<vsome
     application::OnMemorySaveConfirmData event_data;
     
     if (Serializer::Deserialize(payload_data, event_data)) {
-        std::cout << "[SeatServiceClient] MemorySaveConfirm event - Preset ID: " 
-                  << static_cast<int>(event_data.presetID)
-                  << " Save Result: " << (event_data.saveResult == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[SeatServiceClient] MemorySaveConfirm event - Preset ID: " 
+                      << static_cast<int>(event_data.presetID)
+                      << " Save Result: " << (event_data.saveResult == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
         
         // 调用用户回调
         if (memory_save_confirm_handler_) {
@@ -311,5 +361,32 @@ void SeatServiceClient::HandleMemorySaveConfirmEvent(const std::shared_ptr<vsome
     }
 }
 
+void SeatServiceClient::HandleRecallCompleteEvent(const std::shared_ptr<vsomeip::message>& message) {
+    auto payload = message->get_payload();
+    if (!payload) {
+        std::cerr << "[SeatServiceClient] RecallComplete event has no payload" << std::endl;
+        return;
+    }
+    
+    // 反序列化事件数据
+    std::vector<uint8_t> payload_data(payload->get_data(), payload->get_data() + payload->get_length());
+    application::OnSeatRecallCompleteData event_data;
+    
+    if (Serializer::Deserialize(payload_data, event_data)) {
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[SeatServiceClient] RecallComplete event - Seat: " << static_cast<int>(event_data.seatID)
+                      << " Preset ID: " << static_cast<int>(event_data.presetID)
+                      << " Result: " << (event_data.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
+        
+        // 调用用户回调
+        if (recall_complete_handler_) {
+            recall_complete_handler_(event_data);
+        }
+    } else {
+        std::cerr << "[SeatServiceClient] Failed to deserialize RecallComplete event" << std::endl;
+    }
+}
+
 } // namespace communication
 } // namespace body_controller
@@ -1,7 +1,11 @@
 #include "communication/someip_client.h"
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <random>
 #include <thread>
 #include <chrono>
+#include <utility>
 
 namespace body_controller {
 namespace communication {
@@ -13,8 +17,11 @@ namespace communication {
 SomeipClient::SomeipClient(const std::string& app_name)
     : application_name_(app_name)
     , is_initialized_(false)
-    , is_running_(false) {
+    , is_running_(false)
+    , policy_(std::make_shared<const ClientPolicy>()) {
     
+    retry_timer_.Start([this](const std::vector<TimerWheel::Expired>& expired) { OnRetryTimer(expired); });
+
     // 获取vsomeip运行时
     runtime_ = vsomeip::runtime::get();
     if (!runtime_) {
@@ -107,6 +114,11 @@ void SomeipClient::Stop() {
     
     // 清理所有处理器
     app_->clear_all_handler();
+
+    // 未完成的挂起请求、排队中的请求和等待中的重试以CANCELLED完成
+    CancelRetries();
+    CancelQueued();
+    pending_requests_.Clear();
     
     // 停止应用程序
     app_->stop();
@@ -142,32 +154,74 @@ void SomeipClient::OnMessage(const std::shared_ptr<vsomeip::message>& message) {
         return;
     }
     
-    std::cout << "[SomeipClient] Received message - Service: 0x" << std::hex << message->get_service()
-              << " Method: 0x" << message->get_method()
-              << " Type: " << static_cast<int>(message->get_message_type()) << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[SomeipClient] Received message - Service: 0x" << std::hex << message->get_service()
+                  << " Method: 0x" << message->get_method()
+                  << " Type: " << static_cast<int>(message->get_message_type()) << std::endl;
+    }
 }
 
-void SomeipClient::SendRequest(vsomeip::service_t service_id, 
-                              vsomeip::instance_t instance_id,
-                              vsomeip::method_t method_id,
-                              const std::vector<uint8_t>& payload_data) {
+// ============================================================================
+// 请求发送（挂起请求、重试、熔断与优先级分道）
+// ============================================================================
+
+/**
+ * @brief 一次逻辑调用（可能包含多次尝试）
+ */
+struct SomeipClient::PendingCall {
+    vsomeip::service_t service_id;
+    vsomeip::instance_t instance_id;
+    vsomeip::method_t method_id;
+    std::vector<uint8_t> payload;
+    PendingResponseHandler handler;
+    std::chrono::steady_clock::time_point deadline;     ///< max表示不限
+    uint32_t attempt = 1;
+    bool idempotent = false;
+    CommandClass command_class = CommandClass::CONTROL;
+    bool holds_slot = false;                            ///< 当前尝试是否占用在途窗口
+    uint64_t probe_token = 0;                           ///< 当前尝试持有的熔断探测令牌（0表示不是探测）
+};
+
+void SomeipClient::SetPolicy(const ClientPolicy& policy) {
+    std::atomic_store_explicit(&policy_, std::make_shared<const ClientPolicy>(policy), std::memory_order_release);
+    circuit_breaker_.SetOptions(policy.circuit_breaker);
+}
+
+SomeipClient::ClientPolicy SomeipClient::GetPolicy() const {
+    return *PolicySnapshot();
+}
+
+std::shared_ptr<const SomeipClient::ClientPolicy> SomeipClient::PolicySnapshot() const {
+    return std::atomic_load_explicit(&policy_, std::memory_order_acquire);
+}
+
+uint32_t SomeipClient::GetMethodTimeout(vsomeip::method_t method_id) const {
+    const auto policy = PolicySnapshot();
+    auto it = policy->method_timeouts_ms.find(method_id);
+    return it != policy->method_timeouts_ms.end() ? it->second : policy->default_timeout_ms;
+}
+
+std::shared_ptr<vsomeip::message> SomeipClient::CreateRequest(vsomeip::service_t service_id,
+                                                              vsomeip::instance_t instance_id,
+                                                              vsomeip::method_t method_id,
+                                                              const std::vector<uint8_t>& payload_data) {
     if (!app_) {
         std::cerr << "[SomeipClient] Application not available" << std::endl;
-        return;
+        return nullptr;
     }
     
     // 检查服务是否可用
     if (!IsServiceAvailable(service_id, instance_id)) {
         std::cerr << "[SomeipClient] Service 0x" << std::hex << service_id 
-                  << " Instance 0x" << instance_id << " is not available" << std::endl;
-        return;
+                  << " Instance 0x" << instance_id << " is not available" << std::dec << std::endl;
+        return nullptr;
     }
     
     // 创建请求消息
     auto request = runtime_->create_request();
     if (!request) {
         std::cerr << "[SomeipClient] Failed to create request message" << std::endl;
-        return;
+        return nullptr;
     }
     
     // 设置消息头
@@ -178,25 +232,366 @@ void SomeipClient::SendRequest(vsomeip::service_t service_id,
     // 设置payload
     if (!payload_data.empty()) {
         auto payload = runtime_->create_payload(payload_data);
-        if (payload) {
-            request->set_payload(payload);
-        } else {
+        if (!payload) {
             std::cerr << "[SomeipClient] Failed to create payload" << std::endl;
-            return;
+            return nullptr;
         }
+        request->set_payload(payload);
     }
+    return request;
+}
+
+bool SomeipClient::SendRequest(vsomeip::service_t service_id, 
+                              vsomeip::instance_t instance_id,
+                              vsomeip::method_t method_id,
+                              const std::vector<uint8_t>& payload_data,
+                              PendingResponseHandler handler,
+                              uint32_t timeout_ms) {
+    if (!handler) {
+        // 无需关联响应的请求：直接发送，响应交给全局响应处理器
+        auto request = CreateRequest(service_id, instance_id, method_id, payload_data);
+        if (!request) {
+            return false;
+        }
+        app_->send(request);
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[SomeipClient] Sent request - Service: 0x" << std::hex << service_id
+                      << " Method: 0x" << method_id << std::dec << " Payload size: " << payload_data.size() << std::endl;
+        }
+        return true;
+    }
+
+    auto call = std::make_shared<PendingCall>();
+    call->service_id = service_id;
+    call->instance_id = instance_id;
+    call->method_id = method_id;
+    call->payload = payload_data;
+    call->deadline = timeout_ms > 0
+        ? std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms)
+        : std::chrono::steady_clock::time_point::max();
+    call->idempotent = IsIdempotentMethod(service_id, method_id);
+    call->command_class = ClassifyCommand(service_id, method_id, payload_data);
+
+    // 统计从提交（含排队）到最终结果的端到端延迟
+    const auto submitted_at = std::chrono::steady_clock::now();
+    const CommandClass command_class = call->command_class;
+    call->handler = [this, command_class, submitted_at, handler = std::move(handler)](
+            CallbackStatus status, const std::shared_ptr<vsomeip::message>& response) {
+        RecordLaneResult(command_class, status, static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - submitted_at).count()));
+        handler(status, response);
+    };
+    return Dispatch(call);
+}
+
+bool SomeipClient::Dispatch(const std::shared_ptr<PendingCall>& call) {
+    // 安全类命令不排队也不占用窗口，不会被积压的查询和控制命令阻塞
+    if (call->command_class != CommandClass::SAFETY) {
+        const uint32_t max_in_flight = PolicySnapshot()->max_in_flight;
+
+        bool queued = false;
+        {
+            std::lock_guard<std::mutex> lock(lane_mutex_);
+            bool backlog = false;
+            for (const auto& lane : lanes_) {
+                backlog = backlog || !lane.empty();
+            }
+            if (backlog || (max_in_flight != 0 && in_flight_ >= max_in_flight)) {
+                // 已有积压时同样排队，由PumpLanes按优先级出队
+                lanes_[static_cast<size_t>(call->command_class)].push_back(call);
+                queued = true;
+            } else {
+                ++in_flight_;
+                call->holds_slot = true;
+            }
+        }
+        if (queued) {
+            PumpLanes();
+            return true;
+        }
+    }
+
+    if (StartAttempt(call)) {
+        return true;
+    }
+    PumpLanes();
+    return false;
+}
+
+void SomeipClient::PumpLanes() {
+    const uint32_t max_in_flight = PolicySnapshot()->max_in_flight;
+
+    // 循环而非递归：熔断期间排队请求会逐个快速失败
+    while (true) {
+        std::shared_ptr<PendingCall> next;
+        {
+            std::lock_guard<std::mutex> lock(lane_mutex_);
+            if (max_in_flight != 0 && in_flight_ >= max_in_flight) {
+                return;
+            }
+            for (auto& lane : lanes_) {
+                if (!lane.empty()) {
+                    next = std::move(lane.front());
+                    lane.pop_front();
+                    break;
+                }
+            }
+            if (!next) {
+                return;
+            }
+            ++in_flight_;
+            next->holds_slot = true;
+        }
+        StartAttempt(next);
+    }
+}
+
+void SomeipClient::ReleaseSlot(const std::shared_ptr<PendingCall>& call) {
+    if (!call->holds_slot) {
+        return;
+    }
+    call->holds_slot = false;
+    std::lock_guard<std::mutex> lock(lane_mutex_);
+    --in_flight_;
+}
+
+void SomeipClient::CancelQueued() {
+    std::array<std::deque<std::shared_ptr<PendingCall>>, COMMAND_CLASS_COUNT> queued;
+    {
+        std::lock_guard<std::mutex> lock(lane_mutex_);
+        queued.swap(lanes_);
+    }
+    for (auto& lane : queued) {
+        for (auto& call : lane) {
+            call->handler(CallbackStatus::CANCELLED, nullptr);
+        }
+    }
+}
+
+void SomeipClient::RecordLaneResult(CommandClass command_class, CallbackStatus status, uint64_t latency_us) {
+    const size_t index = static_cast<size_t>(command_class);
+    LaneMetrics& metrics = lane_metrics_[index];
+    if (status == CallbackStatus::COMPLETED) {
+        metrics.completed.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        metrics.failed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    size_t bucket = 0;
+    while ((latency_us >> (bucket + 1)) != 0 && bucket + 1 < LATENCY_BUCKETS) {
+        ++bucket;
+    }
+    metrics.latency_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    const uint32_t budget_ms = PolicySnapshot()->latency_budget_ms[index];
+    if (budget_ms != 0 && latency_us > static_cast<uint64_t>(budget_ms) * 1000) {
+        metrics.over_budget.fetch_add(1, std::memory_order_relaxed);
+        if (command_class == CommandClass::SAFETY) {
+            std::cerr << "[SomeipClient] " << ToString(command_class) << " command took " << latency_us / 1000
+                      << "ms, budget " << budget_ms << "ms" << std::endl;
+        }
+    }
+}
+
+SomeipClient::LaneStats SomeipClient::GetLaneStats(CommandClass command_class) const {
+    const size_t index = static_cast<size_t>(command_class);
+    const LaneMetrics& metrics = lane_metrics_[index];
+
+    LaneStats stats;
+    stats.dispatched = metrics.dispatched.load(std::memory_order_relaxed);
+    stats.completed = metrics.completed.load(std::memory_order_relaxed);
+    stats.failed = metrics.failed.load(std::memory_order_relaxed);
+    stats.over_budget = metrics.over_budget.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(lane_mutex_);
+        stats.queued = lanes_[index].size();
+    }
+
+    std::array<uint64_t, LATENCY_BUCKETS> buckets{};
+    uint64_t total = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+        buckets[i] = metrics.latency_buckets[i].load(std::memory_order_relaxed);
+        total += buckets[i];
+    }
+    auto percentile = [&buckets, total](uint64_t permille) -> uint64_t {
+        const uint64_t rank = (total * permille + 999) / 1000;
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+            cumulative += buckets[i];
+            if (cumulative >= rank && cumulative > 0) {
+                return (uint64_t{1} << (i + 1)) - 1;
+            }
+        }
+        return 0;
+    };
+    stats.p50_latency_us = percentile(500);
+    stats.p99_latency_us = percentile(990);
+    return stats;
+}
+
+bool SomeipClient::StartAttempt(const std::shared_ptr<PendingCall>& call) {
+    // 未能发出的请求立即结束，调用者不必等待超时
+    auto fail = [this, &call](CallbackStatus status) {
+        ReleaseSlot(call);
+        call->handler(status, nullptr);
+        return false;
+    };
+
+    // 单次尝试超时取方法超时与调用方剩余预算中的较小者
+    uint32_t attempt_timeout_ms = GetMethodTimeout(call->method_id);
+    if (call->deadline != std::chrono::steady_clock::time_point::max()) {
+        const auto remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            call->deadline - std::chrono::steady_clock::now()).count();
+        if (remaining_ms <= 0) {
+            return fail(CallbackStatus::TIMEOUT);
+        }
+        attempt_timeout_ms = std::min<uint32_t>(attempt_timeout_ms, static_cast<uint32_t>(
+            std::min<int64_t>(remaining_ms, std::numeric_limits<uint32_t>::max())));
+    }
+
+    auto request = CreateRequest(call->service_id, call->instance_id, call->method_id, call->payload);
+    if (!request) {
+        return fail(CallbackStatus::FAILED);
+    }
+
+    // 放行后必须以RecordSuccess/RecordFailure/ReleaseProbe之一结束，否则HALF_OPEN的探测名额永不归还；
+    // 探测令牌记在本次尝试上，只有持有者能归还名额
+    if (!circuit_breaker_.AllowRequest(&call->probe_token)) {
+        std::cerr << "[SomeipClient] Circuit open for service 0x" << std::hex << call->service_id
+                  << std::dec << ", failing fast" << std::endl;
+        return fail(CallbackStatus::FAILED);
+    }
+
+    // 发送请求（会话ID由vsomeip在send时分配）
+    bool registered = false;
+    {
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        app_->send(request);
+        registered = pending_requests_.RegisterCallback(
+            MakeRequestKey(call->method_id, request->get_session()),
+            [this, call](CallbackStatus status, const std::shared_ptr<vsomeip::message>& response) {
+                OnAttemptFinished(call, status, response);
+            },
+            attempt_timeout_ms);
+    }
+
+    if (!registered) {
+        // 会话ID回绕后与仍在挂起的请求冲突
+        std::cerr << "[SomeipClient] Duplicate pending request - Method: 0x" << std::hex << call->method_id
+                  << " Session: 0x" << request->get_session() << std::dec << std::endl;
+        circuit_breaker_.ReleaseProbe(std::exchange(call->probe_token, 0));
+        return fail(CallbackStatus::FAILED);
+    }
+    lane_metrics_[static_cast<size_t>(call->command_class)].dispatched.fetch_add(1, std::memory_order_relaxed);
     
-    // 发送请求
-    app_->send(request);
-    
-    std::cout << "[SomeipClient] Sent request - Service: 0x" << std::hex << service_id
-              << " Method: 0x" << method_id << " Payload size: " << payload_data.size() << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[SomeipClient] Sent request - Service: 0x" << std::hex << call->service_id
+                  << " Method: 0x" << call->method_id << " Session: 0x" << request->get_session()
+                  << std::dec << " Attempt: " << call->attempt << " Timeout: " << attempt_timeout_ms << "ms"
+                  << " Payload size: " << call->payload.size() << std::endl;
+    }
+    return true;
+}
+
+void SomeipClient::OnAttemptFinished(const std::shared_ptr<PendingCall>& call, CallbackStatus status,
+                                     const std::shared_ptr<vsomeip::message>& response) {
+    ReleaseSlot(call);
+    const uint64_t probe_token = std::exchange(call->probe_token, 0);
+
+    // 服务端执行器队列已满：请求未被执行，服务本身正常
+    const bool busy = status == CallbackStatus::COMPLETED && response &&
+                      response->get_message_type() == vsomeip::message_type_e::MT_ERROR &&
+                      response->get_return_code() == vsomeip::return_code_e::E_NOT_READY;
+
+    if (busy) {
+        circuit_breaker_.ReleaseProbe(probe_token);
+    } else if (status == CallbackStatus::COMPLETED) {
+        if (response && response->get_message_type() == vsomeip::message_type_e::MT_ERROR) {
+            circuit_breaker_.RecordFailure();
+        } else {
+            circuit_breaker_.RecordSuccess();
+        }
+    } else if (status == CallbackStatus::TIMEOUT) {
+        circuit_breaker_.RecordFailure();
+    } else {
+        // 取消或未能发出：不能说明服务状态
+        circuit_breaker_.ReleaseProbe(probe_token);
+    }
+
+    // 幂等查询在超时后重试，忙碌拒绝的请求未被执行，任何请求都可以重试；退避后仍须在调用方预算之内
+    if ((status == CallbackStatus::TIMEOUT && call->idempotent) || busy) {
+        const auto policy = PolicySnapshot();
+        if (call->attempt < policy->max_retry_attempts) {
+            const uint32_t exponent = std::min<uint32_t>(call->attempt - 1, 16);
+            const uint64_t backoff_ms = std::min<uint64_t>(
+                static_cast<uint64_t>(policy->retry_base_delay_ms) << exponent, policy->retry_max_delay_ms);
+
+            // 抖动：在[backoff/2, backoff]内均匀取值，避免多个客户端同时重试
+            static thread_local std::mt19937 generator(std::random_device{}());
+            std::uniform_int_distribution<uint64_t> jitter(backoff_ms / 2, std::max<uint64_t>(backoff_ms, 1));
+            const uint32_t delay_ms = static_cast<uint32_t>(jitter(generator));
+
+            if (std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms) < call->deadline) {
+                ++call->attempt;
+                retry_count_.fetch_add(1, std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> lock(retry_mutex_);
+                    const uint64_t token = next_retry_token_++;
+                    pending_retries_.emplace(token, call);
+                    retry_timer_.Schedule(token, token, delay_ms);
+                }
+                PumpLanes();
+                return;
+            }
+        }
+    }
+
+    call->handler(status, response);
+    PumpLanes();
+}
+
+void SomeipClient::OnRetryTimer(const std::vector<TimerWheel::Expired>& expired) {
+    for (const auto& entry : expired) {
+        std::shared_ptr<PendingCall> call;
+        {
+            std::lock_guard<std::mutex> lock(retry_mutex_);
+            auto it = pending_retries_.find(entry.key);
+            if (it == pending_retries_.end()) {
+                continue;
+            }
+            call = std::move(it->second);
+            pending_retries_.erase(it);
+        }
+        Dispatch(call);
+    }
+}
+
+void SomeipClient::CancelRetries() {
+    std::unordered_map<uint64_t, std::shared_ptr<PendingCall>> retries;
+    {
+        std::lock_guard<std::mutex> lock(retry_mutex_);
+        retries.swap(pending_retries_);
+    }
+    for (auto& entry : retries) {
+        entry.second->handler(CallbackStatus::CANCELLED, nullptr);
+    }
+}
+
+bool SomeipClient::ResolvePendingRequest(const std::shared_ptr<vsomeip::message>& response) {
+    {
+        // 等待进行中的发送完成登记
+        std::lock_guard<std::mutex> lock(send_mutex_);
+    }
+    return pending_requests_.ExecuteCallback(
+        MakeRequestKey(response->get_method(), response->get_session()), response);
 }
 
 void SomeipClient::SubscribeEvent(vsomeip::service_t service_id,
                                  vsomeip::instance_t instance_id,
                                  vsomeip::event_t event_id,
-                                 vsomeip::eventgroup_t eventgroup_id) {
+                                 vsomeip::eventgroup_t eventgroup_id,
+                                 vsomeip::event_type_e event_type) {
     if (!app_) {
         std::cerr << "[SomeipClient] Application not available" << std::endl;
         return;
@@ -208,7 +603,7 @@ void SomeipClient::SubscribeEvent(vsomeip::service_t service_id,
         instance_id, 
         event_id,
         {eventgroup_id},  // 事件组集合
-        vsomeip::event_type_e::ET_EVENT
+        event_type
     );
     
     // 第二步：订阅事件组
@@ -0,0 +1,169 @@
+#include "communication/timer_wheel.h"
+#include <algorithm>
+#include <iostream>
+
+namespace body_controller {
+namespace communication {
+
+namespace {
+
+constexpr uint64_t SLOT_MASK = TimerWheel::SLOTS_PER_LEVEL - 1;
+constexpr uint64_t MAX_DELTA_TICKS = (1ull << (TimerWheel::SLOT_BITS * TimerWheel::LEVEL_COUNT)) - 1;
+
+} // namespace
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tick)
+    : tick_(tick.count() > 0 ? tick : std::chrono::milliseconds(1)) {
+}
+
+TimerWheel::~TimerWheel() {
+    Stop();
+}
+
+void TimerWheel::Start(ExpiryHandler handler) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    handler_ = std::move(handler);
+    base_time_ = std::chrono::steady_clock::now() - TicksToDuration(current_tick_);
+    running_ = true;
+    thread_ = std::thread(&TimerWheel::Run, this);
+}
+
+void TimerWheel::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& level : levels_) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    scheduled_count_.store(0, std::memory_order_relaxed);
+}
+
+void TimerWheel::Schedule(uint64_t key, uint64_t token, uint32_t timeout_ms) {
+    const uint64_t ticks = std::max<uint64_t>(1, (timeout_ms + tick_.count() - 1) / tick_.count());
+
+    bool was_idle = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Insert(Entry{key, token, current_tick_ + ticks});
+        was_idle = scheduled_count_.fetch_add(1, std::memory_order_relaxed) == 0;
+    }
+    if (was_idle) {
+        cv_.notify_one();
+    }
+}
+
+// ============================================================================
+// 内部实现（调用者持有mutex_）
+// ============================================================================
+
+std::chrono::milliseconds TimerWheel::TicksToDuration(uint64_t ticks) const {
+    return std::chrono::milliseconds(static_cast<int64_t>(ticks) * tick_.count());
+}
+
+void TimerWheel::Insert(const Entry& entry) {
+    const uint64_t delta = entry.expiry_tick > current_tick_ ? entry.expiry_tick - current_tick_ : 0;
+
+    for (size_t level = 0; level < LEVEL_COUNT; ++level) {
+        if (delta < (1ull << (SLOT_BITS * (level + 1)))) {
+            const size_t slot = (entry.expiry_tick >> (SLOT_BITS * level)) & SLOT_MASK;
+            levels_[level][slot].push_back(entry);
+            return;
+        }
+    }
+
+    // 超出时间轮范围：放入最高层最远的槽，级联时再重新定位
+    const uint64_t clamped_tick = current_tick_ + MAX_DELTA_TICKS;
+    const size_t slot = (clamped_tick >> (SLOT_BITS * (LEVEL_COUNT - 1))) & SLOT_MASK;
+    levels_[LEVEL_COUNT - 1][slot].push_back(entry);
+}
+
+void TimerWheel::Cascade(size_t level) {
+    const size_t index = (current_tick_ >> (SLOT_BITS * level)) & SLOT_MASK;
+    Slot entries;
+    entries.swap(levels_[level][index]);
+    for (const auto& entry : entries) {
+        Insert(entry);
+    }
+}
+
+void TimerWheel::AdvanceTick(std::vector<Expired>& expired) {
+    ++current_tick_;
+
+    // 低层每转完一圈，将上一层当前槽中的条目下放
+    const size_t index = current_tick_ & SLOT_MASK;
+    if (index == 0) {
+        for (size_t level = 1; level < LEVEL_COUNT; ++level) {
+            Cascade(level);
+            if (((current_tick_ >> (SLOT_BITS * level)) & SLOT_MASK) != 0) {
+                break;
+            }
+        }
+    }
+
+    Slot due;
+    due.swap(levels_[0][index]);
+    for (const auto& entry : due) {
+        if (entry.expiry_tick <= current_tick_) {
+            expired.push_back(Expired{entry.key, entry.token});
+            scheduled_count_.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+            Insert(entry);
+        }
+    }
+}
+
+void TimerWheel::Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::vector<Expired> expired;
+
+    while (running_) {
+        if (scheduled_count_.load(std::memory_order_relaxed) == 0) {
+            // 空闲时不空转：等待新条目，并重新对齐基准时间
+            cv_.wait(lock, [this]() {
+                return !running_ || scheduled_count_.load(std::memory_order_relaxed) > 0;
+            });
+            base_time_ = std::chrono::steady_clock::now() - TicksToDuration(current_tick_);
+            continue;
+        }
+
+        const auto next_tick_time = base_time_ + TicksToDuration(current_tick_ + 1);
+        if (cv_.wait_until(lock, next_tick_time, [this]() { return !running_; })) {
+            break;
+        }
+
+        // 线程被延迟调度时一次补齐所有落后的刻度
+        const auto now = std::chrono::steady_clock::now();
+        while (base_time_ + TicksToDuration(current_tick_ + 1) <= now) {
+            AdvanceTick(expired);
+        }
+
+        if (!expired.empty() && handler_) {
+            lock.unlock();
+            try {
+                handler_(expired);
+            } catch (const std::exception& e) {
+                std::cerr << "[TimerWheel] Expiry handler error: " << e.what() << std::endl;
+            }
+            lock.lock();
+        }
+        expired.clear();
+    }
+}
+
+} // namespace communication
+} // namespace body_controller
@@ -45,9 +45,11 @@ bool WindowServiceClient::Initialize() {
 }
 
 void WindowServiceClient::SetWindowPosition(const application::SetWindowPositionReq& request) {
-    std::cout << "[WindowServiceClient] Setting window position for window: " 
-              << static_cast<int>(request.windowID) 
-              << " Position: " << static_cast<int>(request.position) << "%" << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[WindowServiceClient] Setting window position for window: " 
+                  << static_cast<int>(request.windowID) 
+                  << " Position: " << static_cast<int>(request.position) << "%" << std::endl;
+    }
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -56,10 +58,19 @@ void WindowServiceClient::SetWindowPosition(const application::SetWindowPosition
     SendRequest(body_controller::communication::WINDOW_SERVICE_ID, body_controller::communication::WINDOW_INSTANCE_ID, window_service::SET_WINDOW_POSITION, payload_data);
 }
 
+bool WindowServiceClient::SetWindowPosition(const application::SetWindowPositionReq& request,
+                                            ResponseCallback<application::SetWindowPositionResp> callback,
+                                            uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::WINDOW_SERVICE_ID, body_controller::communication::WINDOW_INSTANCE_ID, window_service::SET_WINDOW_POSITION,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void WindowServiceClient::ControlWindow(const application::ControlWindowReq& request) {
-    std::cout << "[WindowServiceClient] Controlling window: " 
-              << static_cast<int>(request.windowID) 
-              << " Command: " << static_cast<int>(request.command) << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[WindowServiceClient] Controlling window: " 
+                  << static_cast<int>(request.windowID) 
+                  << " Command: " << static_cast<int>(request.command) << std::endl;
+    }
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -68,9 +79,18 @@ void WindowServiceClient::ControlWindow(const application::ControlWindowReq& req
     SendRequest(body_controller::communication::WINDOW_SERVICE_ID, body_controller::communication::WINDOW_INSTANCE_ID, window_service::CONTROL_WINDOW, payload_data);
 }
 
+bool WindowServiceClient::ControlWindow(const application::ControlWindowReq& request,
+                                        ResponseCallback<application::ControlWindowResp> callback,
+                                        uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::WINDOW_SERVICE_ID, body_controller::communication::WINDOW_INSTANCE_ID, window_service::CONTROL_WINDOW,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void WindowServiceClient::GetWindowPosition(const application::GetWindowPositionReq& request) {
-    std::cout << "[WindowServiceClient] Getting window position for window: " 
-              << static_cast<int>(request.windowID) << std::endl;
+    if (IsLogEnabled(LogLevel::DEBUG)) {
+        std::cout << "[WindowServiceClient] Getting window position for window: " 
+                  << static_cast<int>(request.windowID) << std::endl;
+    }
     
     // 序列化请求数据
     auto payload_data = Serializer::Serialize(request);
@@ -79,15 +99,26 @@ void WindowServiceClient::GetWindowPosition(const application::GetWindowPosition
     SendRequest(body_controller::communication::WINDOW_SERVICE_ID, body_controller::communication::WINDOW_INSTANCE_ID, window_service::GET_WINDOW_POSITION, payload_data);
 }
 
+bool WindowServiceClient::GetWindowPosition(const application::GetWindowPositionReq& request,
+                                            ResponseCallback<application::GetWindowPositionResp> callback,
+                                            uint32_t timeout_ms) {
+    return SendRequest(body_controller::communication::WINDOW_SERVICE_ID, body_controller::communication::WINDOW_INSTANCE_ID, window_service::GET_WINDOW_POSITION,
+                       Serializer::Serialize(request), MakeResponseHandler(std::move(callback)), timeout_ms);
+}
+
 void WindowServiceClient::OnAvailability(vsomeip::service_t service, vsomeip::instance_t instance, bool is_available) {
     SomeipClient::OnAvailability(service, instance, is_available);
     
     if (service == body_controller::communication::WINDOW_SERVICE_ID && instance == body_controller::communication::WINDOW_INSTANCE_ID && is_available) {
         std::cout << "[WindowServiceClient] Window service is available, subscribing to events..." << std::endl;
         
-        // 订阅车窗位置变化事件
+        // 订阅车窗位置字段（订阅后立即收到各车窗的当前值）
         SubscribeEvent(body_controller::communication::WINDOW_SERVICE_ID, body_controller::communication::WINDOW_INSTANCE_ID,
-                      window_events::ON_WINDOW_POSITION_CHANGED, body_controller::communication::WINDOW_EVENTS_GROUP_ID);
+                      window_events::ON_WINDOW_POSITION_CHANGED, body_controller::communication::WINDOW_EVENTS_GROUP_ID,
+                      vsomeip::event_type_e::ET_FIELD);
+    } else if (service == body_controller::communication::WINDOW_SERVICE_ID && instance == body_controller::communication::WINDOW_INSTANCE_ID) {
+        // 服务下线后镜像不再更新，回退到getter直到重新订阅
+        position_mirror_.Invalidate();
     }
 }
 
@@ -104,6 +135,12 @@ void WindowServiceClient::OnMessage(const std::shared_ptr<vsomeip::message>& mes
     auto message_type = message->get_message_type();
     auto method_id = message->get_method();
     
+    // 已登记的挂起请求优先（含MT_ERROR），其余响应交给全局响应处理器
+    if ((message_type == vsomeip::message_type_e::MT_RESPONSE ||
+         message_type == vsomeip::message_type_e::MT_ERROR) && ResolvePendingRequest(message)) {
+        return;
+    }
+
     if (message_type == vsomeip::message_type_e::MT_RESPONSE) {
         // 处理方法响应
         if (method_id == window_service::SET_WINDOW_POSITION) {
@@ -133,9 +170,11 @@ void WindowServiceClient::HandleSetWindowPositionResponse(const std::shared_ptr<
     application::SetWindowPositionResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[WindowServiceClient] SetWindowPosition response - Window: " 
-                  << static_cast<int>(response.windowID)
-                  << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[WindowServiceClient] SetWindowPosition response - Window: " 
+                      << static_cast<int>(response.windowID)
+                      << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
         
         // 调用用户回调
         if (set_position_response_handler_) {
@@ -158,9 +197,11 @@ void WindowServiceClient::HandleControlWindowResponse(const std::shared_ptr<vsom
     application::ControlWindowResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[WindowServiceClient] ControlWindow response - Window: " 
-                  << static_cast<int>(response.windowID)
-                  << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[WindowServiceClient] ControlWindow response - Window: " 
+                      << static_cast<int>(response.windowID)
+                      << " Result: " << (response.result == application::Result::SUCCESS ? "SUCCESS" : "FAIL") << std::endl;
+        }
         
         // 调用用户回调
         if (control_response_handler_) {
@@ -183,9 +224,11 @@ void WindowServiceClient::HandleGetWindowPositionResponse(const std::shared_ptr<
     application::GetWindowPositionResp response;
     
     if (Serializer::Deserialize(payload_data, response)) {
-        std::cout << "[WindowServiceClient] GetWindowPosition response - Window: " 
-                  << static_cast<int>(response.windowID)
-                  << " Position: " << static_cast<int>(response.position) << "%" << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[WindowServiceClient] GetWindowPosition response - Window: " 
+                      << static_cast<int>(response.windowID)
+                      << " Position: " << static_cast<int>(response.position) << "%" << std::endl;
+        }
         
         // 调用用户回调
         if (get_position_response_handler_) {
@@ -208,9 +251,13 @@ void WindowServiceClient::HandleWindowPositionChangedEvent(const std::shared_ptr
     application::OnWindowPositionChangedData event_data;
     
     if (Serializer::Deserialize(payload_data, event_data)) {
-        std::cout << "[WindowServiceClient] WindowPositionChanged event - Window: " 
-                  << static_cast<int>(event_data.windowID)
-                  << " New Position: " << static_cast<int>(event_data.newPosition) << "%" << std::endl;
+        if (IsLogEnabled(LogLevel::DEBUG)) {
+            std::cout << "[WindowServiceClient] WindowPositionChanged event - Window: " 
+                      << static_cast<int>(event_data.windowID)
+                      << " New Position: " << static_cast<int>(event_data.newPosition) << "%" << std::endl;
+        }
+        
+        position_mirror_.Update(static_cast<size_t>(event_data.windowID), event_data.newPosition);
         
         // 调用用户回调
         if (window_position_changed_handler_) {
@@ -4,6 +4,8 @@
 #include <thread>
 #include <chrono>
 #include "web_api/http_server.h"
+#include "web_api/config_manager.h"
+#include "web_api/config_watcher.h"
 // WebSocket服务器已移除，使用SSE替代
 #include "web_api/api_handlers.h"
 
@@ -45,9 +47,8 @@ void print_banner() {
 
 void print_usage() {
     std::cout << "Usage: body_controller_web_server [options]" << std::endl;
-    std::cout << "Options:" << std::endl;
-    std::cout << "  --http-port PORT     HTTP server port (default: 8080)" << std::endl;
-    std::cout << "  --help               Show this help message" << std::endl;
+    std::cout << "Options (override environment variables in brackets, which override the config file):" << std::endl;
+    web_api::ConfigManager::PrintOptions();
     std::cout << std::endl;
     std::cout << "Environment Variables:" << std::endl;
     std::cout << "  VSOMEIP_CONFIGURATION    Path to vsomeip configuration file" << std::endl;
@@ -56,7 +57,7 @@ void print_usage() {
     std::cout << "Example:" << std::endl;
     std::cout << "  export VSOMEIP_CONFIGURATION=./config/vsomeip.json" << std::endl;
     std::cout << "  export VSOMEIP_APPLICATION_NAME=web_server" << std::endl;
-    std::cout << "  ./bin/body_controller_web_server --http-port 8080 --ws-port 8081" << std::endl;
+    std::cout << "  ./bin/body_controller_web_server --config ./config/system_config.json --http-port 8080" << std::endl;
 }
 
 bool check_environment() {
@@ -107,26 +108,48 @@ void print_server_status() {
     }
 }
 
+/**
+ * @brief 应用可在运行期间生效的配置（启动及每次热加载时调用）
+ */
+void apply_runtime_config(const web_api::WebServerConfig& config) {
+    communication::LogLevel log_level;
+    if (communication::ParseLogLevel(config.log_level, log_level)) {
+        communication::SetLogLevel(log_level);
+    }
+    if (g_api_handlers) {
+        g_api_handlers->ApplyConfig(config);
+    }
+}
+
 int main(int argc, char* argv[]) {
-    // 解析命令行参数
-    int http_port = 8080;
-    
+    // 检查命令行参数
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         
         if (arg == "--help") {
             print_usage();
             return 0;
-        } else if (arg == "--http-port" && i + 1 < argc) {
-            http_port = std::atoi(argv[++i]);
-        } else {
+        } else if (!web_api::ConfigManager::IsKnownOption(arg) || i + 1 >= argc) {
             std::cerr << "[WebServer] Unknown argument: " << arg << std::endl;
             print_usage();
             return 1;
         }
+        ++i;
+    }
+    
+    // 加载配置：配置文件 -> 环境变量 -> 命令行
+    const web_api::WebServerConfig config = web_api::ConfigManager::Load(argc, argv);
+    std::string config_error;
+    if (!web_api::ConfigManager::ValidateConfig(config, config_error)) {
+        std::cerr << "[WebServer] Invalid configuration: " << config_error << std::endl;
+        return 1;
     }
+    web_api::ConfigManager::Publish(config);
+    apply_runtime_config(config);
+    const int http_port = config.http_port;
     
     print_banner();
+    web_api::ConfigManager::PrintConfig(config);
     
     // 检查环境变量
     if (!check_environment()) {
@@ -142,6 +165,9 @@ int main(int argc, char* argv[]) {
         
         // 创建API处理器
         g_api_handlers = std::make_shared<web_api::ApiHandlers>();
+
+        g_api_handlers->ApplyConfig(config);
+
         if (!g_api_handlers->Initialize()) {
             std::cerr << "[WebServer] Failed to initialize API handlers" << std::endl;
             return 1;
@@ -150,7 +176,7 @@ int main(int argc, char* argv[]) {
         // WebSocket服务器已移除，使用SSE替代实时推送
         
         // 创建HTTP服务器
-        g_http_server = std::make_shared<web_api::HttpServer>(http_port);
+        g_http_server = std::make_shared<web_api::HttpServer>(config);
         if (!g_http_server->Initialize()) {
             std::cerr << "[WebServer] Failed to initialize HTTP server" << std::endl;
             return 1;
@@ -164,6 +190,11 @@ int main(int argc, char* argv[]) {
         
         // WebSocket服务器已移除，使用SSE替代
 
+        // 配置热加载：文件变化或POST /api/admin/config/reload时发布新快照，
+        // 超时、合并窗口、日志级别等即时生效，不断开SSE连接也不重建SOME/IP客户端。
+        // 必须在HTTP服务器启动前登记，否则启动后立即到达的reload请求会漏掉应用
+        web_api::ConfigManager::AddReloadListener(apply_runtime_config);
+
         // 启动HTTP服务器（先启动，不依赖SOME/IP）
         std::cout << "[WebServer] Starting HTTP server..." << std::endl;
         if (!g_http_server->Start()) {
@@ -177,6 +208,20 @@ int main(int argc, char* argv[]) {
         std::cout << "[WebServer] 📚 API Documentation: http://localhost:" << http_port << "/api/info" << std::endl;
         std::cout << "[WebServer] 💚 Health Check: http://localhost:" << http_port << "/api/health" << std::endl;
 
+        std::unique_ptr<web_api::ConfigWatcher> config_watcher;
+        if (config.enable_config_watch) {
+            config_watcher = std::make_unique<web_api::ConfigWatcher>(
+                web_api::ConfigManager::GetConfigFile(), [] {
+                    std::string error;
+                    if (!web_api::ConfigManager::Reload(error)) {
+                        std::cerr << "[WebServer] Configuration reload rejected: " << error << std::endl;
+                    }
+                });
+            if (!config_watcher->Start()) {
+                std::cerr << "[WebServer] Config file watch unavailable, use POST /api/admin/config/reload" << std::endl;
+            }
+        }
+
         // 尝试启动SOME/IP服务客户端（异步，不阻塞Web服务器）
         std::cout << "[WebServer] Attempting to connect to SOME/IP services..." << std::endl;
         std::thread someip_thread([&]() {
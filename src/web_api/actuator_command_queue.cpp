@@ -0,0 +1,47 @@
+#include "web_api/actuator_command_queue.h"
+
+namespace body_controller {
+namespace web_api {
+
+size_t ActuatorCommandQueue::GetQueuedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& entry : actuators_) {
+        count += entry.second.pending.size();
+    }
+    return count;
+}
+
+void ActuatorCommandQueue::Pump(ActuatorKey key) {
+    std::function<void(Done)> dispatch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = actuators_.find(key);
+        if (it == actuators_.end() || it->second.busy || it->second.pending.empty()) {
+            return;
+        }
+        dispatch = std::move(it->second.pending.front().dispatch);
+        it->second.pending.pop_front();
+        it->second.busy = true;
+    }
+    dispatched_count_.fetch_add(1, std::memory_order_relaxed);
+
+    // 命令完成（响应、超时或发送失败）后释放执行器并发送下一条
+    auto done = [this, key]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            actuators_[key].busy = false;
+        }
+        Pump(key);
+    };
+
+    try {
+        dispatch(done);
+    } catch (const std::exception& e) {
+        std::cerr << "[ActuatorCommandQueue] Dispatch error: " << e.what() << std::endl;
+        done();
+    }
+}
+
+} // namespace web_api
+} // namespace body_controller
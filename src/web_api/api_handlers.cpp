@@ -1,5 +1,6 @@
 #include "web_api/api_handlers.h"
 #include "web_api/http_server.h"
+#include "web_api/fast_json_codec.h"
 // WebSocket服务器已移除，使用SSE替代
 #include "communication/someip_service_definitions.h"
 #include <iostream>
@@ -15,6 +16,12 @@ ApiHandlers::ApiHandlers() {
 
 ApiHandlers::~ApiHandlers() {
     Stop();
+    if (event_bus_) {
+        event_bus_->Shutdown();
+    }
+    if (sse_coalescer_) {
+        sse_coalescer_->Stop();
+    }
 }
 
 bool ApiHandlers::Initialize() {
@@ -25,6 +32,29 @@ bool ApiHandlers::Initialize() {
         light_client_ = std::make_shared<communication::LightServiceClient>("web_light_client");
         seat_client_ = std::make_shared<communication::SeatServiceClient>("web_seat_client");
 
+        // 应用配置的超时、重试与熔断策略
+        ApplyClientPolicies();
+
+        // 创建事件总线，SSE推送在独立订阅者线程中批量执行，不占用vsomeip分发线程
+        if (!event_bus_) {
+            event_bus_ = std::make_shared<EventBus>();
+
+            // 高频位置事件按时间窗口合并后再推送
+            sse_coalescer_ = std::make_unique<EventCoalescer>(sse_coalescing_options_,
+                [this](const std::vector<BusEvent>& events) { ForwardEventsToSse(events); });
+            sse_coalescer_->Start();
+
+            EventBus::SubscriptionOptions sse_options;
+            sse_options.name = "sse";
+            sse_options.queue_capacity = sse_queue_capacity_;
+            sse_options.max_batch_size = sse_max_batch_size_;
+            sse_options.coalesce_topics.set(static_cast<size_t>(EventTopic::WINDOW_POSITION_CHANGED));
+            sse_options.coalesce_topics.set(static_cast<size_t>(EventTopic::SEAT_POSITION_CHANGED));
+            sse_subscription_ = event_bus_->Subscribe(sse_options, [this](const std::vector<BusEvent>& events) {
+                sse_coalescer_->Submit(events);
+            });
+        }
+
         // 设置响应处理器和事件处理器（即使没有SOME/IP连接也需要）
         SetupResponseHandlers();
         SetupEventHandlers();
@@ -113,25 +143,165 @@ void ApiHandlers::SetHttpServer(std::shared_ptr<HttpServer> http_server) {
     std::cout << "[ApiHandlers] HTTP server reference set for SSE event pushing" << std::endl;
 }
 
+std::shared_ptr<EventBus> ApiHandlers::GetEventBus() const {
+    return event_bus_;
+}
+
+void ApiHandlers::SetSseCoalescingOptions(const EventCoalescer::Options& options) {
+    sse_coalescing_options_ = options;
+}
+
+void ApiHandlers::ApplyConfig(const WebServerConfig& config) {
+    sse_coalescing_options_.enabled = config.sse_coalesce_window_ms > 0;
+    sse_coalescing_options_.window = std::chrono::milliseconds(config.sse_coalesce_window_ms);
+    sse_queue_capacity_ = config.sse_queue_capacity;
+    sse_max_batch_size_ = config.sse_max_batch_size;
+
+    communication::SomeipClient::ClientPolicy base;
+    base.default_timeout_ms = config.method_call_timeout_ms;
+    base.max_retry_attempts = config.max_retry_attempts;
+    base.circuit_breaker.open_duration_ms = config.circuit_open_duration_ms;
+    base.max_in_flight = config.max_in_flight;
+    base.latency_budget_ms = {{config.safety_budget_ms, config.control_budget_ms, config.query_budget_ms}};
+
+    client_policies_.clear();
+    for (uint16_t service_id : {communication::DOOR_SERVICE_ID, communication::WINDOW_SERVICE_ID,
+                                communication::LIGHT_SERVICE_ID, communication::SEAT_SERVICE_ID}) {
+        client_policies_[service_id] = base;
+    }
+    for (const auto& [key, timeout_ms] : config.method_timeouts_ms) {
+        auto it = client_policies_.find(static_cast<uint16_t>(key >> 16));
+        if (it != client_policies_.end()) {
+            it->second.method_timeouts_ms[static_cast<uint16_t>(key & 0xFFFF)] = timeout_ms;
+        }
+    }
+
+    // 运行期间重新加载配置时直接替换客户端策略快照和合并窗口；
+    // SSE缓冲区容量只在创建订阅时生效
+    ApplyClientPolicies();
+    if (sse_coalescer_) {
+        sse_coalescer_->SetWindow(sse_coalescing_options_.enabled ? sse_coalescing_options_.window
+                                                                  : std::chrono::milliseconds(0));
+    }
+}
+
+void ApiHandlers::ApplyClientPolicies() {
+    const std::pair<uint16_t, communication::SomeipClient*> clients[] = {
+        {communication::DOOR_SERVICE_ID, door_client_.get()},
+        {communication::WINDOW_SERVICE_ID, window_client_.get()},
+        {communication::LIGHT_SERVICE_ID, light_client_.get()},
+        {communication::SEAT_SERVICE_ID, seat_client_.get()},
+    };
+    for (const auto& entry : clients) {
+        auto policy = client_policies_.find(entry.first);
+        if (entry.second && policy != client_policies_.end()) {
+            entry.second->SetPolicy(policy->second);
+        }
+    }
+}
+
+nlohmann::json ApiHandlers::GetLaneMetrics() const {
+    const std::pair<const char*, const communication::SomeipClient*> clients[] = {
+        {"door", door_client_.get()},
+        {"window", window_client_.get()},
+        {"light", light_client_.get()},
+        {"seat", seat_client_.get()},
+    };
+
+    nlohmann::json result = nlohmann::json::object();
+    for (const auto& entry : clients) {
+        if (!entry.second) {
+            continue;
+        }
+        nlohmann::json lanes = nlohmann::json::object();
+        for (size_t i = 0; i < communication::COMMAND_CLASS_COUNT; ++i) {
+            const auto command_class = static_cast<communication::CommandClass>(i);
+            const auto stats = entry.second->GetLaneStats(command_class);
+            lanes[communication::ToString(command_class)] = {
+                {"dispatched", stats.dispatched},
+                {"completed", stats.completed},
+                {"failed", stats.failed},
+                {"over_budget", stats.over_budget},
+                {"queued", stats.queued},
+                {"p50_latency_us", stats.p50_latency_us},
+                {"p99_latency_us", stats.p99_latency_us}
+            };
+        }
+        result[entry.first] = lanes;
+    }
+    return result;
+}
+
+// ============================================================================
+// 请求适配
+// ============================================================================
+
+template<typename ResponseType>
+communication::SomeipClient::ResponseCallback<ResponseType> ApiHandlers::MakeClientCallback(
+    std::function<void(const ResponseType&)> callback) {
+    // 捕获调用线程的请求上下文，失败状态经on_failure交还给HTTP层
+    const communication::RequestContext context = communication::RequestContext::Current();
+    return [callback, context](communication::CallbackStatus status, const ResponseType& response) {
+        if (status != communication::CallbackStatus::COMPLETED) {
+            context.NotifyFailure(status);
+            return;
+        }
+        if (callback) {
+            callback(response);
+        }
+    };
+}
+
+template<typename Client, typename Request, typename ResponseType>
+ActuatorCommandQueue::Sender<ResponseType> ApiHandlers::MakeSender(
+    std::shared_ptr<Client> client,
+    bool (Client::*method)(const Request&, communication::SomeipClient::ResponseCallback<ResponseType>, uint32_t),
+    const Request& request) {
+    // 截止时间随命令进入队列，真正发送时再计算剩余预算
+    const auto deadline = communication::RequestContext::Current().deadline;
+    return [client, method, request, deadline](communication::SomeipClient::ResponseCallback<ResponseType> completion) {
+        communication::RequestContext budget;
+        budget.deadline = deadline;
+        if (budget.Expired()) {
+            completion(communication::CallbackStatus::TIMEOUT, ResponseType{});
+            return;
+        }
+        ((*client).*method)(request, std::move(completion), budget.RemainingMs());
+    };
+}
+
+std::string ApiHandlers::MakeQueryKey(uint16_t service_id, uint16_t method_id, const std::vector<uint8_t>& payload) {
+    std::string key;
+    key.reserve(4 + payload.size());
+    key.push_back(static_cast<char>(service_id >> 8));
+    key.push_back(static_cast<char>(service_id & 0xFF));
+    key.push_back(static_cast<char>(method_id >> 8));
+    key.push_back(static_cast<char>(method_id & 0xFF));
+    key.append(payload.begin(), payload.end());
+    return key;
+}
+
 // ============================================================================
 // 车门服务处理
 // ============================================================================
 
 void ApiHandlers::HandleDoorLockRequest(const application::SetLockStateReq& request,
                                         std::function<void(const application::SetLockStateResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleDoorLockRequest called for door " << static_cast<int>(request.doorID) << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleDoorLockRequest called for door " << static_cast<int>(request.doorID) << std::endl;
+    }
 
     // 检查门服务是否可用
     if (!door_client_ || !running_ || !IsDoorServiceAvailable()) {
-        std::cout << "[ApiHandlers] Door service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Door service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::SetLockStateResp mock_response;
             mock_response.doorID = request.doorID;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock door lock response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock door lock callback completed" << std::endl;
 
             // 推送SSE事件（模拟状态变化）
             if (auto http_server = http_server_.lock()) {
@@ -144,60 +314,54 @@ void ApiHandlers::HandleDoorLockRequest(const application::SetLockStateReq& requ
         return;
     }
 
-    std::cout << "[ApiHandlers] Door service is available, setting up real request..." << std::endl;
-
-    // 使用shared_ptr确保回调函数的生命周期
-    auto shared_callback = std::make_shared<std::function<void(const application::SetLockStateResp&)>>(callback);
-
-    // 设置临时响应处理器
-    door_client_->SetSetLockStateResponseHandler([shared_callback](const application::SetLockStateResp& response) {
-        std::cout << "[ApiHandlers] Received door lock response from client" << std::endl;
-        if (shared_callback && *shared_callback) {
-            (*shared_callback)(response);
-        }
-    });
-
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending door lock request to client..." << std::endl;
-    door_client_->SetLockState(request);
-    std::cout << "[ApiHandlers] Door lock request sent" << std::endl;
+    // 同一执行器的命令逐条发送，保持提交顺序
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::DOOR_SERVICE_ID, static_cast<uint16_t>(request.doorID));
+    command_queue_.Submit<application::SetLockStateResp>(key,
+        MakeSender(door_client_, &communication::DoorServiceClient::SetLockState, request),
+        MakeClientCallback(std::move(callback)));
 }
 
 void ApiHandlers::HandleDoorStatusRequest(const application::GetLockStateReq& request,
                                          std::function<void(const application::GetLockStateResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleDoorStatusRequest called for door " << static_cast<int>(request.doorID) << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleDoorStatusRequest called for door " << static_cast<int>(request.doorID) << std::endl;
+    }
 
     // 检查门服务是否可用
     if (!door_client_ || !running_ || !IsDoorServiceAvailable()) {
-        std::cout << "[ApiHandlers] Door service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Door service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::GetLockStateResp mock_response;
             mock_response.doorID = request.doorID;
             mock_response.lockState = application::LockState::LOCKED; // 模拟锁定状态
-            std::cout << "[ApiHandlers] Calling callback with mock response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock callback completed" << std::endl;
         } else {
             std::cout << "[ApiHandlers] ERROR: Callback is null!" << std::endl;
         }
         return;
     }
 
-    std::cout << "[ApiHandlers] Door service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    door_client_->SetGetLockStateResponseHandler([callback](const application::GetLockStateResp& response) {
-        std::cout << "[ApiHandlers] Received response from door client" << std::endl;
+    // 稳态下由字段通知维护的本地镜像直接应答，无需SOME/IP往返
+    application::LockState lock_state;
+    if (door_client_->GetCachedLockState(request.doorID, lock_state)) {
         if (callback) {
-            callback(response);
+            callback(application::GetLockStateResp(request.doorID, lock_state));
         }
-    });
+        return;
+    }
 
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to door client..." << std::endl;
-    door_client_->GetLockState(request);
-    std::cout << "[ApiHandlers] Request sent" << std::endl;
+    // 镜像尚未填充：相同车门的并发查询共享同一个在途SOME/IP getter调用
+    const std::string key = MakeQueryKey(body_controller::communication::DOOR_SERVICE_ID,
+                                         body_controller::communication::door_service::GET_LOCK_STATE,
+                                         communication::Serializer::Serialize(request));
+    const bool launched = door_status_flights_.Do(key, MakeClientCallback(std::move(callback)),
+        MakeSender(door_client_, &communication::DoorServiceClient::GetLockState, request));
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] Door status request " << (launched ? "sent" : "joined in-flight query") << std::endl;
+    }
 }
 
 // ============================================================================
@@ -205,38 +369,51 @@ void ApiHandlers::HandleDoorStatusRequest(const application::GetLockStateReq& re
 // ============================================================================
 
 void ApiHandlers::HandleWindowPositionRequest(const application::SetWindowPositionReq& request,
-                                              std::function<void(const application::SetWindowPositionResp&)> callback) {
+                                              std::function<void(const SetWindowPositionResult&)> callback) {
     if (!window_client_) {
         std::cerr << "[ApiHandlers] Window service client not available" << std::endl;
         return;
     }
     
-    // 设置临时响应处理器
-    window_client_->SetSetWindowPositionResponseHandler([callback](const application::SetWindowPositionResp& response) {
-        if (callback) {
-            callback(response);
-        }
-    });
-    
-    // 发送请求
-    window_client_->SetWindowPosition(request);
+    // 设定值命令：同一车窗排队中的旧目标被最新目标替换，每个提交者都能看到实际执行的命令
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::WINDOW_SERVICE_ID, static_cast<uint16_t>(request.windowID));
+    const communication::RequestContext context = communication::RequestContext::Current();
+    command_queue_.SubmitSetPoint<application::SetWindowPositionResp>(key, body_controller::communication::window_service::SET_WINDOW_POSITION,
+        MakeSender(window_client_, &communication::WindowServiceClient::SetWindowPosition, request),
+        [callback = std::move(callback), context](communication::CallbackStatus status,
+                                                  const application::SetWindowPositionResp& response,
+                                                  const ActuatorCommandQueue::SetPointOutcome& outcome) {
+            if (status != communication::CallbackStatus::COMPLETED) {
+                context.NotifyFailure(status);
+                return;
+            }
+            if (callback) {
+                SetWindowPositionResult result;
+                result.response = response;
+                result.commandID = outcome.executed_id;
+                result.collapsed = outcome.Collapsed();
+                callback(result);
+            }
+        });
 }
 
 void ApiHandlers::HandleWindowControlRequest(const application::ControlWindowReq& request,
                                              std::function<void(const application::ControlWindowResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleWindowControlRequest called for window " << static_cast<int>(request.windowID) << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleWindowControlRequest called for window " << static_cast<int>(request.windowID) << std::endl;
+    }
 
     // 检查窗口服务是否可用
     if (!window_client_ || !running_ || !IsWindowServiceAvailable()) {
-        std::cout << "[ApiHandlers] Window service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Window service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::ControlWindowResp mock_response;
             mock_response.windowID = request.windowID;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock window control response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock window control callback completed" << std::endl;
 
             // 推送SSE事件（模拟状态变化）
             if (auto http_server = http_server_.lock()) {
@@ -255,57 +432,54 @@ void ApiHandlers::HandleWindowControlRequest(const application::ControlWindowReq
         return;
     }
 
-    std::cout << "[ApiHandlers] Window service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    window_client_->SetControlWindowResponseHandler([callback](const application::ControlWindowResp& response) {
-        std::cout << "[ApiHandlers] Received window control response from client" << std::endl;
-        if (callback) {
-            callback(response);
-        }
-    });
-
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending window control request to client..." << std::endl;
-    window_client_->ControlWindow(request);
-    std::cout << "[ApiHandlers] Window control request sent" << std::endl;
+    // 同一执行器的命令逐条发送，保持提交顺序
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::WINDOW_SERVICE_ID, static_cast<uint16_t>(request.windowID));
+    command_queue_.Submit<application::ControlWindowResp>(key,
+        MakeSender(window_client_, &communication::WindowServiceClient::ControlWindow, request),
+        MakeClientCallback(std::move(callback)));
 }
 
 void ApiHandlers::HandleWindowPositionStatusRequest(const application::GetWindowPositionReq& request,
                                                     std::function<void(const application::GetWindowPositionResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleWindowPositionStatusRequest called for window " << static_cast<int>(request.windowID) << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleWindowPositionStatusRequest called for window " << static_cast<int>(request.windowID) << std::endl;
+    }
 
     // 检查窗口服务是否可用
     if (!window_client_ || !running_ || !IsWindowServiceAvailable()) {
-        std::cout << "[ApiHandlers] Window service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Window service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::GetWindowPositionResp mock_response;
             mock_response.windowID = request.windowID;
             mock_response.position = 50; // 模拟50%位置
-            std::cout << "[ApiHandlers] Calling callback with mock window response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock window callback completed" << std::endl;
         } else {
             std::cout << "[ApiHandlers] ERROR: Window callback is null!" << std::endl;
         }
         return;
     }
 
-    std::cout << "[ApiHandlers] Window service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    window_client_->SetGetWindowPositionResponseHandler([callback](const application::GetWindowPositionResp& response) {
-        std::cout << "[ApiHandlers] Received response from window client" << std::endl;
+    // 稳态下由字段通知维护的本地镜像直接应答，无需SOME/IP往返
+    uint8_t position = 0;
+    if (window_client_->GetCachedWindowPosition(request.windowID, position)) {
         if (callback) {
-            callback(response);
+            callback(application::GetWindowPositionResp(request.windowID, position));
         }
-    });
+        return;
+    }
 
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to window client..." << std::endl;
-    window_client_->GetWindowPosition(request);
-    std::cout << "[ApiHandlers] Window request sent" << std::endl;
+    // 镜像尚未填充：相同车窗的并发查询共享同一个在途SOME/IP getter调用
+    const std::string key = MakeQueryKey(body_controller::communication::WINDOW_SERVICE_ID,
+                                         body_controller::communication::window_service::GET_WINDOW_POSITION,
+                                         communication::Serializer::Serialize(request));
+    const bool launched = window_status_flights_.Do(key, MakeClientCallback(std::move(callback)),
+        MakeSender(window_client_, &communication::WindowServiceClient::GetWindowPosition, request));
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] Window status request " << (launched ? "sent" : "joined in-flight query") << std::endl;
+    }
 }
 
 // ============================================================================
@@ -314,18 +488,20 @@ void ApiHandlers::HandleWindowPositionStatusRequest(const application::GetWindow
 
 void ApiHandlers::HandleHeadlightRequest(const application::SetHeadlightStateReq& request,
                                          std::function<void(const application::SetHeadlightStateResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleHeadlightRequest called" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleHeadlightRequest called" << std::endl;
+    }
 
     // 检查灯光服务是否可用
     if (!light_client_ || !running_ || !IsLightServiceAvailable()) {
-        std::cout << "[ApiHandlers] Light service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Light service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::SetHeadlightStateResp mock_response;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock headlight response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock headlight callback completed" << std::endl;
 
             // 推送SSE事件（模拟状态变化）
             if (auto http_server = http_server_.lock()) {
@@ -338,36 +514,29 @@ void ApiHandlers::HandleHeadlightRequest(const application::SetHeadlightStateReq
         return;
     }
 
-    std::cout << "[ApiHandlers] Light service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    light_client_->SetSetHeadlightStateResponseHandler([callback](const application::SetHeadlightStateResp& response) {
-        std::cout << "[ApiHandlers] Received response from light client" << std::endl;
-        if (callback) {
-            callback(response);
-        }
-    });
-
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to light client..." << std::endl;
-    light_client_->SetHeadlightState(request);
-    std::cout << "[ApiHandlers] Request sent" << std::endl;
+    // 同一执行器的命令逐条发送，保持提交顺序
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::light_service::SET_HEADLIGHT_STATE);
+    command_queue_.Submit<application::SetHeadlightStateResp>(key,
+        MakeSender(light_client_, &communication::LightServiceClient::SetHeadlightState, request),
+        MakeClientCallback(std::move(callback)));
 }
 
 void ApiHandlers::HandleIndicatorRequest(const application::SetIndicatorStateReq& request,
                                         std::function<void(const application::SetIndicatorStateResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleIndicatorRequest called" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleIndicatorRequest called" << std::endl;
+    }
 
     // 检查灯光服务是否可用
     if (!light_client_ || !running_ || !IsLightServiceAvailable()) {
-        std::cout << "[ApiHandlers] Light service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Light service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::SetIndicatorStateResp mock_response;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock indicator response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock indicator callback completed" << std::endl;
 
             // 推送SSE事件（模拟状态变化）
             if (auto http_server = http_server_.lock()) {
@@ -380,36 +549,29 @@ void ApiHandlers::HandleIndicatorRequest(const application::SetIndicatorStateReq
         return;
     }
 
-    std::cout << "[ApiHandlers] Light service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    light_client_->SetSetIndicatorStateResponseHandler([callback](const application::SetIndicatorStateResp& response) {
-        std::cout << "[ApiHandlers] Received response from light client" << std::endl;
-        if (callback) {
-            callback(response);
-        }
-    });
-
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to light client..." << std::endl;
-    light_client_->SetIndicatorState(request);
-    std::cout << "[ApiHandlers] Request sent" << std::endl;
+    // 同一执行器的命令逐条发送，保持提交顺序
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::light_service::SET_INDICATOR_STATE);
+    command_queue_.Submit<application::SetIndicatorStateResp>(key,
+        MakeSender(light_client_, &communication::LightServiceClient::SetIndicatorState, request),
+        MakeClientCallback(std::move(callback)));
 }
 
 void ApiHandlers::HandlePositionLightRequest(const application::SetPositionLightStateReq& request,
                                              std::function<void(const application::SetPositionLightStateResp&)> callback) {
-    std::cout << "[ApiHandlers] HandlePositionLightRequest called" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandlePositionLightRequest called" << std::endl;
+    }
 
     // 检查灯光服务是否可用
     if (!light_client_ || !running_ || !IsLightServiceAvailable()) {
-        std::cout << "[ApiHandlers] Light service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Light service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::SetPositionLightStateResp mock_response;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock position light response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock position light callback completed" << std::endl;
 
             // 推送SSE事件（模拟状态变化）
             if (auto http_server = http_server_.lock()) {
@@ -422,20 +584,51 @@ void ApiHandlers::HandlePositionLightRequest(const application::SetPositionLight
         return;
     }
 
-    std::cout << "[ApiHandlers] Light service is available, setting up real request..." << std::endl;
+    // 同一执行器的命令逐条发送，保持提交顺序
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::LIGHT_SERVICE_ID, body_controller::communication::light_service::SET_POSITION_LIGHT_STATE);
+    command_queue_.Submit<application::SetPositionLightStateResp>(key,
+        MakeSender(light_client_, &communication::LightServiceClient::SetPositionLightState, request),
+        MakeClientCallback(std::move(callback)));
+}
+
+void ApiHandlers::HandleLightStatusRequest(const application::GetLightStateReq& request,
+                                          std::function<void(const application::GetLightStateResp&)> callback) {
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleLightStatusRequest called for light type " << static_cast<int>(request.lightType) << std::endl;
+    }
+
+    // 检查灯光服务是否可用
+    if (!light_client_ || !running_ || !IsLightServiceAvailable()) {
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Light service not available, returning mock response" << std::endl;
+        }
+        // 返回模拟响应
+        if (callback) {
+            callback(application::GetLightStateResp(request.lightType, 0)); // 模拟关闭状态
+        } else {
+            std::cout << "[ApiHandlers] ERROR: Light status callback is null!" << std::endl;
+        }
+        return;
+    }
 
-    // 设置临时响应处理器
-    light_client_->SetSetPositionLightStateResponseHandler([callback](const application::SetPositionLightStateResp& response) {
-        std::cout << "[ApiHandlers] Received response from light client" << std::endl;
+    // 稳态下由字段通知维护的本地镜像直接应答，无需SOME/IP往返
+    uint8_t state = 0;
+    if (light_client_->GetCachedLightState(request.lightType, state)) {
         if (callback) {
-            callback(response);
+            callback(application::GetLightStateResp(request.lightType, state));
         }
-    });
+        return;
+    }
 
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to light client..." << std::endl;
-    light_client_->SetPositionLightState(request);
-    std::cout << "[ApiHandlers] Request sent" << std::endl;
+    // 镜像尚未填充：相同灯光类型的并发查询共享同一个在途SOME/IP getter调用
+    const std::string key = MakeQueryKey(body_controller::communication::LIGHT_SERVICE_ID,
+                                         body_controller::communication::light_service::GET_LIGHT_STATE,
+                                         communication::Serializer::Serialize(request));
+    const bool launched = light_status_flights_.Do(key, MakeClientCallback(std::move(callback)),
+        MakeSender(light_client_, &communication::LightServiceClient::GetLightState, request));
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] Light status request " << (launched ? "sent" : "joined in-flight query") << std::endl;
+    }
 }
 
 // ============================================================================
@@ -444,23 +637,25 @@ void ApiHandlers::HandlePositionLightRequest(const application::SetPositionLight
 
 void ApiHandlers::HandleSeatAdjustRequest(const application::AdjustSeatReq& request,
                                           std::function<void(const application::AdjustSeatResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleSeatAdjustRequest called" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleSeatAdjustRequest called" << std::endl;
+    }
 
     // 检查座椅服务是否可用
     if (!seat_client_ || !running_ || !IsSeatServiceAvailable()) {
-        std::cout << "[ApiHandlers] Seat service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Seat service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::AdjustSeatResp mock_response;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock seat adjust response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock seat adjust callback completed" << std::endl;
 
             // 推送SSE事件（模拟状态变化）
             if (auto http_server = http_server_.lock()) {
                 std::string position_info = "adjusted";
-                http_server->PushSeatPositionEvent(0, position_info); // 假设座椅ID为0
+                http_server->PushSeatPositionEvent(static_cast<int>(request.seatID), position_info);
             }
         } else {
             std::cout << "[ApiHandlers] ERROR: Seat adjust callback is null!" << std::endl;
@@ -468,92 +663,72 @@ void ApiHandlers::HandleSeatAdjustRequest(const application::AdjustSeatReq& requ
         return;
     }
 
-    std::cout << "[ApiHandlers] Seat service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    seat_client_->SetAdjustSeatResponseHandler([callback](const application::AdjustSeatResp& response) {
-        std::cout << "[ApiHandlers] Received response from seat client" << std::endl;
-        if (callback) {
-            callback(response);
-        }
-    });
-
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to seat client..." << std::endl;
-    seat_client_->AdjustSeat(request);
-    std::cout << "[ApiHandlers] Request sent" << std::endl;
+    // 同一座椅的命令逐条发送，保持提交顺序；不同座椅互不排队
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::SEAT_SERVICE_ID,
+                                                   static_cast<uint16_t>(request.seatID));
+    command_queue_.Submit<application::AdjustSeatResp>(key,
+        MakeSender(seat_client_, &communication::SeatServiceClient::AdjustSeat, request),
+        MakeClientCallback(std::move(callback)));
 }
 
 void ApiHandlers::HandleSeatMemoryRecallRequest(const application::RecallMemoryPositionReq& request,
                                                 std::function<void(const application::RecallMemoryPositionResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleSeatMemoryRecallRequest called" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleSeatMemoryRecallRequest called" << std::endl;
+    }
 
     // 检查座椅服务是否可用
     if (!seat_client_ || !running_ || !IsSeatServiceAvailable()) {
-        std::cout << "[ApiHandlers] Seat service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Seat service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::RecallMemoryPositionResp mock_response;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock seat memory recall response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock seat memory recall callback completed" << std::endl;
         } else {
             std::cout << "[ApiHandlers] ERROR: Seat memory recall callback is null!" << std::endl;
         }
         return;
     }
 
-    std::cout << "[ApiHandlers] Seat service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    seat_client_->SetRecallMemoryPositionResponseHandler([callback](const application::RecallMemoryPositionResp& response) {
-        std::cout << "[ApiHandlers] Received response from seat client" << std::endl;
-        if (callback) {
-            callback(response);
-        }
-    });
-
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to seat client..." << std::endl;
-    seat_client_->RecallMemoryPosition(request);
-    std::cout << "[ApiHandlers] Request sent" << std::endl;
+    // 同一座椅的命令逐条发送，保持提交顺序；不同座椅互不排队
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::SEAT_SERVICE_ID,
+                                                   static_cast<uint16_t>(request.seatID));
+    command_queue_.Submit<application::RecallMemoryPositionResp>(key,
+        MakeSender(seat_client_, &communication::SeatServiceClient::RecallMemoryPosition, request),
+        MakeClientCallback(std::move(callback)));
 }
 
 void ApiHandlers::HandleSeatMemorySaveRequest(const application::SaveMemoryPositionReq& request,
                                               std::function<void(const application::SaveMemoryPositionResp&)> callback) {
-    std::cout << "[ApiHandlers] HandleSeatMemorySaveRequest called" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[ApiHandlers] HandleSeatMemorySaveRequest called" << std::endl;
+    }
 
     // 检查座椅服务是否可用
     if (!seat_client_ || !running_ || !IsSeatServiceAvailable()) {
-        std::cout << "[ApiHandlers] Seat service not available, returning mock response" << std::endl;
+        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+            std::cout << "[ApiHandlers] Seat service not available, returning mock response" << std::endl;
+        }
         // 返回模拟响应
         if (callback) {
             application::SaveMemoryPositionResp mock_response;
             mock_response.result = application::Result::SUCCESS; // 模拟成功
-            std::cout << "[ApiHandlers] Calling callback with mock seat memory save response..." << std::endl;
             callback(mock_response);
-            std::cout << "[ApiHandlers] Mock seat memory save callback completed" << std::endl;
         } else {
             std::cout << "[ApiHandlers] ERROR: Seat memory save callback is null!" << std::endl;
         }
         return;
     }
 
-    std::cout << "[ApiHandlers] Seat service is available, setting up real request..." << std::endl;
-
-    // 设置临时响应处理器
-    seat_client_->SetSaveMemoryPositionResponseHandler([callback](const application::SaveMemoryPositionResp& response) {
-        std::cout << "[ApiHandlers] Received response from seat client" << std::endl;
-        if (callback) {
-            callback(response);
-        }
-    });
-
-    // 发送请求
-    std::cout << "[ApiHandlers] Sending request to seat client..." << std::endl;
-    seat_client_->SaveMemoryPosition(request);
-    std::cout << "[ApiHandlers] Request sent" << std::endl;
+    // 同一座椅的命令逐条发送，保持提交顺序；不同座椅互不排队
+    const auto key = ActuatorCommandQueue::MakeKey(body_controller::communication::SEAT_SERVICE_ID,
+                                                   static_cast<uint16_t>(request.seatID));
+    command_queue_.Submit<application::SaveMemoryPositionResp>(key,
+        MakeSender(seat_client_, &communication::SeatServiceClient::SaveMemoryPosition, request),
+        MakeClientCallback(std::move(callback)));
 }
 
 // ============================================================================
@@ -587,86 +762,91 @@ bool ApiHandlers::IsSeatServiceAvailable() const {
 // ============================================================================
 
 void ApiHandlers::SetupResponseHandlers() {
-    // 响应处理器在每次请求时动态设置，这里不需要设置全局处理器
+    // 响应由客户端的挂起请求注册表按会话ID分发给各自请求的回调，
+    // 不再在每次请求时覆盖客户端的全局响应处理器
     std::cout << "[ApiHandlers] Response handlers setup completed" << std::endl;
 }
 
 void ApiHandlers::SetupEventHandlers() {
-    // 设置事件处理器，用于WebSocket广播
+    // 事件回调运行在vsomeip分发线程上，只发布到事件总线，不做任何阻塞操作
+    if (!event_bus_) {
+        return;
+    }
+    auto bus = event_bus_;
+
     if (door_client_) {
-        door_client_->SetLockStateChangedHandler([this](const application::OnLockStateChangedData& data) {
-            BroadcastEvent("door_lock_changed", JsonConverter::ToJson(data));
+        door_client_->SetLockStateChangedHandler([bus](const application::OnLockStateChangedData& data) {
+            bus->Publish(data);
         });
         
-        door_client_->SetDoorStateChangedHandler([this](const application::OnDoorStateChangedData& data) {
-            BroadcastEvent("door_state_changed", JsonConverter::ToJson(data));
+        door_client_->SetDoorStateChangedHandler([bus](const application::OnDoorStateChangedData& data) {
+            bus->Publish(data);
         });
     }
     
     if (window_client_) {
-        window_client_->SetWindowPositionChangedHandler([this](const application::OnWindowPositionChangedData& data) {
-            BroadcastEvent("window_position_changed", JsonConverter::ToJson(data));
+        window_client_->SetWindowPositionChangedHandler([bus](const application::OnWindowPositionChangedData& data) {
+            bus->Publish(data);
         });
     }
     
     if (light_client_) {
-        light_client_->SetLightStateChangedHandler([this](const application::OnLightStateChangedData& data) {
-            BroadcastEvent("light_state_changed", JsonConverter::ToJson(data));
+        light_client_->SetLightStateChangedHandler([bus](const application::OnLightStateChangedData& data) {
+            bus->Publish(data);
         });
     }
     
     if (seat_client_) {
-        seat_client_->SetSeatPositionChangedHandler([this](const application::OnSeatPositionChangedData& data) {
-            BroadcastEvent("seat_position_changed", JsonConverter::ToJson(data));
+        seat_client_->SetSeatPositionChangedHandler([bus](const application::OnSeatPositionChangedData& data) {
+            bus->Publish(data);
         });
         
-        seat_client_->SetMemorySaveConfirmHandler([this](const application::OnMemorySaveConfirmData& data) {
-            BroadcastEvent("seat_memory_save_confirm", JsonConverter::ToJson(data));
+        seat_client_->SetMemorySaveConfirmHandler([bus](const application::OnMemorySaveConfirmData& data) {
+            bus->Publish(data);
+        });
+        
+        seat_client_->SetRecallCompleteHandler([bus](const application::OnSeatRecallCompleteData& data) {
+            bus->Publish(data);
         });
     }
     
     std::cout << "[ApiHandlers] Event handlers setup completed" << std::endl;
 }
 
-void ApiHandlers::BroadcastEvent(const std::string& event_type, const nlohmann::json& data) {
+void ApiHandlers::ForwardEventsToSse(const std::vector<BusEvent>& events) {
     // 将SOME/IP事件映射并通过SSE推送到前端
-    std::cout << "[ApiHandlers] Event broadcast via SSE: " << event_type << std::endl;
-    if (auto http = http_server_.lock()) {
+    auto http = http_server_.lock();
+    if (!http) {
+        return;
+    }
+
+    for (const auto& event : events) {
         try {
-            if (event_type == "door_lock_changed") {
-                const int door_id = data.value("doorID", 0);
-                const bool lock_state = data.value("lockState", false);
-                http->PushDoorLockEvent(door_id, lock_state);
-                return;
-            }
-            if (event_type == "window_position_changed") {
-                const int window_id = data.value("windowID", 0);
-                const int position = data.value("position", 0);
-                http->PushWindowPositionEvent(window_id, position);
-                return;
-            }
-            if (event_type == "light_state_changed") {
-                // 若数据包含细分类型，可读取；否则默认"headlight"
-                const std::string light_type = data.value("lightType", std::string("headlight"));
-                const bool state = data.contains("state") ? data["state"].get<bool>()
-                                  : data.value("newState", 0) != 0;
-                http->PushLightStateEvent(light_type, state);
-                return;
-            }
-            if (event_type == "seat_position_changed") {
-                const int seat_id = data.value("seatID", 0);
-                const std::string position = data.contains("position") ? data["position"].dump() : data.dump();
-                http->PushSeatPositionEvent(seat_id, position);
-                return;
+            if (auto data = event.As<application::OnLockStateChangedData>()) {
+                http->PushDoorLockEvent(static_cast<int>(data->doorID),
+                                        data->newLockState == application::LockState::LOCKED);
+            } else if (auto data = event.As<application::OnWindowPositionChangedData>()) {
+                http->PushWindowPositionEvent(static_cast<int>(data->windowID), data->newPosition);
+            } else if (auto data = event.As<application::OnLightStateChangedData>()) {
+                const char* light_type = "headlight";
+                if (data->lightType == application::LightType::INDICATOR) {
+                    light_type = "indicator";
+                } else if (data->lightType == application::LightType::POSITION_LIGHT) {
+                    light_type = "position";
+                }
+                http->PushLightStateEvent(light_type, data->newState != 0);
+            } else if (auto data = event.As<application::OnSeatPositionChangedData>()) {
+                http->PushSeatPositionEvent(static_cast<int>(data->seatID), std::string(FastJsonCodec::Encode(*data)));
+            } else if (auto data = event.As<application::OnDoorStateChangedData>()) {
+                http->PublishEvent("door_state_changed", JsonConverter::ToJson(*data));
+            } else if (auto data = event.As<application::OnMemorySaveConfirmData>()) {
+                http->PublishEvent("seat_memory_save_confirm", JsonConverter::ToJson(*data));
+            } else if (auto data = event.As<application::OnSeatRecallCompleteData>()) {
+                http->PublishEvent("seat_recall_complete", JsonConverter::ToJson(*data));
             }
-
-            // 未识别事件：走通用事件发布
-            http->PublishEvent(event_type, data);
         } catch (const std::exception& e) {
-            std::cerr << "[ApiHandlers] BroadcastEvent error: " << e.what() << std::endl;
+            std::cerr << "[ApiHandlers] SSE forward error (" << ToString(event.topic) << "): " << e.what() << std::endl;
         }
-    } else {
-        std::cout << "[ApiHandlers] HTTP server not available for SSE push" << std::endl;
     }
 }
 
@@ -0,0 +1,99 @@
+#include "web_api/body_codec.h"
+#include <algorithm>
+#include <cctype>
+
+namespace body_controller {
+namespace web_api {
+
+namespace {
+
+std::string ToLower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+/**
+ * @brief 将单个媒体类型（可带参数）映射为格式
+ * @return 识别成功返回true
+ */
+bool MatchMediaType(const std::string& media_type, BodyFormat& format) {
+    std::string type = ToLower(media_type.substr(0, media_type.find(';')));
+    type.erase(0, type.find_first_not_of(" \t"));
+    type.erase(type.find_last_not_of(" \t") + 1);
+
+    if (type == "application/msgpack" || type == "application/x-msgpack" ||
+        type == "application/vnd.msgpack") {
+        format = BodyFormat::MSGPACK;
+        return true;
+    }
+    if (type == "application/cbor") {
+        format = BodyFormat::CBOR;
+        return true;
+    }
+    if (type == "application/json" || type == "text/event-stream") {
+        format = BodyFormat::JSON;
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+BodyFormat BodyCodec::FromContentType(const std::string& content_type) {
+    BodyFormat format = BodyFormat::JSON;
+    MatchMediaType(content_type, format);
+    return format;
+}
+
+BodyFormat BodyCodec::FromAccept(const std::string& accept) {
+    size_t start = 0;
+    while (start <= accept.size()) {
+        size_t end = accept.find(',', start);
+        if (end == std::string::npos) {
+            end = accept.size();
+        }
+        BodyFormat format = BodyFormat::JSON;
+        if (MatchMediaType(accept.substr(start, end - start), format)) {
+            return format;
+        }
+        start = end + 1;
+    }
+    return BodyFormat::JSON;
+}
+
+const char* BodyCodec::GetContentType(BodyFormat format) {
+    switch (format) {
+        case BodyFormat::MSGPACK: return "application/msgpack";
+        case BodyFormat::CBOR:    return "application/cbor";
+        case BodyFormat::JSON:    break;
+    }
+    return "application/json";
+}
+
+nlohmann::json BodyCodec::Parse(const std::string& body, BodyFormat format) {
+    switch (format) {
+        case BodyFormat::MSGPACK: return nlohmann::json::from_msgpack(body);
+        case BodyFormat::CBOR:    return nlohmann::json::from_cbor(body);
+        case BodyFormat::JSON:    break;
+    }
+    return nlohmann::json::parse(body);
+}
+
+std::string BodyCodec::Serialize(const nlohmann::json& value, BodyFormat format) {
+    std::string out;
+    switch (format) {
+        case BodyFormat::MSGPACK:
+            nlohmann::json::to_msgpack(value, out);
+            return out;
+        case BodyFormat::CBOR:
+            nlohmann::json::to_cbor(value, out);
+            return out;
+        case BodyFormat::JSON:
+            break;
+    }
+    return value.dump();
+}
+
+} // namespace web_api
+} // namespace body_controller
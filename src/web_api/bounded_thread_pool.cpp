@@ -0,0 +1,80 @@
+#include "web_api/bounded_thread_pool.h"
+#include <iostream>
+
+namespace body_controller {
+namespace web_api {
+
+BoundedThreadPool::BoundedThreadPool(size_t thread_count, size_t max_connections, std::shared_ptr<Stats> stats)
+    : max_connections_(max_connections)
+    , stats_(std::move(stats)) {
+    stats_->threads = thread_count;
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers_.emplace_back(&BoundedThreadPool::WorkerLoop, this);
+    }
+}
+
+BoundedThreadPool::~BoundedThreadPool() {
+    shutdown();
+}
+
+bool BoundedThreadPool::enqueue(std::function<void()> fn) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t admitted = tasks_.size() + stats_->active.load(std::memory_order_relaxed);
+        if (shutdown_ || (max_connections_ != 0 && admitted >= max_connections_)) {
+            stats_->rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        tasks_.push_back(std::move(fn));
+        stats_->queued.store(tasks_.size(), std::memory_order_relaxed);
+    }
+    cv_.notify_one();
+    return true;
+}
+
+void BoundedThreadPool::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_) {
+            return;
+        }
+        shutdown_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    stats_->threads = 0;
+}
+
+void BoundedThreadPool::WorkerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return shutdown_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+            stats_->queued.store(tasks_.size(), std::memory_order_relaxed);
+            stats_->active.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            std::cerr << "[BoundedThreadPool] Task error: " << e.what() << std::endl;
+        }
+
+        stats_->active.fetch_sub(1, std::memory_order_relaxed);
+        stats_->completed.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace web_api
+} // namespace body_controller
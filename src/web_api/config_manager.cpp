@@ -0,0 +1,650 @@
+#include "web_api/config_manager.h"
+#include "communication/log_level.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+
+namespace body_controller {
+namespace web_api {
+
+namespace {
+
+constexpr const char* DEFAULT_CONFIG_FILE = "./config/system_config.json";
+
+uint32_t ToUInt(const std::string& value) {
+    size_t pos = 0;
+    const unsigned long result = std::stoul(value, &pos, 0);
+    if (pos != value.size()) {
+        throw std::invalid_argument("trailing characters");
+    }
+    return static_cast<uint32_t>(result);
+}
+
+/**
+ * @brief 可由环境变量和命令行覆盖的配置项
+ */
+struct Option {
+    const char* cli;        ///< 命令行选项（nullptr表示仅环境变量）
+    const char* env;        ///< 环境变量名
+    const char* help;       ///< 说明
+    void (*apply)(WebServerConfig& config, const std::string& value);
+};
+
+const Option OPTIONS[] = {
+    {"--http-port", "BODY_CONTROLLER_HTTP_PORT", "HTTP server port",
+     [](WebServerConfig& c, const std::string& v) { c.http_port = static_cast<int>(ToUInt(v)); }},
+    {"--http-host", "BODY_CONTROLLER_HTTP_HOST", "HTTP listen address",
+     [](WebServerConfig& c, const std::string& v) { c.http_host = v; }},
+    {"--threads", "BODY_CONTROLLER_HTTP_THREADS", "HTTP worker threads (0 = CPU count)",
+     [](WebServerConfig& c, const std::string& v) { c.thread_pool_size = ToUInt(v); }},
+    {"--keep-alive-max", "BODY_CONTROLLER_KEEP_ALIVE_MAX", "Requests per keep-alive connection",
+     [](WebServerConfig& c, const std::string& v) { c.keep_alive_max_count = ToUInt(v); }},
+    {"--keep-alive-timeout", "BODY_CONTROLLER_KEEP_ALIVE_TIMEOUT_S", "Keep-alive idle timeout (s)",
+     [](WebServerConfig& c, const std::string& v) { c.keep_alive_timeout_s = ToUInt(v); }},
+    {"--max-connections", "BODY_CONTROLLER_MAX_CONNECTIONS", "Maximum active plus queued HTTP connections",
+     [](WebServerConfig& c, const std::string& v) { c.max_connections = ToUInt(v); }},
+    {"--shed-queue-depth", "BODY_CONTROLLER_SHED_QUEUE_DEPTH", "Queued connections before answering 503 (0 = off)",
+     [](WebServerConfig& c, const std::string& v) { c.shed_queue_depth = ToUInt(v); }},
+    {"--max-request-size", "BODY_CONTROLLER_MAX_REQUEST_SIZE", "Maximum request body size (bytes)",
+     [](WebServerConfig& c, const std::string& v) { c.max_request_size = ToUInt(v); }},
+    {"--request-timeout-ms", "BODY_CONTROLLER_REQUEST_TIMEOUT_MS", "API request deadline (ms)",
+     [](WebServerConfig& c, const std::string& v) { c.request_timeout_ms = ToUInt(v); }},
+    {"--sse-coalesce-ms", "BODY_CONTROLLER_SSE_COALESCE_MS", "Coalescing window for position events (0 = off)",
+     [](WebServerConfig& c, const std::string& v) { c.sse_coalesce_window_ms = ToUInt(v); }},
+    {"--sse-queue-capacity", "BODY_CONTROLLER_SSE_QUEUE_CAPACITY", "SSE subscriber ring buffer capacity",
+     [](WebServerConfig& c, const std::string& v) { c.sse_queue_capacity = ToUInt(v); }},
+    {"--method-timeout-ms", "BODY_CONTROLLER_METHOD_TIMEOUT_MS", "Default SOME/IP method timeout (ms)",
+     [](WebServerConfig& c, const std::string& v) { c.method_call_timeout_ms = ToUInt(v); }},
+    {"--web-root", "BODY_CONTROLLER_WEB_ROOT", "Static web content directory",
+     [](WebServerConfig& c, const std::string& v) { c.web_root = v; }},
+    {"--log-level", "BODY_CONTROLLER_LOG_LEVEL", "Log level (debug/info/warn/error)",
+     [](WebServerConfig& c, const std::string& v) { c.log_level = v; }},
+    {nullptr, "VSOMEIP_CONFIGURATION", "Path to vsomeip configuration file",
+     [](WebServerConfig& c, const std::string& v) { c.vsomeip_config_path = v; }},
+    {nullptr, "VSOMEIP_APPLICATION_NAME", "Application name for vsomeip",
+     [](WebServerConfig& c, const std::string& v) { c.vsomeip_app_name = v; }},
+};
+
+/**
+ * @brief 当前配置快照及启动时的加载来源
+ */
+struct RuntimeState {
+    std::shared_ptr<const WebServerConfig> snapshot = std::make_shared<const WebServerConfig>();
+    std::atomic<uint64_t> version{0};
+    std::mutex publish_mutex;                       ///< 发布与监听者通知串行执行
+    std::mutex update_mutex;                        ///< Reload/ApplyPatch的读-改-发布串行执行
+    std::vector<ConfigManager::ReloadListener> listeners;
+    std::string config_file = DEFAULT_CONFIG_FILE;
+    std::vector<std::string> args;                  ///< 启动时的命令行参数（含程序名）
+};
+
+RuntimeState& State() {
+    static RuntimeState state;
+    return state;
+}
+
+template<typename T>
+void Pin(const char* name, const T& current, T& next, std::vector<std::string>& pinned) {
+    if (!(current == next)) {
+        next = current;
+        pinned.push_back(name);
+    }
+}
+
+const Option* FindOption(const std::string& cli) {
+    for (const auto& option : OPTIONS) {
+        if (option.cli && cli == option.cli) {
+            return &option;
+        }
+    }
+    return nullptr;
+}
+
+void ApplyOption(WebServerConfig& config, const Option& option, const std::string& source,
+                 const std::string& value) {
+    try {
+        option.apply(config, value);
+    } catch (const std::exception&) {
+        std::cerr << "[ConfigManager] Invalid value '" << value << "' for " << source << ", ignored" << std::endl;
+    }
+}
+
+template<typename T>
+void Read(const nlohmann::json& section, const char* key, T& field) {
+    auto it = section.find(key);
+    if (it != section.end() && !it->is_null()) {
+        field = it->get<T>();
+    }
+}
+
+uint16_t ParseId(const nlohmann::json& value) {
+    if (value.is_string()) {
+        return static_cast<uint16_t>(ToUInt(value.get<std::string>()));
+    }
+    return value.get<uint16_t>();
+}
+
+std::string FormatId(uint16_t id) {
+    char buffer[8];
+    std::snprintf(buffer, sizeof(buffer), "0x%04X", id);
+    return buffer;
+}
+
+/**
+ * @brief 将override中与默认值不同的叶子覆盖到target
+ */
+void OverlayChanged(nlohmann::json& target, const nlohmann::json& defaults, const nlohmann::json& override) {
+    for (auto it = override.begin(); it != override.end(); ++it) {
+        auto def = defaults.find(it.key());
+        if (it->is_object()) {
+            if (!target.contains(it.key()) || !target[it.key()].is_object()) {
+                target[it.key()] = nlohmann::json::object();
+            }
+            OverlayChanged(target[it.key()], def != defaults.end() ? *def : nlohmann::json::object(), *it);
+        } else if (def == defaults.end() || *def != *it) {
+            target[it.key()] = *it;
+        }
+    }
+}
+
+} // namespace
+
+WebServerConfig ConfigManager::Load(int argc, char* argv[]) {
+    std::string config_file = GetEnvVar("BODY_CONTROLLER_CONFIG", DEFAULT_CONFIG_FILE);
+    const auto args = ParseCommandLine(argc, argv);
+    auto it = args.find("--config");
+    if (it != args.end() && !it->second.empty()) {
+        config_file = it->second;
+    }
+
+    {
+        auto& state = State();
+        std::lock_guard<std::mutex> lock(state.update_mutex);
+        state.config_file = config_file;
+        state.args.assign(argv, argv + argc);
+    }
+
+    WebServerConfig config = LoadFromFile(config_file);
+    ApplyEnvironment(config);
+    ApplyCommandLine(config, argc, argv);
+    return config;
+}
+
+WebServerConfig ConfigManager::LoadFromFile(const std::string& config_file) {
+    std::ifstream file(config_file);
+    if (!file) {
+        std::cout << "[ConfigManager] Config file " << config_file << " not found, using defaults" << std::endl;
+        return GetDefaultConfig();
+    }
+
+    try {
+        WebServerConfig config = LoadFromJson(nlohmann::json::parse(file));
+        std::cout << "[ConfigManager] Loaded configuration from " << config_file << std::endl;
+        return config;
+    } catch (const std::exception& e) {
+        std::cerr << "[ConfigManager] Failed to parse " << config_file << ": " << e.what() << std::endl;
+        return GetDefaultConfig();
+    }
+}
+
+WebServerConfig ConfigManager::LoadFromJson(const nlohmann::json& config_json) {
+    try {
+        return FromJson(config_json);
+    } catch (const std::exception& e) {
+        std::cerr << "[ConfigManager] Invalid configuration: " << e.what() << std::endl;
+        return GetDefaultConfig();
+    }
+}
+
+WebServerConfig ConfigManager::LoadFromEnvironment() {
+    WebServerConfig config = GetDefaultConfig();
+    ApplyEnvironment(config);
+    return config;
+}
+
+WebServerConfig ConfigManager::LoadFromCommandLine(int argc, char* argv[]) {
+    WebServerConfig config = GetDefaultConfig();
+    ApplyCommandLine(config, argc, argv);
+    return config;
+}
+
+void ConfigManager::ApplyEnvironment(WebServerConfig& config) {
+    for (const auto& option : OPTIONS) {
+        const std::string value = GetEnvVar(option.env);
+        if (!value.empty()) {
+            ApplyOption(config, option, option.env, value);
+        }
+    }
+}
+
+void ConfigManager::ApplyCommandLine(WebServerConfig& config, int argc, char* argv[]) {
+    for (const auto& [name, value] : ParseCommandLine(argc, argv)) {
+        if (name == "--config" || name == "--help") {
+            continue;
+        }
+        const Option* option = FindOption(name);
+        if (!option) {
+            std::cerr << "[ConfigManager] Unknown argument: " << name << std::endl;
+            continue;
+        }
+        ApplyOption(config, *option, name, value);
+    }
+}
+
+std::shared_ptr<const WebServerConfig> ConfigManager::GetSnapshot() {
+    return std::atomic_load_explicit(&State().snapshot, std::memory_order_acquire);
+}
+
+const WebServerConfig& ConfigManager::Current() {
+    thread_local uint64_t cached_version = 0;
+    thread_local std::shared_ptr<const WebServerConfig> cached;
+
+    const uint64_t version = State().version.load(std::memory_order_acquire);
+    if (!cached || version != cached_version) {
+        cached = GetSnapshot();
+        cached_version = version;
+    }
+    return *cached;
+}
+
+uint64_t ConfigManager::GetVersion() {
+    return State().version.load(std::memory_order_acquire);
+}
+
+void ConfigManager::Publish(const WebServerConfig& config) {
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.publish_mutex);
+
+    auto next = std::make_shared<WebServerConfig>(config);
+    const uint64_t version = state.version.load(std::memory_order_relaxed);
+    if (version != 0) {
+        const auto current = GetSnapshot();
+        for (const auto& name : PinStartupFields(*current, *next)) {
+            std::cerr << "[ConfigManager] " << name << " changed but only takes effect after restart" << std::endl;
+        }
+        if (ToJson(*next) == ToJson(*current)) {
+            std::cout << "[ConfigManager] Configuration unchanged (version " << version << ")" << std::endl;
+            return;
+        }
+    }
+
+    // 先替换快照再递增版本：看到新版本的读者一定能读到新快照
+    std::atomic_store_explicit(&state.snapshot, std::shared_ptr<const WebServerConfig>(next),
+                               std::memory_order_release);
+    state.version.store(version + 1, std::memory_order_release);
+    std::cout << "[ConfigManager] Published configuration version " << version + 1 << std::endl;
+
+    for (const auto& listener : state.listeners) {
+        try {
+            listener(*next);
+        } catch (const std::exception& e) {
+            std::cerr << "[ConfigManager] Reload listener error: " << e.what() << std::endl;
+        }
+    }
+}
+
+void ConfigManager::AddReloadListener(ReloadListener listener) {
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.publish_mutex);
+    state.listeners.push_back(std::move(listener));
+}
+
+bool ConfigManager::Reload(std::string& error_message) {
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.update_mutex);
+
+    // 严格加载：文件缺失或不完整（编辑器保存过程中）时不回退到默认值
+    std::ifstream file(state.config_file);
+    if (!file) {
+        error_message = "cannot open " + state.config_file;
+        return false;
+    }
+    WebServerConfig config;
+    try {
+        config = FromJson(nlohmann::json::parse(file));
+    } catch (const std::exception& e) {
+        error_message = "failed to parse " + state.config_file + ": " + e.what();
+        return false;
+    }
+
+    // 环境变量与命令行仍然覆盖配置文件
+    ApplyEnvironment(config);
+    std::vector<char*> argv;
+    for (auto& arg : state.args) {
+        argv.push_back(&arg[0]);
+    }
+    ApplyCommandLine(config, static_cast<int>(argv.size()), argv.data());
+
+    if (!ValidateConfig(config, error_message)) {
+        return false;
+    }
+    std::cout << "[ConfigManager] Reloading configuration from " << state.config_file << std::endl;
+    Publish(config);
+    return true;
+}
+
+bool ConfigManager::ApplyPatch(const nlohmann::json& patch, std::string& error_message) {
+    if (!patch.is_object()) {
+        error_message = "configuration patch must be a JSON object";
+        return false;
+    }
+
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.update_mutex);
+
+    WebServerConfig config;
+    try {
+        nlohmann::json merged = ToJson(*GetSnapshot());
+        merged.merge_patch(patch);
+        config = FromJson(merged);
+    } catch (const std::exception& e) {
+        error_message = std::string("invalid configuration patch: ") + e.what();
+        return false;
+    }
+
+    if (!ValidateConfig(config, error_message)) {
+        return false;
+    }
+    Publish(config);
+    return true;
+}
+
+std::string ConfigManager::GetConfigFile() {
+    auto& state = State();
+    std::lock_guard<std::mutex> lock(state.update_mutex);
+    return state.config_file;
+}
+
+std::vector<std::string> ConfigManager::PinStartupFields(const WebServerConfig& current, WebServerConfig& next) {
+    std::vector<std::string> pinned;
+    Pin("web_server.host", current.http_host, next.http_host, pinned);
+    Pin("web_server.port", current.http_port, next.http_port, pinned);
+    Pin("web_server.cors_enabled", current.enable_cors, next.enable_cors, pinned);
+    Pin("web_server.max_request_size", current.max_request_size, next.max_request_size, pinned);
+    Pin("web_server.max_connections", current.max_connections, next.max_connections, pinned);
+    Pin("web_server.thread_pool_size", current.thread_pool_size, next.thread_pool_size, pinned);
+    Pin("web_server.keep_alive_max_count", current.keep_alive_max_count, next.keep_alive_max_count, pinned);
+    Pin("web_server.keep_alive_timeout_s", current.keep_alive_timeout_s, next.keep_alive_timeout_s, pinned);
+    Pin("web_server.read_timeout_ms", current.read_timeout_ms, next.read_timeout_ms, pinned);
+    Pin("web_server.write_timeout_ms", current.write_timeout_ms, next.write_timeout_ms, pinned);
+    Pin("web_server.document_root", current.web_root, next.web_root, pinned);
+    Pin("web_server.static_max_age_s", current.static_max_age_s, next.static_max_age_s, pinned);
+    Pin("web_server.versioned_max_age_s", current.versioned_max_age_s, next.versioned_max_age_s, pinned);
+    Pin("web_server.sse_queue_capacity", current.sse_queue_capacity, next.sse_queue_capacity, pinned);
+    Pin("web_server.sse_max_batch_size", current.sse_max_batch_size, next.sse_max_batch_size, pinned);
+    Pin("system.log_file", current.log_file, next.log_file, pinned);
+    Pin("system.config_watch", current.enable_config_watch, next.enable_config_watch, pinned);
+    Pin("someip.config_file", current.vsomeip_config_path, next.vsomeip_config_path, pinned);
+    Pin("someip.application_name", current.vsomeip_app_name, next.vsomeip_app_name, pinned);
+    return pinned;
+}
+
+WebServerConfig ConfigManager::MergeConfigs(const WebServerConfig& base, const WebServerConfig& override) {
+    // override中仍为默认值的字段视为未设置
+    nlohmann::json merged = ToJson(base);
+    OverlayChanged(merged, ToJson(GetDefaultConfig()), ToJson(override));
+    return FromJson(merged);
+}
+
+bool ConfigManager::ValidateConfig(const WebServerConfig& config, std::string& error_message) {
+    communication::LogLevel level;
+    if (config.http_port <= 0 || config.http_port > 65535) {
+        error_message = "http_port must be in 1..65535";
+    } else if (config.max_request_size == 0) {
+        error_message = "max_request_size must be positive";
+    } else if (config.thread_pool_size > 1024) {
+        error_message = "thread_pool_size must not exceed 1024";
+    } else if (config.max_connections == 0) {
+        error_message = "max_connections must be positive";
+    } else if (config.keep_alive_max_count == 0) {
+        error_message = "keep_alive_max_count must be positive";
+    } else if (config.request_timeout_ms == 0 || config.method_call_timeout_ms == 0) {
+        error_message = "request_timeout_ms and method_call_timeout_ms must be positive";
+    } else if (config.sse_queue_capacity == 0 || config.sse_max_batch_size == 0) {
+        error_message = "sse_queue_capacity and sse_max_batch_size must be positive";
+    } else if (config.enable_rate_limiting && config.rate_limit_window_ms == 0) {
+        error_message = "rate_limiting.window_ms must be positive";
+    } else if (config.sse_heartbeat_interval_ms < 1000) {
+        error_message = "sse_heartbeat_interval_ms must be at least 1000";
+    } else if (!communication::ParseLogLevel(config.log_level, level)) {
+        error_message = "log_level must be one of debug/info/warn/error";
+    } else {
+        error_message.clear();
+        return true;
+    }
+    return false;
+}
+
+bool ConfigManager::SaveToFile(const WebServerConfig& config, const std::string& config_file) {
+    std::ofstream file(config_file);
+    if (!file) {
+        std::cerr << "[ConfigManager] Cannot write " << config_file << std::endl;
+        return false;
+    }
+    file << ToJson(config).dump(4) << std::endl;
+    return static_cast<bool>(file);
+}
+
+nlohmann::json ConfigManager::ToJson(const WebServerConfig& config) {
+    nlohmann::json services = nlohmann::json::object();
+    for (const auto& [key, timeout_ms] : config.method_timeouts_ms) {
+        const std::string service_id = FormatId(static_cast<uint16_t>(key >> 16));
+        const std::string method_id = FormatId(static_cast<uint16_t>(key & 0xFFFF));
+        services[service_id]["service_id"] = service_id;
+        services[service_id]["methods"][method_id] = {{"method_id", method_id}, {"timeout_ms", timeout_ms}};
+    }
+
+    return {
+        {"system", {
+            {"log_level", config.log_level},
+            {"log_file", config.log_file},
+            {"access_log", config.enable_access_log},
+            {"config_watch", config.enable_config_watch}
+        }},
+        {"web_server", {
+            {"host", config.http_host},
+            {"port", config.http_port},
+            {"cors_enabled", config.enable_cors},
+            {"max_request_size", config.max_request_size},
+            {"thread_pool_size", config.thread_pool_size},
+            {"keep_alive_max_count", config.keep_alive_max_count},
+            {"keep_alive_timeout_s", config.keep_alive_timeout_s},
+            {"read_timeout_ms", config.read_timeout_ms},
+            {"write_timeout_ms", config.write_timeout_ms},
+            {"request_timeout_ms", config.request_timeout_ms},
+            {"response_timeout_ms", config.response_timeout_ms},
+            {"max_connections", config.max_connections},
+            {"shed_queue_depth", config.shed_queue_depth},
+            {"retry_after_s", config.retry_after_s},
+            {"websocket_host", config.websocket_host},
+            {"websocket_port", config.websocket_port},
+            {"ping_interval_ms", config.ping_interval_ms},
+            {"document_root", config.web_root},
+            {"directory_listing", config.enable_directory_listing},
+            {"static_max_age_s", config.static_max_age_s},
+            {"versioned_max_age_s", config.versioned_max_age_s},
+            {"sse_coalesce_window_ms", config.sse_coalesce_window_ms},
+            {"sse_queue_capacity", config.sse_queue_capacity},
+            {"sse_max_batch_size", config.sse_max_batch_size},
+            {"sse_heartbeat_interval_ms", config.sse_heartbeat_interval_ms}
+        }},
+        {"security", {
+            {"rate_limiting", {
+                {"enabled", config.enable_rate_limiting},
+                {"max_requests_per_minute", config.rate_limit_requests},
+                {"max_commands_per_minute", config.rate_limit_commands},
+                {"max_sse_connects_per_minute", config.rate_limit_sse_connects},
+                {"window_ms", config.rate_limit_window_ms}
+            }}
+        }},
+        {"someip", {
+            {"config_file", config.vsomeip_config_path},
+            {"application_name", config.vsomeip_app_name},
+            {"method_call_timeout_ms", config.method_call_timeout_ms},
+            {"max_retry_attempts", config.max_retry_attempts},
+            {"connection_retry_interval_ms", config.circuit_open_duration_ms},
+            {"priority_lanes", {
+                {"max_in_flight", config.max_in_flight},
+                {"safety_budget_ms", config.safety_budget_ms},
+                {"control_budget_ms", config.control_budget_ms},
+                {"query_budget_ms", config.query_budget_ms}
+            }}
+        }},
+        {"services", services}
+    };
+}
+
+WebServerConfig ConfigManager::FromJson(const nlohmann::json& json) {
+    WebServerConfig config = GetDefaultConfig();
+    const nlohmann::json empty = nlohmann::json::object();
+    auto section = [&empty](const nlohmann::json& parent, const char* key) -> const nlohmann::json& {
+        auto it = parent.find(key);
+        return it != parent.end() && it->is_object() ? *it : empty;
+    };
+
+    const auto& system = section(json, "system");
+    Read(system, "log_level", config.log_level);
+    Read(system, "log_file", config.log_file);
+    Read(system, "access_log", config.enable_access_log);
+    Read(system, "config_watch", config.enable_config_watch);
+
+    const auto& web = section(json, "web_server");
+    Read(web, "host", config.http_host);
+    Read(web, "port", config.http_port);
+    Read(web, "cors_enabled", config.enable_cors);
+    Read(web, "max_request_size", config.max_request_size);
+    Read(web, "thread_pool_size", config.thread_pool_size);
+    Read(web, "keep_alive_max_count", config.keep_alive_max_count);
+    Read(web, "keep_alive_timeout_s", config.keep_alive_timeout_s);
+    Read(web, "read_timeout_ms", config.read_timeout_ms);
+    Read(web, "write_timeout_ms", config.write_timeout_ms);
+    Read(web, "request_timeout_ms", config.request_timeout_ms);
+    Read(web, "response_timeout_ms", config.response_timeout_ms);
+    Read(web, "max_connections", config.max_connections);
+    Read(web, "shed_queue_depth", config.shed_queue_depth);
+    Read(web, "retry_after_s", config.retry_after_s);
+    Read(web, "websocket_host", config.websocket_host);
+    Read(web, "websocket_port", config.websocket_port);
+    Read(web, "ping_interval_ms", config.ping_interval_ms);
+    Read(web, "document_root", config.web_root);
+    Read(web, "directory_listing", config.enable_directory_listing);
+    Read(web, "static_max_age_s", config.static_max_age_s);
+    Read(web, "versioned_max_age_s", config.versioned_max_age_s);
+    Read(web, "sse_coalesce_window_ms", config.sse_coalesce_window_ms);
+    Read(web, "sse_queue_capacity", config.sse_queue_capacity);
+    Read(web, "sse_max_batch_size", config.sse_max_batch_size);
+    Read(web, "sse_heartbeat_interval_ms", config.sse_heartbeat_interval_ms);
+
+    const auto& rate_limiting = section(section(json, "security"), "rate_limiting");
+    Read(rate_limiting, "enabled", config.enable_rate_limiting);
+    Read(rate_limiting, "max_requests_per_minute", config.rate_limit_requests);
+    Read(rate_limiting, "max_commands_per_minute", config.rate_limit_commands);
+    Read(rate_limiting, "max_sse_connects_per_minute", config.rate_limit_sse_connects);
+    Read(rate_limiting, "window_ms", config.rate_limit_window_ms);
+
+    const auto& someip = section(json, "someip");
+    Read(someip, "config_file", config.vsomeip_config_path);
+    Read(someip, "application_name", config.vsomeip_app_name);
+    Read(someip, "method_call_timeout_ms", config.method_call_timeout_ms);
+    Read(someip, "max_retry_attempts", config.max_retry_attempts);
+    Read(someip, "connection_retry_interval_ms", config.circuit_open_duration_ms);
+    const auto& lanes = section(someip, "priority_lanes");
+    Read(lanes, "max_in_flight", config.max_in_flight);
+    Read(lanes, "safety_budget_ms", config.safety_budget_ms);
+    Read(lanes, "control_budget_ms", config.control_budget_ms);
+    Read(lanes, "query_budget_ms", config.query_budget_ms);
+
+    // services.<name>.methods.<name>.{method_id, timeout_ms}
+    const auto& services = section(json, "services");
+    for (auto service = services.begin(); service != services.end(); ++service) {
+        if (!service->is_object() || !service->contains("service_id")) {
+            continue;
+        }
+        const uint32_t service_id = ParseId((*service)["service_id"]);
+        const auto& methods = section(*service, "methods");
+        for (auto method = methods.begin(); method != methods.end(); ++method) {
+            if (!method->is_object() || !method->contains("method_id") || !method->contains("timeout_ms")) {
+                continue;
+            }
+            const uint32_t key = (service_id << 16) | ParseId((*method)["method_id"]);
+            config.method_timeouts_ms[key] = (*method)["timeout_ms"].get<uint32_t>();
+        }
+    }
+    return config;
+}
+
+WebServerConfig ConfigManager::GetDefaultConfig() {
+    return WebServerConfig();
+}
+
+void ConfigManager::PrintConfig(const WebServerConfig& config) {
+    std::cout << "[ConfigManager] Configuration:" << std::endl;
+    std::cout << "[ConfigManager]   HTTP: " << config.http_host << ":" << config.http_port
+              << ", threads " << config.thread_pool_size
+              << ", max connections " << config.max_connections
+              << " (503 at queue depth " << config.shed_queue_depth << ")"
+              << ", keep-alive " << config.keep_alive_max_count << " req/" << config.keep_alive_timeout_s << "s"
+              << ", max request " << config.max_request_size << " bytes" << std::endl;
+    std::cout << "[ConfigManager]   Timeouts: request " << config.request_timeout_ms << "ms"
+              << ", read " << config.read_timeout_ms << "ms, write " << config.write_timeout_ms << "ms" << std::endl;
+    std::cout << "[ConfigManager]   SSE: coalesce " << config.sse_coalesce_window_ms << "ms"
+              << ", queue " << config.sse_queue_capacity << ", batch " << config.sse_max_batch_size
+              << ", heartbeat " << config.sse_heartbeat_interval_ms << "ms" << std::endl;
+    std::cout << "[ConfigManager]   Static: " << config.web_root << ", max-age " << config.static_max_age_s
+              << "s (versioned " << config.versioned_max_age_s << "s)" << std::endl;
+    std::cout << "[ConfigManager]   SOME/IP: method timeout " << config.method_call_timeout_ms << "ms"
+              << " (" << config.method_timeouts_ms.size() << " per-method overrides)"
+              << ", retries " << config.max_retry_attempts << ", in-flight " << config.max_in_flight << std::endl;
+    std::cout << "[ConfigManager]   Rate limiting: ";
+    if (config.enable_rate_limiting) {
+        std::cout << config.rate_limit_requests << " reads, " << config.rate_limit_commands << " commands, "
+                  << config.rate_limit_sse_connects << " SSE connects per " << config.rate_limit_window_ms
+                  << "ms per client" << std::endl;
+    } else {
+        std::cout << "off" << std::endl;
+    }
+    std::cout << "[ConfigManager]   Log level: " << config.log_level
+              << ", config watch " << (config.enable_config_watch ? "on" : "off") << std::endl;
+}
+
+bool ConfigManager::IsKnownOption(const std::string& option) {
+    return option == "--help" || option == "--config" || FindOption(option) != nullptr;
+}
+
+void ConfigManager::PrintOptions() {
+    std::cout << "  " << std::left << std::setw(30) << "--config PATH"
+              << "Configuration file (default: " << DEFAULT_CONFIG_FILE << ")" << std::endl;
+    for (const auto& option : OPTIONS) {
+        if (option.cli) {
+            std::cout << "  " << std::left << std::setw(30) << (std::string(option.cli) + " VALUE")
+                      << option.help << " [" << option.env << "]" << std::endl;
+        }
+    }
+    std::cout << "  " << std::left << std::setw(30) << "--help" << "Show this help message" << std::endl;
+}
+
+std::string ConfigManager::GetEnvVar(const std::string& name, const std::string& default_value) {
+    const char* value = std::getenv(name.c_str());
+    return value ? std::string(value) : default_value;
+}
+
+std::unordered_map<std::string, std::string> ConfigManager::ParseCommandLine(int argc, char* argv[]) {
+    std::unordered_map<std::string, std::string> args;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg != "--help" && i + 1 < argc) {
+            args[arg] = argv[++i];
+        } else {
+            args[arg] = "";
+        }
+    }
+    return args;
+}
+
+} // namespace web_api
+} // namespace body_controller
@@ -0,0 +1,140 @@
+#include "web_api/config_watcher.h"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace body_controller {
+namespace web_api {
+
+ConfigWatcher::ConfigWatcher(const std::string& config_file, ChangeHandler handler,
+                             std::chrono::milliseconds debounce)
+    : handler_(std::move(handler))
+    , debounce_(debounce) {
+    const size_t slash = config_file.find_last_of('/');
+    if (slash == std::string::npos) {
+        directory_ = ".";
+        file_name_ = config_file;
+    } else {
+        directory_ = slash == 0 ? "/" : config_file.substr(0, slash);
+        file_name_ = config_file.substr(slash + 1);
+    }
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    Stop();
+}
+
+bool ConfigWatcher::Start() {
+    if (running_) {
+        return true;
+    }
+
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ < 0) {
+        std::cerr << "[ConfigWatcher] inotify_init1 failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    if (inotify_add_watch(inotify_fd_, directory_.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        std::cerr << "[ConfigWatcher] Cannot watch " << directory_ << ": " << std::strerror(errno) << std::endl;
+        close(inotify_fd_);
+        inotify_fd_ = -1;
+        return false;
+    }
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd_ < 0) {
+        std::cerr << "[ConfigWatcher] eventfd failed: " << std::strerror(errno) << std::endl;
+        close(inotify_fd_);
+        inotify_fd_ = -1;
+        return false;
+    }
+
+    running_ = true;
+    watch_thread_ = std::thread(&ConfigWatcher::WatchLoop, this);
+    std::cout << "[ConfigWatcher] Watching " << directory_ << "/" << file_name_ << std::endl;
+    return true;
+}
+
+void ConfigWatcher::Stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    const uint64_t one = 1;
+    if (write(wake_fd_, &one, sizeof(one)) < 0) {
+        std::cerr << "[ConfigWatcher] Failed to wake watch thread: " << std::strerror(errno) << std::endl;
+    }
+    if (watch_thread_.joinable()) {
+        watch_thread_.join();
+    }
+
+    close(wake_fd_);
+    close(inotify_fd_);
+    wake_fd_ = -1;
+    inotify_fd_ = -1;
+    std::cout << "[ConfigWatcher] Stopped" << std::endl;
+}
+
+void ConfigWatcher::WatchLoop() {
+    pollfd fds[2] = {
+        {inotify_fd_, POLLIN, 0},
+        {wake_fd_, POLLIN, 0},
+    };
+    bool changed = false;
+
+    while (running_) {
+        // 有待处理的变化时只等待去抖窗口，窗口内没有新事件才触发回调
+        const int timeout_ms = changed ? static_cast<int>(debounce_.count()) : -1;
+        const int ready = poll(fds, 2, timeout_ms);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "[ConfigWatcher] poll failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+        if (ready > 0 && (fds[0].revents & POLLIN)) {
+            changed = DrainEvents() || changed;
+            continue;
+        }
+
+        if (changed) {
+            changed = false;
+            std::cout << "[ConfigWatcher] " << file_name_ << " changed" << std::endl;
+            try {
+                handler_();
+            } catch (const std::exception& e) {
+                std::cerr << "[ConfigWatcher] Change handler error: " << e.what() << std::endl;
+            }
+        }
+    }
+}
+
+bool ConfigWatcher::DrainEvents() {
+    alignas(inotify_event) char buffer[4096];
+    bool matched = false;
+
+    while (true) {
+        const ssize_t length = read(inotify_fd_, buffer, sizeof(buffer));
+        if (length <= 0) {
+            break;
+        }
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            if (event->len > 0 && file_name_ == event->name) {
+                matched = true;
+            }
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+    }
+    return matched;
+}
+
+} // namespace web_api
+} // namespace body_controller
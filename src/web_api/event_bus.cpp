@@ -0,0 +1,286 @@
+#include "web_api/event_bus.h"
+#include <iostream>
+#include <algorithm>
+
+namespace body_controller {
+namespace web_api {
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+namespace {
+
+struct EntityKeyVisitor {
+    uint8_t operator()(const application::OnLockStateChangedData& d) const { return static_cast<uint8_t>(d.doorID); }
+    uint8_t operator()(const application::OnDoorStateChangedData& d) const { return static_cast<uint8_t>(d.doorID); }
+    uint8_t operator()(const application::OnWindowPositionChangedData& d) const { return static_cast<uint8_t>(d.windowID); }
+    uint8_t operator()(const application::OnLightStateChangedData& d) const { return static_cast<uint8_t>(d.lightType); }
+    uint8_t operator()(const application::OnSeatPositionChangedData& d) const {
+        return static_cast<uint8_t>((static_cast<uint8_t>(d.seatID) << 4) | static_cast<uint8_t>(d.axis));
+    }
+    uint8_t operator()(const application::OnMemorySaveConfirmData& d) const { return d.presetID; }
+    uint8_t operator()(const application::OnSeatRecallCompleteData& d) const { return static_cast<uint8_t>(d.seatID); }
+};
+
+} // namespace
+
+uint8_t GetEventEntityKey(const BusEvent& event) {
+    return std::visit(EntityKeyVisitor{}, event.payload);
+}
+
+const char* ToString(EventTopic topic) {
+    switch (topic) {
+        case EventTopic::LOCK_STATE_CHANGED:      return "lock_state_changed";
+        case EventTopic::DOOR_STATE_CHANGED:      return "door_state_changed";
+        case EventTopic::WINDOW_POSITION_CHANGED: return "window_position_changed";
+        case EventTopic::LIGHT_STATE_CHANGED:     return "light_state_changed";
+        case EventTopic::SEAT_POSITION_CHANGED:   return "seat_position_changed";
+        case EventTopic::MEMORY_SAVE_CONFIRM:     return "memory_save_confirm";
+        case EventTopic::SEAT_RECALL_COMPLETE:    return "seat_recall_complete";
+    }
+    return "unknown";
+}
+
+// ============================================================================
+// 订阅者
+// ============================================================================
+
+class EventBus::Subscriber {
+public:
+    Subscriber(SubscriptionId id, const SubscriptionOptions& options, BatchHandler handler)
+        : id_(id)
+        , options_(options)
+        , handler_(std::move(handler))
+        , queue_(options.queue_capacity) {
+        if (options_.max_batch_size == 0) {
+            options_.max_batch_size = 1;
+        }
+    }
+
+    void Start() {
+        running_ = true;
+        worker_ = std::thread(&Subscriber::Run, this);
+    }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            running_ = false;
+        }
+        wake_cv_.notify_one();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    bool Accepts(EventTopic topic) const {
+        return options_.topics.test(static_cast<size_t>(topic));
+    }
+
+    /**
+     * @brief 生产者入队（不等待消费者）
+     */
+    void Enqueue(const BusEvent& event) {
+        if (!queue_.TryPush(event)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        // 仅在空闲->有数据的转换时唤醒，临界区为空，不会等待处理函数
+        if (!pending_.exchange(true, std::memory_order_acq_rel)) {
+            { std::lock_guard<std::mutex> lock(wake_mutex_); }
+            wake_cv_.notify_one();
+        }
+    }
+
+    SubscriptionId GetId() const { return id_; }
+
+    SubscriberStats GetStats() const {
+        return SubscriberStats{options_.name,
+                               delivered_.load(std::memory_order_relaxed),
+                               coalesced_.load(std::memory_order_relaxed),
+                               dropped_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    void Run() {
+        std::vector<BusEvent> batch;
+        batch.reserve(options_.max_batch_size);
+
+        while (running_) {
+            pending_.store(false, std::memory_order_release);
+            if (DrainBatch(batch)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_cv_.wait_for(lock, options_.idle_wait, [this] {
+                return !running_ || pending_.load(std::memory_order_acquire);
+            });
+        }
+
+        // 退出前投递剩余事件
+        while (DrainBatch(batch)) {
+        }
+    }
+
+    /**
+     * @brief 读取并投递一批事件
+     * @return 本次读取到事件返回true
+     */
+    bool DrainBatch(std::vector<BusEvent>& batch) {
+        batch.clear();
+        BusEvent event;
+        while (batch.size() < options_.max_batch_size && queue_.TryPop(event)) {
+            batch.push_back(std::move(event));
+        }
+        if (batch.empty()) {
+            return false;
+        }
+
+        Coalesce(batch);
+        delivered_.fetch_add(batch.size(), std::memory_order_relaxed);
+
+        try {
+            handler_(batch);
+        } catch (const std::exception& e) {
+            std::cerr << "[EventBus] Subscriber '" << options_.name
+                      << "' handler error: " << e.what() << std::endl;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 对合并主题只保留每个（主题，实体）的最新事件，其余事件保持原顺序
+     */
+    void Coalesce(std::vector<BusEvent>& batch) {
+        if (options_.coalesce_topics.none() || batch.size() < 2) {
+            return;
+        }
+
+        std::bitset<EVENT_TOPIC_COUNT * 256> seen;
+        std::vector<bool> keep(batch.size(), true);
+        for (size_t i = batch.size(); i-- > 0;) {
+            const auto topic = static_cast<size_t>(batch[i].topic);
+            if (!options_.coalesce_topics.test(topic)) {
+                continue;
+            }
+            const size_t key = topic * 256 + GetEventEntityKey(batch[i]);
+            if (seen.test(key)) {
+                keep[i] = false;
+            } else {
+                seen.set(key);
+            }
+        }
+
+        size_t out = 0;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (keep[i]) {
+                if (out != i) {
+                    batch[out] = std::move(batch[i]);
+                }
+                ++out;
+            }
+        }
+        coalesced_.fetch_add(batch.size() - out, std::memory_order_relaxed);
+        batch.resize(out);
+    }
+
+    const SubscriptionId id_;
+    SubscriptionOptions options_;
+    BatchHandler handler_;
+    MpscRingBuffer<BusEvent> queue_;
+
+    std::thread worker_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> pending_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> coalesced_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+// ============================================================================
+// EventBus
+// ============================================================================
+
+EventBus::EventBus()
+    : subscribers_(std::make_shared<const SubscriberList>()) {
+}
+
+EventBus::~EventBus() {
+    Shutdown();
+}
+
+EventBus::SubscriptionId EventBus::Subscribe(const SubscriptionOptions& options, BatchHandler handler) {
+    const SubscriptionId id = next_subscription_id_.fetch_add(1);
+    auto subscriber = std::make_shared<Subscriber>(id, options, std::move(handler));
+    subscriber->Start();
+
+    {
+        std::lock_guard<std::mutex> lock(subscribers_mutex_);
+        auto updated = std::make_shared<SubscriberList>(*std::atomic_load(&subscribers_));
+        updated->push_back(subscriber);
+        std::atomic_store(&subscribers_, std::shared_ptr<const SubscriberList>(std::move(updated)));
+    }
+
+    std::cout << "[EventBus] Subscriber '" << options.name << "' registered (id=" << id << ")" << std::endl;
+    return id;
+}
+
+void EventBus::Unsubscribe(SubscriptionId id) {
+    std::shared_ptr<Subscriber> removed;
+    {
+        std::lock_guard<std::mutex> lock(subscribers_mutex_);
+        auto updated = std::make_shared<SubscriberList>(*std::atomic_load(&subscribers_));
+        auto it = std::find_if(updated->begin(), updated->end(),
+                               [id](const std::shared_ptr<Subscriber>& s) { return s->GetId() == id; });
+        if (it == updated->end()) {
+            return;
+        }
+        removed = *it;
+        updated->erase(it);
+        std::atomic_store(&subscribers_, std::shared_ptr<const SubscriberList>(std::move(updated)));
+    }
+
+    removed->Stop();
+    std::cout << "[EventBus] Subscriber id=" << id << " removed" << std::endl;
+}
+
+void EventBus::Shutdown() {
+    std::shared_ptr<const SubscriberList> current;
+    {
+        std::lock_guard<std::mutex> lock(subscribers_mutex_);
+        current = std::atomic_load(&subscribers_);
+        std::atomic_store(&subscribers_, std::make_shared<const SubscriberList>());
+    }
+
+    for (const auto& subscriber : *current) {
+        subscriber->Stop();
+    }
+}
+
+std::vector<EventBus::SubscriberStats> EventBus::GetSubscriberStats() const {
+    std::vector<SubscriberStats> stats;
+    auto current = std::atomic_load(&subscribers_);
+    for (const auto& subscriber : *current) {
+        stats.push_back(subscriber->GetStats());
+    }
+    return stats;
+}
+
+void EventBus::PublishEvent(BusEvent& event) {
+    event.sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
+    event.publish_time = std::chrono::steady_clock::now();
+
+    auto current = std::atomic_load(&subscribers_);
+    for (const auto& subscriber : *current) {
+        if (subscriber->Accepts(event.topic)) {
+            subscriber->Enqueue(event);
+        }
+    }
+}
+
+} // namespace web_api
+} // namespace body_controller
@@ -0,0 +1,184 @@
+#include "web_api/event_coalescer.h"
+#include <iostream>
+
+namespace body_controller {
+namespace web_api {
+
+namespace {
+constexpr size_t ENTITY_KEY_SPACE = 256;
+}
+
+EventCoalescer::EventCoalescer(const Options& options, FlushHandler handler)
+    : options_(options)
+    , handler_(std::move(handler))
+    , slots_(EVENT_TOPIC_COUNT * ENTITY_KEY_SPACE)
+    , slot_dirty_(EVENT_TOPIC_COUNT * ENTITY_KEY_SPACE, false) {
+    if (options_.window.count() <= 0) {
+        options_.enabled = false;
+    }
+    enabled_ = options_.enabled;
+    window_ms_ = options_.enabled ? options_.window.count() : 0;
+}
+
+EventCoalescer::~EventCoalescer() {
+    Stop();
+}
+
+void EventCoalescer::Start() {
+    if (running_) {
+        return;
+    }
+    // 未启用合并时刷新线程空闲等待，以便运行期间通过SetWindow开启
+    running_ = true;
+    flush_thread_ = std::thread(&EventCoalescer::FlushLoop, this);
+    if (enabled_) {
+        std::cout << "[EventCoalescer] Started with " << Window().count() << "ms window" << std::endl;
+    } else {
+        std::cout << "[EventCoalescer] Started in pass-through mode" << std::endl;
+    }
+}
+
+void EventCoalescer::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        running_ = false;
+    }
+    wake_cv_.notify_one();
+    if (flush_thread_.joinable()) {
+        flush_thread_.join();
+    }
+
+    std::lock_guard<std::mutex> emit_lock(emit_mutex_);
+    FlushPending();
+}
+
+void EventCoalescer::SetWindow(std::chrono::milliseconds window) {
+    const bool enabled = window.count() > 0;
+    if (enabled == enabled_ && window.count() == window_ms_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        window_ms_ = enabled ? window.count() : 0;
+        enabled_ = enabled;
+    }
+    wake_cv_.notify_one();
+    std::cout << "[EventCoalescer] Window changed to " << window.count() << "ms"
+              << (enabled ? "" : " (pass-through)") << std::endl;
+
+    if (!enabled) {
+        std::lock_guard<std::mutex> emit_lock(emit_mutex_);
+        FlushPending();
+    }
+}
+
+void EventCoalescer::Submit(const std::vector<BusEvent>& events) {
+    if (!enabled_) {
+        handler_(events);
+        return;
+    }
+
+    std::vector<BusEvent> immediate;
+    bool terminal_reached = false;
+
+    {
+        std::lock_guard<std::mutex> lock(slots_mutex_);
+        for (const auto& event : events) {
+            const auto topic = static_cast<size_t>(event.topic);
+            if (!options_.topics.test(topic)) {
+                immediate.push_back(event);
+                continue;
+            }
+
+            const size_t key = topic * ENTITY_KEY_SPACE + GetEventEntityKey(event);
+            if (slot_dirty_[key]) {
+                coalesced_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                slot_dirty_[key] = true;
+                dirty_keys_.push_back(key);
+            }
+            slots_[key] = event;
+
+            if (IsTerminalState(event)) {
+                terminal_reached = true;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> emit_lock(emit_mutex_);
+    if (terminal_reached) {
+        // 终止状态立即输出，避免前端停留在中间位置
+        FlushPending();
+    }
+    if (!immediate.empty()) {
+        handler_(immediate);
+    }
+}
+
+bool EventCoalescer::IsTerminalState(const BusEvent& event) {
+    if (auto data = event.As<application::OnWindowPositionChangedData>()) {
+        return data->newPosition == 0 || data->newPosition >= 100;
+    }
+    if (auto data = event.As<application::OnSeatPositionChangedData>()) {
+        return data->newPosition == 0 || data->newPosition >= 100;
+    }
+    return false;
+}
+
+void EventCoalescer::FlushLoop() {
+    auto next_boundary = std::chrono::steady_clock::now() + Window();
+
+    while (running_) {
+        {
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            if (!enabled_) {
+                // 透传模式：等待重新开启合并
+                wake_cv_.wait(lock, [this] { return !running_ || enabled_; });
+                next_boundary = std::chrono::steady_clock::now() + Window();
+                continue;
+            }
+            wake_cv_.wait_until(lock, next_boundary, [this] { return !running_; });
+        }
+        if (!running_) {
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> emit_lock(emit_mutex_);
+            FlushPending();
+        }
+
+        // 保持固定节拍，处理耗时过长时跳过错过的窗口
+        const auto window = Window();
+        next_boundary += window;
+        const auto now = std::chrono::steady_clock::now();
+        if (next_boundary < now) {
+            next_boundary = now + window;
+        }
+    }
+}
+
+void EventCoalescer::FlushPending() {
+    std::vector<BusEvent> pending;
+    {
+        std::lock_guard<std::mutex> lock(slots_mutex_);
+        if (dirty_keys_.empty()) {
+            return;
+        }
+        pending.reserve(dirty_keys_.size());
+        for (size_t key : dirty_keys_) {
+            pending.push_back(slots_[key]);
+            slot_dirty_[key] = false;
+        }
+        dirty_keys_.clear();
+    }
+
+    try {
+        handler_(pending);
+    } catch (const std::exception& e) {
+        std::cerr << "[EventCoalescer] Flush handler error: " << e.what() << std::endl;
+    }
+}
+
+} // namespace web_api
+} // namespace body_controller
@@ -0,0 +1,454 @@
+#include "web_api/fast_json_codec.h"
+#include "web_api/api_handlers.h"
+#include <array>
+#include <charconv>
+#include <ctime>
+#include <initializer_list>
+#include <utility>
+
+namespace body_controller {
+namespace web_api {
+
+namespace {
+
+// ============================================================================
+// 编码辅助
+// ============================================================================
+
+using Field = std::pair<const char*, long long>;
+
+std::string& ThreadBuffer() {
+    thread_local std::string buffer = [] {
+        std::string s;
+        s.reserve(256);
+        return s;
+    }();
+    return buffer;
+}
+
+void AppendInt(std::string& buffer, long long value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr);
+}
+
+/**
+ * @brief 写入扁平对象，字段需按键名字母序传入以与nlohmann输出一致
+ */
+void AppendObject(std::string& buffer, std::initializer_list<Field> fields) {
+    buffer += '{';
+    bool first = true;
+    for (const auto& field : fields) {
+        if (!first) {
+            buffer += ',';
+        }
+        first = false;
+        buffer += '"';
+        buffer += field.first;
+        buffer += "\":";
+        AppendInt(buffer, field.second);
+    }
+    buffer += '}';
+}
+
+// ============================================================================
+// 解码辅助：只包含整数值的扁平JSON对象
+// ============================================================================
+
+struct FlatObject {
+    static constexpr size_t MAX_FIELDS = 8;
+    std::array<std::pair<std::string_view, int>, MAX_FIELDS> fields;
+    size_t count = 0;
+
+    bool Get(std::string_view key, int& value) const {
+        // 重复键以最后一次出现为准，与nlohmann行为一致
+        for (size_t i = count; i-- > 0;) {
+            if (fields[i].first == key) {
+                value = fields[i].second;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+void SkipWhitespace(std::string_view text, size_t& pos) {
+    while (pos < text.size() &&
+           (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+        ++pos;
+    }
+}
+
+bool ParseKey(std::string_view text, size_t& pos, std::string_view& key) {
+    if (pos >= text.size() || text[pos] != '"') {
+        return false;
+    }
+    const size_t start = ++pos;
+    while (pos < text.size() && text[pos] != '"') {
+        // 转义字符交给完整解析器处理
+        if (text[pos] == '\\' || static_cast<unsigned char>(text[pos]) < 0x20) {
+            return false;
+        }
+        ++pos;
+    }
+    if (pos >= text.size()) {
+        return false;
+    }
+    key = text.substr(start, pos - start);
+    ++pos;
+    return true;
+}
+
+bool ParseInt(std::string_view text, size_t& pos, int& value) {
+    const size_t start = pos;
+    if (pos < text.size() && text[pos] == '-') {
+        ++pos;
+    }
+    const size_t digits_start = pos;
+    while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+        ++pos;
+    }
+    const size_t digit_count = pos - digits_start;
+    // 前导零、浮点数、过长数字交给完整解析器处理
+    if (digit_count == 0 || digit_count > 9 ||
+        (digit_count > 1 && text[digits_start] == '0')) {
+        return false;
+    }
+    if (pos < text.size() && (text[pos] == '.' || text[pos] == 'e' || text[pos] == 'E')) {
+        return false;
+    }
+    auto result = std::from_chars(text.data() + start, text.data() + pos, value);
+    return result.ec == std::errc();
+}
+
+bool ParseFlatObject(std::string_view text, FlatObject& object) {
+    size_t pos = 0;
+    SkipWhitespace(text, pos);
+    if (pos >= text.size() || text[pos] != '{') {
+        return false;
+    }
+    ++pos;
+    SkipWhitespace(text, pos);
+
+    if (pos < text.size() && text[pos] == '}') {
+        ++pos;
+    } else {
+        for (;;) {
+            if (object.count == FlatObject::MAX_FIELDS) {
+                return false;
+            }
+            auto& field = object.fields[object.count];
+            SkipWhitespace(text, pos);
+            if (!ParseKey(text, pos, field.first)) {
+                return false;
+            }
+            SkipWhitespace(text, pos);
+            if (pos >= text.size() || text[pos] != ':') {
+                return false;
+            }
+            ++pos;
+            SkipWhitespace(text, pos);
+            if (!ParseInt(text, pos, field.second)) {
+                return false;
+            }
+            ++object.count;
+            SkipWhitespace(text, pos);
+            if (pos < text.size() && text[pos] == ',') {
+                ++pos;
+                continue;
+            }
+            if (pos < text.size() && text[pos] == '}') {
+                ++pos;
+                break;
+            }
+            return false;
+        }
+    }
+
+    SkipWhitespace(text, pos);
+    return pos == text.size();
+}
+
+} // namespace
+
+// ============================================================================
+// 缓冲区管理
+// ============================================================================
+
+std::string& FastJsonCodec::BeginSuccessResponse() {
+    std::string& buffer = ThreadBuffer();
+    buffer.clear();
+    buffer += "{\"data\":";
+    return buffer;
+}
+
+std::string_view FastJsonCodec::EndSuccessResponse(std::string& buffer) {
+    buffer += ",\"success\":true,\"timestamp\":";
+    AppendInt(buffer, static_cast<long long>(std::time(nullptr)));
+    buffer += '}';
+    return std::string_view(buffer);
+}
+
+std::string& FastJsonCodec::BeginObject() {
+    std::string& buffer = ThreadBuffer();
+    buffer.clear();
+    return buffer;
+}
+
+// ============================================================================
+// 车门服务编码
+// ============================================================================
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::SetLockStateResp& resp) {
+    AppendObject(buffer, {{"doorID", static_cast<int>(resp.doorID)},
+                          {"result", static_cast<int>(resp.result)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::GetLockStateResp& resp) {
+    AppendObject(buffer, {{"doorID", static_cast<int>(resp.doorID)},
+                          {"lockState", static_cast<int>(resp.lockState)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::OnLockStateChangedData& data) {
+    AppendObject(buffer, {{"doorID", static_cast<int>(data.doorID)},
+                          {"newLockState", static_cast<int>(data.newLockState)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::OnDoorStateChangedData& data) {
+    AppendObject(buffer, {{"doorID", static_cast<int>(data.doorID)},
+                          {"newDoorState", static_cast<int>(data.newDoorState)}});
+}
+
+// ============================================================================
+// 车窗服务编码
+// ============================================================================
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::SetWindowPositionResp& resp) {
+    AppendObject(buffer, {{"result", static_cast<int>(resp.result)},
+                          {"windowID", static_cast<int>(resp.windowID)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const SetWindowPositionResult& result) {
+    // 含布尔字段，不走AppendObject；键按字母序
+    buffer += "{\"collapsed\":";
+    buffer += result.collapsed ? "true" : "false";
+    buffer += ",\"commandID\":";
+    AppendInt(buffer, static_cast<long long>(result.commandID));
+    buffer += ",\"result\":";
+    AppendInt(buffer, static_cast<int>(result.response.result));
+    buffer += ",\"windowID\":";
+    AppendInt(buffer, static_cast<int>(result.response.windowID));
+    buffer += '}';
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::ControlWindowResp& resp) {
+    AppendObject(buffer, {{"result", static_cast<int>(resp.result)},
+                          {"windowID", static_cast<int>(resp.windowID)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::GetWindowPositionResp& resp) {
+    AppendObject(buffer, {{"position", static_cast<int>(resp.position)},
+                          {"windowID", static_cast<int>(resp.windowID)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::OnWindowPositionChangedData& data) {
+    AppendObject(buffer, {{"newPosition", static_cast<int>(data.newPosition)},
+                          {"windowID", static_cast<int>(data.windowID)}});
+}
+
+// ============================================================================
+// 灯光服务编码
+// ============================================================================
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::SetHeadlightStateResp& resp) {
+    AppendObject(buffer, {{"newState", static_cast<int>(resp.newState)},
+                          {"result", static_cast<int>(resp.result)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::SetIndicatorStateResp& resp) {
+    AppendObject(buffer, {{"newState", static_cast<int>(resp.newState)},
+                          {"result", static_cast<int>(resp.result)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::SetPositionLightStateResp& resp) {
+    AppendObject(buffer, {{"newState", static_cast<int>(resp.newState)},
+                          {"result", static_cast<int>(resp.result)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::GetLightStateResp& resp) {
+    AppendObject(buffer, {{"lightType", static_cast<int>(resp.lightType)},
+                          {"state", static_cast<int>(resp.state)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::OnLightStateChangedData& data) {
+    AppendObject(buffer, {{"lightType", static_cast<int>(data.lightType)},
+                          {"newState", static_cast<int>(data.newState)}});
+}
+
+// ============================================================================
+// 座椅服务编码
+// ============================================================================
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::AdjustSeatResp& resp) {
+    AppendObject(buffer, {{"axis", static_cast<int>(resp.axis)},
+                          {"result", static_cast<int>(resp.result)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::RecallMemoryPositionResp& resp) {
+    AppendObject(buffer, {{"presetID", static_cast<int>(resp.presetID)},
+                          {"result", static_cast<int>(resp.result)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::SaveMemoryPositionResp& resp) {
+    AppendObject(buffer, {{"presetID", static_cast<int>(resp.presetID)},
+                          {"result", static_cast<int>(resp.result)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::OnSeatPositionChangedData& data) {
+    AppendObject(buffer, {{"axis", static_cast<int>(data.axis)},
+                          {"newPosition", static_cast<int>(data.newPosition)},
+                          {"seatID", static_cast<int>(data.seatID)}});
+}
+
+void FastJsonCodec::AppendFields(std::string& buffer, const application::OnMemorySaveConfirmData& data) {
+    AppendObject(buffer, {{"presetID", static_cast<int>(data.presetID)},
+                          {"saveResult", static_cast<int>(data.saveResult)}});
+}
+
+// ============================================================================
+// 请求解码
+// ============================================================================
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::SetLockStateReq& out) {
+    FlatObject object;
+    int door_id = 0;
+    int command = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("doorID", door_id) || !object.Get("command", command)) {
+        return false;
+    }
+    out = application::SetLockStateReq(static_cast<application::Position>(door_id),
+                                       static_cast<application::LockCommand>(command));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::GetLockStateReq& out) {
+    FlatObject object;
+    int door_id = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("doorID", door_id)) {
+        return false;
+    }
+    out = application::GetLockStateReq(static_cast<application::Position>(door_id));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::SetWindowPositionReq& out) {
+    FlatObject object;
+    int window_id = 0;
+    int position = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("windowID", window_id) || !object.Get("position", position)) {
+        return false;
+    }
+    out = application::SetWindowPositionReq(static_cast<application::Position>(window_id),
+                                            static_cast<uint8_t>(position));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::ControlWindowReq& out) {
+    FlatObject object;
+    int window_id = 0;
+    int command = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("windowID", window_id) || !object.Get("command", command)) {
+        return false;
+    }
+    out = application::ControlWindowReq(static_cast<application::Position>(window_id),
+                                        static_cast<application::WindowCommand>(command));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::GetWindowPositionReq& out) {
+    FlatObject object;
+    int window_id = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("windowID", window_id)) {
+        return false;
+    }
+    out = application::GetWindowPositionReq(static_cast<application::Position>(window_id));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::SetHeadlightStateReq& out) {
+    FlatObject object;
+    int command = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("command", command)) {
+        return false;
+    }
+    out = application::SetHeadlightStateReq(static_cast<application::HeadlightState>(command));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::SetIndicatorStateReq& out) {
+    FlatObject object;
+    int command = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("command", command)) {
+        return false;
+    }
+    out = application::SetIndicatorStateReq(static_cast<application::IndicatorState>(command));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::SetPositionLightStateReq& out) {
+    FlatObject object;
+    int command = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("command", command)) {
+        return false;
+    }
+    out = application::SetPositionLightStateReq(static_cast<application::PositionLightState>(command));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::AdjustSeatReq& out) {
+    FlatObject object;
+    int axis = 0;
+    int direction = 0;
+    int seat_id = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("axis", axis) || !object.Get("direction", direction)) {
+        return false;
+    }
+    object.Get("seatID", seat_id);  // 可选字段
+    out = application::AdjustSeatReq(static_cast<application::SeatAxis>(axis),
+                                     static_cast<application::SeatDirection>(direction),
+                                     static_cast<application::Position>(seat_id));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::RecallMemoryPositionReq& out) {
+    FlatObject object;
+    int preset_id = 0;
+    int user_id = 0;
+    int seat_id = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("presetID", preset_id)) {
+        return false;
+    }
+    object.Get("userID", user_id);  // 可选字段
+    object.Get("seatID", seat_id);  // 可选字段
+    out = application::RecallMemoryPositionReq(static_cast<uint8_t>(preset_id), static_cast<uint8_t>(user_id),
+                                               static_cast<application::Position>(seat_id));
+    return true;
+}
+
+bool FastJsonCodec::TryDecode(std::string_view body, application::SaveMemoryPositionReq& out) {
+    FlatObject object;
+    int preset_id = 0;
+    int user_id = 0;
+    int seat_id = 0;
+    if (!ParseFlatObject(body, object) || !object.Get("presetID", preset_id)) {
+        return false;
+    }
+    object.Get("userID", user_id);  // 可选字段
+    object.Get("seatID", seat_id);  // 可选字段
+    out = application::SaveMemoryPositionReq(static_cast<uint8_t>(preset_id), static_cast<uint8_t>(user_id),
+                                             static_cast<application::Position>(seat_id));
+    return true;
+}
+
+} // namespace web_api
+} // namespace body_controller
@@ -1,9 +1,14 @@
 #include "web_api/http_server.h"
 #include "web_api/json_converter.h"
+#include "web_api/fast_json_codec.h"
+#include "web_api/body_codec.h"
 #include "web_api/api_handlers.h"
+#include "web_api/bounded_thread_pool.h"
+#include "communication/someip_service_definitions.h"
+#include "communication/request_context.h"
+#include "communication/log_level.h"
+#include <algorithm>
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <thread>
 #include <chrono>
 #include <future>
@@ -12,22 +17,111 @@
 namespace body_controller {
 namespace web_api {
 
+namespace {
+
+/**
+ * @brief 管理接口只接受本机请求
+ */
+bool IsLoopback(const httplib::Request& req) {
+    return req.remote_addr == "127.0.0.1" || req.remote_addr == "::1" ||
+           req.remote_addr.rfind("::ffff:127.", 0) == 0;
+}
+
+/**
+ * @brief 判断请求的限流类别
+ * @return 不参与限流的请求（静态资源、健康检查、管理接口、CORS预检）返回false
+ */
+bool ClassifyRoute(const httplib::Request& req, RouteClass& route_class) {
+    if (req.path.rfind("/api/", 0) != 0 || req.method == "OPTIONS" ||
+        req.path == "/api/health" || req.path.rfind("/api/admin/", 0) == 0) {
+        return false;
+    }
+    if (req.path == "/api/events") {
+        route_class = RouteClass::SSE;
+    } else {
+        route_class = req.method == "GET" ? RouteClass::READ : RouteClass::COMMAND;
+    }
+    return true;
+}
+
+} // namespace
+
 HttpServer::HttpServer(int port) 
-    : port_(port), running_(false) {
+    : port_(port), running_(false), pool_stats_(std::make_shared<BoundedThreadPool::Stats>()) {
+    config_.http_port = port;
     std::cout << "[HttpServer] Created HTTP server on port " << port << std::endl;
 }
 
+HttpServer::HttpServer(const WebServerConfig& config)
+    : config_(config), port_(config.http_port), running_(false)
+    , pool_stats_(std::make_shared<BoundedThreadPool::Stats>()) {
+    std::cout << "[HttpServer] Created HTTP server on " << config_.http_host << ":" << port_ << std::endl;
+}
+
 HttpServer::~HttpServer() {
     Stop();
 }
 
 bool HttpServer::Initialize() {
     try {
-        // 设置CORS支持
-        server_.set_pre_routing_handler([](const httplib::Request& req, httplib::Response& res) {
-            res.set_header("Access-Control-Allow-Origin", "*");
-            res.set_header("Access-Control-Allow-Methods", "GET, POST, PUT, DELETE, OPTIONS");
-            res.set_header("Access-Control-Allow-Headers", "Content-Type, Authorization");
+        // 连接与线程池：执行中与排队的连接总数有上限，超出时直接关闭新连接
+        const size_t threads = config_.thread_pool_size != 0
+            ? config_.thread_pool_size
+            : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        const size_t max_connections = config_.max_connections;
+        auto pool_stats = pool_stats_;
+        server_.new_task_queue = [threads, max_connections, pool_stats] {
+            return new BoundedThreadPool(threads, max_connections, pool_stats);
+        };
+        server_.set_keep_alive_max_count(config_.keep_alive_max_count);
+        server_.set_keep_alive_timeout(config_.keep_alive_timeout_s);
+        server_.set_read_timeout(config_.read_timeout_ms / 1000, (config_.read_timeout_ms % 1000) * 1000);
+        server_.set_write_timeout(config_.write_timeout_ms / 1000, (config_.write_timeout_ms % 1000) * 1000);
+        server_.set_payload_max_length(config_.max_request_size);
+        std::cout << "[HttpServer] Worker threads: " << threads
+                  << ", max connections: " << max_connections
+                  << ", keep-alive: " << config_.keep_alive_max_count << " requests/" << config_.keep_alive_timeout_s << "s"
+                  << ", max request size: " << config_.max_request_size << " bytes" << std::endl;
+
+        // 设置CORS支持、过载保护与按客户端限流
+        const bool enable_cors = config_.enable_cors;
+        server_.set_pre_routing_handler([this, enable_cors](const httplib::Request& req, httplib::Response& res) {
+            if (enable_cors) {
+                res.set_header("Access-Control-Allow-Origin", "*");
+                res.set_header("Access-Control-Allow-Methods", "GET, POST, PUT, DELETE, OPTIONS");
+                res.set_header("Access-Control-Allow-Headers", "Content-Type, Authorization");
+            }
+
+            // 排队连接过多时快速返回503，使排队的连接尽快得到答复而不是等到超时；
+            // 管理接口不受限制，过载期间仍可调整配置
+            const auto& config = ConfigManager::Current();
+            if (config.shed_queue_depth != 0 &&
+                pool_stats_->queued.load(std::memory_order_relaxed) >= config.shed_queue_depth &&
+                req.path.rfind("/api/admin/", 0) != 0) {
+                pool_stats_->shed.fetch_add(1, std::memory_order_relaxed);
+                res.set_header("Retry-After", std::to_string(config.retry_after_s));
+                SendErrorResponse(res, "SERVER_BUSY", "Server is overloaded, retry later", 503);
+                return httplib::Server::HandlerResponse::Handled;
+            }
+
+            // 每个客户端的查询、命令和SSE连接分别计数，单个脚本无法占满SOME/IP通道
+            RouteClass route_class;
+            if (config.enable_rate_limiting && ClassifyRoute(req, route_class)) {
+                RateLimiter::Budget budget;
+                budget.window_ms = config.rate_limit_window_ms;
+                switch (route_class) {
+                    case RouteClass::READ: budget.requests = config.rate_limit_requests; break;
+                    case RouteClass::COMMAND: budget.requests = config.rate_limit_commands; break;
+                    case RouteClass::SSE: budget.requests = config.rate_limit_sse_connects; break;
+                }
+                uint32_t retry_after_ms = 0;
+                if (!rate_limiter_.Allow(req.remote_addr, route_class, budget, retry_after_ms)) {
+                    res.set_header("Retry-After", std::to_string(std::max<uint32_t>((retry_after_ms + 999) / 1000, 1)));
+                    SendErrorResponse(res, "RATE_LIMITED",
+                                      std::string("Too many ") + ToString(route_class) + " requests", 429);
+                    return httplib::Server::HandlerResponse::Handled;
+                }
+            }
             return httplib::Server::HandlerResponse::Unhandled;
         });
         
@@ -74,22 +168,160 @@ bool HttpServer::Initialize() {
     }
 }
 
+// ============================================================================
+// 通用API路由处理
+// ============================================================================
+
+template<typename T>
+T HttpServer::ParseRequestBody(const httplib::Request& req) const {
+    return BodyCodec::DecodeRequest<T>(req.body, BodyCodec::FromContentType(req.get_header_value("Content-Type")));
+}
+
+template<typename T>
+void HttpServer::SendSuccessResponse(const httplib::Request& req, httplib::Response& res, const T& data) {
+    const BodyFormat format = BodyCodec::FromAccept(req.get_header_value("Accept"));
+    res.set_header("Vary", "Accept");
+    if (format == BodyFormat::JSON) {
+        // 直接写入每线程复用的响应缓冲区
+        auto body = FastJsonCodec::EncodeSuccessResponse(data);
+        res.set_content(body.data(), body.size(), "application/json");
+        return;
+    }
+
+    // 二进制格式复用JsonConverter映射
+    auto response = JsonConverter::CreateSuccessResponse(JsonConverter::ToJson(data));
+    res.set_content(BodyCodec::Serialize(response, format), BodyCodec::GetContentType(format));
+}
+
+template<typename Req>
+Req HttpServer::ExtractRequest(const httplib::Request& req) const {
+    return ParseRequestBody<Req>(req);
+}
+
+// 状态查询请求的ID来自URL路径
+template<>
+application::GetLockStateReq HttpServer::ExtractRequest<application::GetLockStateReq>(
+    const httplib::Request& req) const {
+    return application::GetLockStateReq(static_cast<application::Position>(std::stoi(req.matches[1])));
+}
+
+template<>
+application::GetWindowPositionReq HttpServer::ExtractRequest<application::GetWindowPositionReq>(
+    const httplib::Request& req) const {
+    return application::GetWindowPositionReq(static_cast<application::Position>(std::stoi(req.matches[1])));
+}
+
+template<>
+application::GetLightStateReq HttpServer::ExtractRequest<application::GetLightStateReq>(
+    const httplib::Request& req) const {
+    return application::GetLightStateReq(static_cast<application::LightType>(std::stoi(req.matches[1])));
+}
+
+template<auto Method>
+void HttpServer::RegisterApiRoute(HttpMethod method, const char* path) {
+    route_metrics_.push_back(std::make_unique<RouteMetrics>(method == HttpMethod::GET ? "GET" : "POST", path));
+    RouteMetrics* metrics = route_metrics_.back().get();
+
+    auto handler = [this, metrics](const httplib::Request& req, httplib::Response& res) {
+        HandleApiRequest<Method>(req, res, *metrics);
+    };
+    if (method == HttpMethod::GET) {
+        server_.Get(path, handler);
+    } else {
+        server_.Post(path, handler);
+    }
+}
+
+template<auto Method>
+void HttpServer::HandleApiRequest(const httplib::Request& req, httplib::Response& res, RouteMetrics& metrics) {
+    using Traits = ApiMethodTraits<decltype(Method)>;
+    using Request = typename Traits::Request;
+    using Response = typename Traits::Response;
+
+    const auto start = std::chrono::steady_clock::now();
+    metrics.requests.fetch_add(1, std::memory_order_relaxed);
+
+    try {
+        if (!api_handlers_) {
+            metrics.errors.fetch_add(1, std::memory_order_relaxed);
+            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
+            return;
+        }
+
+        Request request = ExtractRequest<Request>(req);
+
+        // 回调可能在超时后才到达，promise需由回调共同持有
+        using Outcome = std::pair<communication::CallbackStatus, Response>;
+        auto promise = std::make_shared<std::promise<Outcome>>();
+        auto future = promise->get_future();
+        auto settle = [promise](communication::CallbackStatus status, const Response& response) {
+            try {
+                promise->set_value(Outcome(status, response));
+            } catch (const std::future_error&) {
+                // 重复回调，忽略
+            }
+        };
+
+        // 截止时间随请求上下文传到排队、合并和挂起请求表；下游失败时立即返回，不等满超时
+        communication::RequestContext context;
+        context.deadline = start + std::chrono::milliseconds(ConfigManager::Current().request_timeout_ms);
+        context.on_failure = [settle](communication::CallbackStatus status) { settle(status, Response{}); };
+        {
+            communication::RequestContext::Scope scope(context);
+            ((*api_handlers_).*Method)(request, [settle](const Response& response) {
+                settle(communication::CallbackStatus::COMPLETED, response);
+            });
+        }
+
+        // 下游按同一截止时间结束挂起请求，这里留少量余量等待TIMEOUT结果
+        if (future.wait_until(context.deadline + std::chrono::milliseconds(200)) == std::future_status::timeout) {
+            metrics.timeouts.fetch_add(1, std::memory_order_relaxed);
+            SendErrorResponse(res, "REQUEST_TIMEOUT", "Request timed out", 408);
+            return;
+        }
+
+        const Outcome outcome = future.get();
+        if (outcome.first == communication::CallbackStatus::TIMEOUT) {
+            metrics.timeouts.fetch_add(1, std::memory_order_relaxed);
+            SendErrorResponse(res, "UPSTREAM_TIMEOUT", "Service did not respond before the deadline", 504);
+            return;
+        }
+        if (outcome.first != communication::CallbackStatus::COMPLETED) {
+            metrics.errors.fetch_add(1, std::memory_order_relaxed);
+            SendErrorResponse(res, "SERVICE_UNAVAILABLE",
+                              std::string("Service request ") + communication::ToString(outcome.first), 503);
+            return;
+        }
+
+        SendSuccessResponse(req, res, outcome.second);
+
+        const auto latency_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        metrics.completed.fetch_add(1, std::memory_order_relaxed);
+        metrics.total_latency_us.fetch_add(latency_us, std::memory_order_relaxed);
+        uint64_t previous_max = metrics.max_latency_us.load(std::memory_order_relaxed);
+        while (latency_us > previous_max &&
+               !metrics.max_latency_us.compare_exchange_weak(previous_max, latency_us, std::memory_order_relaxed)) {
+        }
+
+    } catch (const std::exception& e) {
+        metrics.errors.fetch_add(1, std::memory_order_relaxed);
+        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
+    }
+}
+
 void HttpServer::SetupRoutes() {
     // ============================================================================
     // 静态文件服务
     // ============================================================================
     
-    // 设置静态文件目录
-    server_.set_mount_point("/", "./web");
+    // 启动时加载静态资源到内存（含预压缩版本和ETag），运行期间不再访问磁盘
+    asset_cache_.SetCachePolicy(config_.static_max_age_s, config_.versioned_max_age_s);
+    asset_cache_.Load(config_.web_root);
     
     // 默认页面
-    server_.Get("/", [](const httplib::Request&, httplib::Response& res) {
-        std::ifstream file("./web/index.html");
-        if (file.is_open()) {
-            std::stringstream buffer;
-            buffer << file.rdbuf();
-            res.set_content(buffer.str(), "text/html");
-        } else {
+    server_.Get("/", [this](const httplib::Request& req, httplib::Response& res) {
+        if (!asset_cache_.Serve(req, res)) {
             res.status = 404;
             res.set_content("Web interface not found", "text/plain");
         }
@@ -126,7 +358,9 @@ void HttpServer::SetupRoutes() {
                 {"window", "/api/window/*"},
                 {"light", "/api/light/*"},
                 {"seat", "/api/seat/*"},
-                {"events", "/api/events"}
+                {"events", "/api/events"},
+                {"metrics", "/api/metrics"},
+                {"admin", "/api/admin/config"}
             }}
         };
         
@@ -152,10 +386,14 @@ void HttpServer::SetupRoutes() {
     });
 
     // Server-Sent Events (SSE) 端点用于实时推送
-    server_.Get("/api/events", [this](const httplib::Request&, httplib::Response& res) {
-        std::cout << "[HttpServer] SSE client connected" << std::endl;
-
-        res.set_header("Content-Type", "text/event-stream");
+    // Accept为application/msgpack或application/cbor时改为推送二进制事件流
+    server_.Get("/api/events", [this](const httplib::Request& req, httplib::Response& res) {
+        const BodyFormat format = BodyCodec::FromAccept(req.get_header_value("Accept"));
+        const std::string content_type = format == BodyFormat::JSON ? "text/event-stream"
+                                                                    : BodyCodec::GetContentType(format);
+        std::cout << "[HttpServer] SSE client connected (" << content_type << ")" << std::endl;
+
+        res.set_header("Content-Type", content_type);
         res.set_header("Cache-Control", "no-cache");
         res.set_header("Connection", "keep-alive");
         res.set_header("Access-Control-Allow-Origin", "*");
@@ -163,23 +401,26 @@ void HttpServer::SetupRoutes() {
         // 为这个连接创建一个唯一ID
         auto connection_id = std::chrono::steady_clock::now().time_since_epoch().count();
 
-        res.set_chunked_content_provider("text/event-stream",
-            [this, connection_id](size_t /*offset*/, httplib::DataSink& sink) {
+        res.set_chunked_content_provider(content_type,
+            [this, connection_id, format](size_t /*offset*/, httplib::DataSink& sink) {
                 // 注册SSE连接
-                RegisterSSEConnection(connection_id, &sink);
+                RegisterSSEConnection(connection_id, &sink, format);
 
                 // 发送初始连接消息
-                std::string welcome_msg = "data: {\"type\":\"welcome\",\"message\":\"Connected to Body Controller Events\",\"timestamp\":" +
-                                        std::to_string(std::time(nullptr)) + "}\n\n";
+                nlohmann::json welcome = {
+                    {"type", "welcome"},
+                    {"message", "Connected to Body Controller Events"},
+                    {"timestamp", std::time(nullptr)}
+                };
+                std::string welcome_msg = EncodeStreamFrame(format, "", welcome);
                 if (!sink.write(welcome_msg.c_str(), welcome_msg.length())) {
                     std::cout << "[HttpServer] SSE client disconnected during welcome" << std::endl;
                     UnregisterSSEConnection(connection_id);
                     return false;
                 }
 
-                // 心跳机制：每30秒发送一次心跳
+                // 心跳机制：按配置的间隔发送心跳（间隔可热加载）
                 auto last_heartbeat = std::chrono::steady_clock::now();
-                const auto heartbeat_interval = std::chrono::seconds(30);
 
                 // 保持连接活跃，等待事件推送
                 while (true) {
@@ -188,6 +429,8 @@ void HttpServer::SetupRoutes() {
                     auto now = std::chrono::steady_clock::now();
 
                     // 发送心跳
+                    const auto heartbeat_interval =
+                        std::chrono::milliseconds(ConfigManager::Current().sse_heartbeat_interval_ms);
                     if (now - last_heartbeat >= heartbeat_interval) {
                         nlohmann::json heartbeat = {
                             {"type", "heartbeat"},
@@ -195,14 +438,16 @@ void HttpServer::SetupRoutes() {
                             {"uptime", GetUptime()}
                         };
 
-                        std::string heartbeat_data = "data: " + heartbeat.dump() + "\n\n";
+                        std::string heartbeat_data = EncodeStreamFrame(format, "", heartbeat);
                         if (!sink.write(heartbeat_data.c_str(), heartbeat_data.length())) {
                             std::cout << "[HttpServer] SSE client disconnected during heartbeat" << std::endl;
                             break;
                         }
 
                         last_heartbeat = now;
-                        std::cout << "[HttpServer] SSE heartbeat sent to connection " << connection_id << std::endl;
+                        if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+                            std::cout << "[HttpServer] SSE heartbeat sent to connection " << connection_id << std::endl;
+                        }
                     }
 
                     // 检查连接是否超时（10分钟）
@@ -220,74 +465,131 @@ void HttpServer::SetupRoutes() {
     });
     
     // ============================================================================
-    // 车门服务API路由
+    // 服务API路由表
+    // 所有路由共享同一条解析 -> 异步调用 -> 超时 -> 序列化 -> 指标统计路径
     // ============================================================================
     
-    // 设置车门锁定状态
-    server_.Post("/api/door/lock", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleDoorLockRequest(req, res);
-    });
+    // 车门服务
+    RegisterApiRoute<&ApiHandlers::HandleDoorLockRequest>(HttpMethod::POST, "/api/door/lock");
+    RegisterApiRoute<&ApiHandlers::HandleDoorStatusRequest>(HttpMethod::GET, "/api/door/([0-9]+)/status");
     
-    // 获取车门锁定状态
-    server_.Get("/api/door/([0-9]+)/status", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleDoorStatusRequest(req, res);
-    });
+    // 车窗服务
+    RegisterApiRoute<&ApiHandlers::HandleWindowPositionRequest>(HttpMethod::POST, "/api/window/position");
+    RegisterApiRoute<&ApiHandlers::HandleWindowControlRequest>(HttpMethod::POST, "/api/window/control");
+    RegisterApiRoute<&ApiHandlers::HandleWindowPositionStatusRequest>(HttpMethod::GET, "/api/window/([0-9]+)/position");
     
-    // ============================================================================
-    // 车窗服务API路由
-    // ============================================================================
+    // 灯光服务
+    RegisterApiRoute<&ApiHandlers::HandleHeadlightRequest>(HttpMethod::POST, "/api/light/headlight");
+    RegisterApiRoute<&ApiHandlers::HandleIndicatorRequest>(HttpMethod::POST, "/api/light/indicator");
+    RegisterApiRoute<&ApiHandlers::HandlePositionLightRequest>(HttpMethod::POST, "/api/light/position");
+    RegisterApiRoute<&ApiHandlers::HandleLightStatusRequest>(HttpMethod::GET, "/api/light/([0-9]+)/status");
     
-    // 设置车窗位置
-    server_.Post("/api/window/position", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleWindowPositionRequest(req, res);
-    });
+    // 座椅服务
+    RegisterApiRoute<&ApiHandlers::HandleSeatAdjustRequest>(HttpMethod::POST, "/api/seat/adjust");
+    RegisterApiRoute<&ApiHandlers::HandleSeatMemoryRecallRequest>(HttpMethod::POST, "/api/seat/memory/recall");
+    RegisterApiRoute<&ApiHandlers::HandleSeatMemorySaveRequest>(HttpMethod::POST, "/api/seat/memory/save");
     
-    // 控制车窗升降
-    server_.Post("/api/window/control", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleWindowControlRequest(req, res);
-    });
-    
-    // 获取车窗位置
-    server_.Get("/api/window/([0-9]+)/position", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleWindowPositionStatusRequest(req, res);
+    // 路由指标
+    server_.Get("/api/metrics", [this](const httplib::Request&, httplib::Response& res) {
+        nlohmann::json routes = nlohmann::json::array();
+        for (const auto& metrics : route_metrics_) {
+            const uint64_t completed = metrics->completed.load();
+            routes.push_back({
+                {"method", metrics->method},
+                {"path", metrics->path},
+                {"requests", metrics->requests.load()},
+                {"completed", completed},
+                {"errors", metrics->errors.load()},
+                {"timeouts", metrics->timeouts.load()},
+                {"avg_latency_us", completed ? metrics->total_latency_us.load() / completed : 0},
+                {"max_latency_us", metrics->max_latency_us.load()}
+            });
+        }
+        nlohmann::json data = {
+            {"routes", routes},
+            {"http_pool", {
+                {"threads", pool_stats_->threads.load()},
+                {"active", pool_stats_->active.load()},
+                {"queued", pool_stats_->queued.load()},
+                {"completed", pool_stats_->completed.load()},
+                {"rejected", pool_stats_->rejected.load()},
+                {"shed", pool_stats_->shed.load()}
+            }},
+            {"rate_limiter", {
+                {"rejected_read", rate_limiter_.GetRejectedCount(RouteClass::READ)},
+                {"rejected_command", rate_limiter_.GetRejectedCount(RouteClass::COMMAND)},
+                {"rejected_sse", rate_limiter_.GetRejectedCount(RouteClass::SSE)},
+                {"untracked", rate_limiter_.GetUntrackedCount()}
+            }}
+        };
+        if (api_handlers_) {
+            data["someip_lanes"] = api_handlers_->GetLaneMetrics();
+        }
+        auto response = JsonConverter::CreateSuccessResponse(data);
+        res.set_content(response.dump(2), "application/json");
     });
     
     // ============================================================================
-    // 灯光服务API路由
+    // 配置管理（仅限本机访问）
     // ============================================================================
     
-    // 设置前大灯状态
-    server_.Post("/api/light/headlight", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleHeadlightRequest(req, res);
+    // 当前生效的配置快照
+    server_.Get("/api/admin/config", [this](const httplib::Request& req, httplib::Response& res) {
+        if (!IsLoopback(req)) {
+            SendErrorResponse(res, "FORBIDDEN", "Admin endpoints are only available from localhost", 403);
+            return;
+        }
+        nlohmann::json data = {
+            {"version", ConfigManager::GetVersion()},
+            {"config_file", ConfigManager::GetConfigFile()},
+            {"config", ConfigManager::ToJson(*ConfigManager::GetSnapshot())}
+        };
+        res.set_content(JsonConverter::CreateSuccessResponse(data).dump(2), "application/json");
     });
     
-    // 设置转向灯状态
-    server_.Post("/api/light/indicator", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleIndicatorRequest(req, res);
+    // 从配置文件重新加载（与文件监视触发的加载相同）
+    server_.Post("/api/admin/config/reload", [this](const httplib::Request& req, httplib::Response& res) {
+        if (!IsLoopback(req)) {
+            SendErrorResponse(res, "FORBIDDEN", "Admin endpoints are only available from localhost", 403);
+            return;
+        }
+        std::string error;
+        if (!ConfigManager::Reload(error)) {
+            SendErrorResponse(res, "CONFIG_RELOAD_FAILED", error, 400);
+            return;
+        }
+        nlohmann::json data = {{"version", ConfigManager::GetVersion()}};
+        res.set_content(JsonConverter::CreateSuccessResponse(data).dump(2), "application/json");
     });
     
-    // 设置位置灯状态
-    server_.Post("/api/light/position", [this](const httplib::Request& req, httplib::Response& res) {
-        HandlePositionLightRequest(req, res);
+    // 按JSON合并补丁修改运行期配置（下一次从文件加载时会被文件内容覆盖）
+    server_.Post("/api/admin/config", [this](const httplib::Request& req, httplib::Response& res) {
+        if (!IsLoopback(req)) {
+            SendErrorResponse(res, "FORBIDDEN", "Admin endpoints are only available from localhost", 403);
+            return;
+        }
+        std::string error;
+        try {
+            if (!ConfigManager::ApplyPatch(nlohmann::json::parse(req.body), error)) {
+                SendErrorResponse(res, "INVALID_CONFIG", error, 400);
+                return;
+            }
+        } catch (const std::exception& e) {
+            SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
+            return;
+        }
+        nlohmann::json data = {{"version", ConfigManager::GetVersion()}};
+        res.set_content(JsonConverter::CreateSuccessResponse(data).dump(2), "application/json");
     });
     
     // ============================================================================
-    // 座椅服务API路由
+    // 其余静态资源（最后注册，避免遮蔽API路由）
     // ============================================================================
     
-    // 调节座椅
-    server_.Post("/api/seat/adjust", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleSeatAdjustRequest(req, res);
-    });
-    
-    // 恢复记忆位置
-    server_.Post("/api/seat/memory/recall", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleSeatMemoryRecallRequest(req, res);
-    });
-    
-    // 保存记忆位置
-    server_.Post("/api/seat/memory/save", [this](const httplib::Request& req, httplib::Response& res) {
-        HandleSeatMemorySaveRequest(req, res);
+    server_.Get(R"(/(?!api/).+)", [this](const httplib::Request& req, httplib::Response& res) {
+        if (!asset_cache_.Serve(req, res)) {
+            res.status = 404;
+        }
     });
     
     std::cout << "[HttpServer] API routes configured" << std::endl;
@@ -311,7 +613,7 @@ bool HttpServer::Start() {
         std::cout << "[HttpServer] Starting HTTP server on port " << port_ << std::endl;
         running_ = true;
         
-        if (!server_.listen("0.0.0.0", port_)) {
+        if (!server_.listen(config_.http_host, port_)) {
             std::cerr << "[HttpServer] Failed to start server on port " << port_ << std::endl;
             running_ = false;
         }
@@ -362,319 +664,6 @@ double HttpServer::GetUptime() const {
     return duration.count();
 }
 
-// ============================================================================
-// 私有方法：请求处理
-// ============================================================================
-
-void HttpServer::HandleDoorLockRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-        
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::SetLockStateReq>(json_data);
-        
-        api_handlers_->HandleDoorLockRequest(request, [&res](const application::SetLockStateResp& response) {
-            auto json_response = JsonConverter::ToJson(response);
-            auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-            res.set_content(success_response.dump(), "application/json");
-        });
-        
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleDoorStatusRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-        
-        int doorId = std::stoi(req.matches[1]);
-        application::GetLockStateReq request(static_cast<application::Position>(doorId));
-        
-        api_handlers_->HandleDoorStatusRequest(request, [&res](const application::GetLockStateResp& response) {
-            auto json_response = JsonConverter::ToJson(response);
-            auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-            res.set_content(success_response.dump(), "application/json");
-        });
-        
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleWindowPositionRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::SetWindowPositionReq>(json_data);
-
-        api_handlers_->HandleWindowPositionRequest(request, [&res](const application::SetWindowPositionResp& response) {
-            auto json_response = JsonConverter::ToJson(response);
-            auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-            res.set_content(success_response.dump(), "application/json");
-        });
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleWindowControlRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::ControlWindowReq>(json_data);
-
-        api_handlers_->HandleWindowControlRequest(request, [&res](const application::ControlWindowResp& response) {
-            auto json_response = JsonConverter::ToJson(response);
-            auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-            res.set_content(success_response.dump(), "application/json");
-        });
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleWindowPositionStatusRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        int windowId = std::stoi(req.matches[1]);
-        application::GetWindowPositionReq request(static_cast<application::Position>(windowId));
-
-        api_handlers_->HandleWindowPositionStatusRequest(request, [&res](const application::GetWindowPositionResp& response) {
-            auto json_response = JsonConverter::ToJson(response);
-            auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-            res.set_content(success_response.dump(), "application/json");
-        });
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleHeadlightRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::SetHeadlightStateReq>(json_data);
-
-        // 使用同步等待来确保回调在函数返回前执行
-        std::promise<application::SetHeadlightStateResp> promise;
-        auto future = promise.get_future();
-
-        api_handlers_->HandleHeadlightRequest(request, [&promise](const application::SetHeadlightStateResp& response) {
-            promise.set_value(response);
-        });
-
-        // 等待回调完成（最多等待5秒）
-        if (future.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) {
-            SendErrorResponse(res, "REQUEST_TIMEOUT", "Request timed out", 408);
-            return;
-        }
-
-        auto response = future.get();
-        auto json_response = JsonConverter::ToJson(response);
-        auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-        res.set_content(success_response.dump(), "application/json");
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleIndicatorRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::SetIndicatorStateReq>(json_data);
-
-        // 使用同步等待来确保回调在函数返回前执行
-        std::promise<application::SetIndicatorStateResp> promise;
-        auto future = promise.get_future();
-
-        api_handlers_->HandleIndicatorRequest(request, [&promise](const application::SetIndicatorStateResp& response) {
-            promise.set_value(response);
-        });
-
-        // 等待回调完成（最多等待5秒）
-        if (future.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) {
-            SendErrorResponse(res, "REQUEST_TIMEOUT", "Request timed out", 408);
-            return;
-        }
-
-        auto response = future.get();
-        auto json_response = JsonConverter::ToJson(response);
-        auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-        res.set_content(success_response.dump(), "application/json");
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandlePositionLightRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::SetPositionLightStateReq>(json_data);
-
-        // 使用同步等待来确保回调在函数返回前执行
-        std::promise<application::SetPositionLightStateResp> promise;
-        auto future = promise.get_future();
-
-        api_handlers_->HandlePositionLightRequest(request, [&promise](const application::SetPositionLightStateResp& response) {
-            promise.set_value(response);
-        });
-
-        // 等待回调完成（最多等待5秒）
-        if (future.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) {
-            SendErrorResponse(res, "REQUEST_TIMEOUT", "Request timed out", 408);
-            return;
-        }
-
-        auto response = future.get();
-        auto json_response = JsonConverter::ToJson(response);
-        auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-        res.set_content(success_response.dump(), "application/json");
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleSeatAdjustRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::AdjustSeatReq>(json_data);
-
-        // 使用同步等待来确保回调在函数返回前执行
-        std::promise<application::AdjustSeatResp> promise;
-        auto future = promise.get_future();
-
-        api_handlers_->HandleSeatAdjustRequest(request, [&promise](const application::AdjustSeatResp& response) {
-            promise.set_value(response);
-        });
-
-        // 等待回调完成（最多等待5秒）
-        if (future.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) {
-            SendErrorResponse(res, "REQUEST_TIMEOUT", "Request timed out", 408);
-            return;
-        }
-
-        auto response = future.get();
-        auto json_response = JsonConverter::ToJson(response);
-        auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-        res.set_content(success_response.dump(), "application/json");
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleSeatMemoryRecallRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::RecallMemoryPositionReq>(json_data);
-
-        // 使用同步等待来确保回调在函数返回前执行
-        std::promise<application::RecallMemoryPositionResp> promise;
-        auto future = promise.get_future();
-
-        api_handlers_->HandleSeatMemoryRecallRequest(request, [&promise](const application::RecallMemoryPositionResp& response) {
-            promise.set_value(response);
-        });
-
-        // 等待回调完成（最多等待5秒）
-        if (future.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) {
-            SendErrorResponse(res, "REQUEST_TIMEOUT", "Request timed out", 408);
-            return;
-        }
-
-        auto response = future.get();
-        auto json_response = JsonConverter::ToJson(response);
-        auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-        res.set_content(success_response.dump(), "application/json");
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
-void HttpServer::HandleSeatMemorySaveRequest(const httplib::Request& req, httplib::Response& res) {
-    try {
-        if (!api_handlers_) {
-            SendErrorResponse(res, "SERVICE_UNAVAILABLE", "API handlers not available", 503);
-            return;
-        }
-
-        auto json_data = nlohmann::json::parse(req.body);
-        auto request = JsonConverter::FromJson<application::SaveMemoryPositionReq>(json_data);
-
-        // 使用同步等待来确保回调在函数返回前执行
-        std::promise<application::SaveMemoryPositionResp> promise;
-        auto future = promise.get_future();
-
-        api_handlers_->HandleSeatMemorySaveRequest(request, [&promise](const application::SaveMemoryPositionResp& response) {
-            promise.set_value(response);
-        });
-
-        // 等待回调完成（最多等待5秒）
-        if (future.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) {
-            SendErrorResponse(res, "REQUEST_TIMEOUT", "Request timed out", 408);
-            return;
-        }
-
-        auto response = future.get();
-        auto json_response = JsonConverter::ToJson(response);
-        auto success_response = JsonConverter::CreateSuccessResponse(json_response);
-        res.set_content(success_response.dump(), "application/json");
-
-    } catch (const std::exception& e) {
-        SendErrorResponse(res, "INVALID_REQUEST", e.what(), 400);
-    }
-}
-
 void HttpServer::SendErrorResponse(httplib::Response& res, const std::string& error,
                                   const std::string& message, int status_code) {
     auto error_json = JsonConverter::CreateErrorResponse(error, message);
@@ -686,9 +675,9 @@ void HttpServer::SendErrorResponse(httplib::Response& res, const std::string& er
 // SSE连接管理实现
 // ============================================================================
 
-void HttpServer::RegisterSSEConnection(uint64_t connection_id, httplib::DataSink* sink) {
+void HttpServer::RegisterSSEConnection(uint64_t connection_id, httplib::DataSink* sink, BodyFormat format) {
     std::lock_guard<std::mutex> lock(sse_connections_mutex_);
-    sse_connections_[connection_id] = sink;
+    sse_connections_[connection_id] = SSEConnection{sink, format};
     std::cout << "[HttpServer] SSE connection registered: " << connection_id
               << " (total: " << sse_connections_.size() << ")" << std::endl;
 }
@@ -703,21 +692,32 @@ void HttpServer::UnregisterSSEConnection(uint64_t connection_id) {
     }
 }
 
-void HttpServer::BroadcastSSEEvent(const std::string& event_data) {
+void HttpServer::BroadcastSSEEvent(const std::string& event_type, const nlohmann::json& envelope) {
     std::lock_guard<std::mutex> lock(sse_connections_mutex_);
 
     if (sse_connections_.empty()) {
-        std::cout << "[HttpServer] No SSE connections to broadcast to" << std::endl;
         return;
     }
 
-    std::cout << "[HttpServer] Broadcasting SSE event to " << sse_connections_.size() << " connections" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[HttpServer] Broadcasting SSE event to " << sse_connections_.size() << " connections" << std::endl;
+    }
+
+    // 每种格式只编码一次
+    std::string frames[3];
+    bool encoded[3] = {false, false, false};
 
     // 记录失效的连接
     std::vector<uint64_t> dead_connections;
 
-    for (auto& [connection_id, sink] : sse_connections_) {
-        if (!sink->write(event_data.c_str(), event_data.length())) {
+    for (auto& [connection_id, connection] : sse_connections_) {
+        const auto index = static_cast<size_t>(connection.format);
+        if (!encoded[index]) {
+            frames[index] = EncodeStreamFrame(connection.format, event_type, envelope);
+            encoded[index] = true;
+        }
+        const std::string& frame = frames[index];
+        if (!connection.sink->write(frame.data(), frame.size())) {
             std::cout << "[HttpServer] SSE connection " << connection_id << " is dead, marking for removal" << std::endl;
             dead_connections.push_back(connection_id);
         }
@@ -733,28 +733,40 @@ void HttpServer::BroadcastSSEEvent(const std::string& event_data) {
     }
 }
 
+std::string HttpServer::EncodeStreamFrame(BodyFormat format, const std::string& event_type,
+                                          const nlohmann::json& envelope) {
+    if (format != BodyFormat::JSON) {
+        // 二进制流：MessagePack/CBOR值自定界，直接顺序拼接
+        return BodyCodec::Serialize(envelope, format);
+    }
+
+    // 生成符合SSE规范的事件帧：event: <type>\n data: <json>\n\n
+    const std::string payload = envelope.dump();
+    std::string frame;
+    frame.reserve(16 + event_type.size() + payload.size());
+    if (!event_type.empty()) {
+        frame += "event: ";
+        frame += event_type;
+        frame += "\n";
+    }
+    frame += "data: ";
+    frame += payload;
+    frame += "\n\n";
+    return frame;
+}
+
 // ============================================================================
 // SSE事件推送实现
 // ============================================================================
 
 void HttpServer::PublishEvent(const std::string& event_type, const nlohmann::json& data) {
-    // 生成符合SSE规范的事件帧：event: <type>\n data: <json>\n\n
     nlohmann::json envelope = {
         {"type", event_type},
         {"data", data},
         {"timestamp", std::time(nullptr)}
     };
 
-    std::string frame;
-    frame.reserve(64 + envelope.dump().size());
-    frame += "event: ";
-    frame += event_type;
-    frame += "\n";
-    frame += "data: ";
-    frame += envelope.dump();
-    frame += "\n\n";
-
-    BroadcastSSEEvent(frame);
+    BroadcastSSEEvent(event_type, envelope);
 }
 
 void HttpServer::PushDoorLockEvent(int door_id, bool lock_state) {
@@ -764,8 +776,10 @@ void HttpServer::PushDoorLockEvent(int door_id, bool lock_state) {
     };
     PublishEvent("door_lock_changed", data);
 
-    std::cout << "[HttpServer] Pushed door lock event: door " << door_id
-              << " " << (lock_state ? "locked" : "unlocked") << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[HttpServer] Pushed door lock event: door " << door_id
+                  << " " << (lock_state ? "locked" : "unlocked") << std::endl;
+    }
 }
 
 void HttpServer::PushWindowPositionEvent(int window_id, int position) {
@@ -775,8 +789,10 @@ void HttpServer::PushWindowPositionEvent(int window_id, int position) {
     };
     PublishEvent("window_position_changed", data);
 
-    std::cout << "[HttpServer] Pushed window position event: window " << window_id
-              << " position " << position << "%" << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[HttpServer] Pushed window position event: window " << window_id
+                  << " position " << position << "%" << std::endl;
+    }
 }
 
 void HttpServer::PushLightStateEvent(const std::string& light_type, bool state) {
@@ -786,8 +802,10 @@ void HttpServer::PushLightStateEvent(const std::string& light_type, bool state)
     };
     PublishEvent("light_state_changed", data);
 
-    std::cout << "[HttpServer] Pushed light state event: " << light_type
-              << " " << (state ? "on" : "off") << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[HttpServer] Pushed light state event: " << light_type
+                  << " " << (state ? "on" : "off") << std::endl;
+    }
 }
 
 void HttpServer::PushSeatPositionEvent(int seat_id, const std::string& position) {
@@ -797,8 +815,10 @@ void HttpServer::PushSeatPositionEvent(int seat_id, const std::string& position)
     };
     PublishEvent("seat_position_changed", data);
 
-    std::cout << "[HttpServer] Pushed seat position event: seat " << seat_id
-              << " position " << position << std::endl;
+    if (communication::IsLogEnabled(communication::LogLevel::DEBUG)) {
+        std::cout << "[HttpServer] Pushed seat position event: seat " << seat_id
+                  << " position " << position << std::endl;
+    }
 }
 
 } // namespace web_api
@@ -1,4 +1,5 @@
 #include "web_api/json_converter.h"
+#include "web_api/api_handlers.h"
 #include <nlohmann/json.hpp>
 
 namespace body_controller {
@@ -69,6 +70,13 @@ json JsonConverter::ToJson(const application::SetWindowPositionResp& resp) {
     };
 }
 
+json JsonConverter::ToJson(const SetWindowPositionResult& result) {
+    json j = ToJson(result.response);
+    j["commandID"] = result.commandID;
+    j["collapsed"] = result.collapsed;
+    return j;
+}
+
 json JsonConverter::ToJson(const application::ControlWindowReq& req) {
     return json{
         {"windowID", static_cast<int>(req.windowID)},
@@ -146,6 +154,19 @@ json JsonConverter::ToJson(const application::SetPositionLightStateResp& resp) {
     };
 }
 
+json JsonConverter::ToJson(const application::GetLightStateReq& req) {
+    return json{
+        {"lightType", static_cast<int>(req.lightType)}
+    };
+}
+
+json JsonConverter::ToJson(const application::GetLightStateResp& resp) {
+    return json{
+        {"lightType", static_cast<int>(resp.lightType)},
+        {"state", static_cast<int>(resp.state)}
+    };
+}
+
 json JsonConverter::ToJson(const application::OnLightStateChangedData& data) {
     return json{
         {"lightType", static_cast<int>(data.lightType)},
@@ -160,7 +181,8 @@ json JsonConverter::ToJson(const application::OnLightStateChangedData& data) {
 json JsonConverter::ToJson(const application::AdjustSeatReq& req) {
     return json{
         {"axis", static_cast<int>(req.axis)},
-        {"direction", static_cast<int>(req.direction)}
+        {"direction", static_cast<int>(req.direction)},
+        {"seatID", static_cast<int>(req.seatID)}
     };
 }
 
@@ -173,7 +195,9 @@ json JsonConverter::ToJson(const application::AdjustSeatResp& resp) {
 
 json JsonConverter::ToJson(const application::RecallMemoryPositionReq& req) {
     return json{
-        {"presetID", static_cast<int>(req.presetID)}
+        {"presetID", static_cast<int>(req.presetID)},
+        {"userID", static_cast<int>(req.userID)},
+        {"seatID", static_cast<int>(req.seatID)}
     };
 }
 
@@ -186,7 +210,9 @@ json JsonConverter::ToJson(const application::RecallMemoryPositionResp& resp) {
 
 json JsonConverter::ToJson(const application::SaveMemoryPositionReq& req) {
     return json{
-        {"presetID", static_cast<int>(req.presetID)}
+        {"presetID", static_cast<int>(req.presetID)},
+        {"userID", static_cast<int>(req.userID)},
+        {"seatID", static_cast<int>(req.seatID)}
     };
 }
 
@@ -200,7 +226,8 @@ json JsonConverter::ToJson(const application::SaveMemoryPositionResp& resp) {
 json JsonConverter::ToJson(const application::OnSeatPositionChangedData& data) {
     return json{
         {"axis", static_cast<int>(data.axis)},
-        {"newPosition", static_cast<int>(data.newPosition)}
+        {"newPosition", static_cast<int>(data.newPosition)},
+        {"seatID", static_cast<int>(data.seatID)}
     };
 }
 
@@ -211,6 +238,14 @@ json JsonConverter::ToJson(const application::OnMemorySaveConfirmData& data) {
     };
 }
 
+json JsonConverter::ToJson(const application::OnSeatRecallCompleteData& data) {
+    return json{
+        {"seatID", static_cast<int>(data.seatID)},
+        {"presetID", static_cast<int>(data.presetID)},
+        {"result", static_cast<int>(data.result)}
+    };
+}
+
 // ============================================================================
 // JSON到C++结构体的转换
 // ============================================================================
@@ -266,22 +301,33 @@ application::SetPositionLightStateReq JsonConverter::FromJson(const json& j, app
     );
 }
 
+application::GetLightStateReq JsonConverter::FromJson(const json& j, application::GetLightStateReq*) {
+    return application::GetLightStateReq(
+        static_cast<application::LightType>(j["lightType"].get<int>())
+    );
+}
+
 application::AdjustSeatReq JsonConverter::FromJson(const json& j, application::AdjustSeatReq*) {
     return application::AdjustSeatReq(
         static_cast<application::SeatAxis>(j["axis"].get<int>()),
-        static_cast<application::SeatDirection>(j["direction"].get<int>())
+        static_cast<application::SeatDirection>(j["direction"].get<int>()),
+        static_cast<application::Position>(j.value("seatID", 0))
     );
 }
 
 application::RecallMemoryPositionReq JsonConverter::FromJson(const json& j, application::RecallMemoryPositionReq*) {
     return application::RecallMemoryPositionReq(
-        static_cast<uint8_t>(j["presetID"].get<int>())
+        static_cast<uint8_t>(j["presetID"].get<int>()),
+        static_cast<uint8_t>(j.value("userID", 0)),
+        static_cast<application::Position>(j.value("seatID", 0))
     );
 }
 
 application::SaveMemoryPositionReq JsonConverter::FromJson(const json& j, application::SaveMemoryPositionReq*) {
     return application::SaveMemoryPositionReq(
-        static_cast<uint8_t>(j["presetID"].get<int>())
+        static_cast<uint8_t>(j["presetID"].get<int>()),
+        static_cast<uint8_t>(j.value("userID", 0)),
+        static_cast<application::Position>(j.value("seatID", 0))
     );
 }
 
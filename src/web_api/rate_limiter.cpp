@@ -0,0 +1,102 @@
+#include "web_api/rate_limiter.h"
+#include <algorithm>
+#include <functional>
+
+namespace body_controller {
+namespace web_api {
+
+const char* ToString(RouteClass route_class) {
+    switch (route_class) {
+        case RouteClass::READ: return "read";
+        case RouteClass::COMMAND: return "command";
+        case RouteClass::SSE: return "sse";
+        default: return "unknown";
+    }
+}
+
+RateLimiter::RateLimiter()
+    : epoch_(std::chrono::steady_clock::now()) {
+}
+
+uint64_t RateLimiter::NowMicros() const {
+    // 从1开始，tat为0表示桶是满的
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - epoch_).count()) + 1;
+}
+
+bool RateLimiter::Allow(const std::string& client, RouteClass route_class, const Budget& budget,
+                        uint32_t& retry_after_ms) {
+    retry_after_ms = 0;
+    if (budget.requests == 0 || budget.window_ms == 0) {
+        return true;
+    }
+
+    uint64_t key = std::hash<std::string>{}(client) * 31 + static_cast<uint64_t>(route_class) + 1;
+    if (key == 0) {
+        key = 1;
+    }
+
+    const uint64_t now = NowMicros();
+    Slot* slot = Acquire(key, now);
+    if (!slot) {
+        untracked_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // GCRA：每个请求把TAT推后一个发放间隔，TAT领先当前时间超过容差（容量-1个间隔）即拒绝
+    const uint64_t window_us = static_cast<uint64_t>(budget.window_ms) * 1000;
+    const uint64_t interval_us = std::max<uint64_t>(window_us / budget.requests, 1);
+    const uint64_t tolerance_us = window_us - interval_us;
+
+    uint64_t tat = slot->tat.load(std::memory_order_relaxed);
+    while (true) {
+        const uint64_t start = std::max(tat, now);
+        if (start - now > tolerance_us) {
+            const uint64_t wait_us = start - now - tolerance_us;
+            retry_after_ms = static_cast<uint32_t>(std::min<uint64_t>((wait_us + 999) / 1000, UINT32_MAX));
+            rejected_[static_cast<size_t>(route_class)].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (slot->tat.compare_exchange_weak(tat, start + interval_us, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+RateLimiter::Slot* RateLimiter::Acquire(uint64_t key, uint64_t now_us) {
+    Shard& shard = shards_[(key >> 32) % SHARD_COUNT];
+    const size_t first = static_cast<size_t>(key % SLOTS_PER_SHARD);
+
+    Slot* idle = nullptr;
+    uint64_t idle_key = 0;
+    for (size_t i = 0; i < SLOTS_PER_SHARD; ++i) {
+        Slot& slot = shard.slots[(first + i) % SLOTS_PER_SHARD];
+        uint64_t current = slot.key.load(std::memory_order_acquire);
+        if (current == key) {
+            return &slot;
+        }
+        if (current == 0) {
+            if (slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+                return &slot;
+            }
+            if (current == key) {
+                return &slot;
+            }
+            continue;
+        }
+        // 已补满的桶不再有状态，可以让给新键
+        if (!idle && slot.tat.load(std::memory_order_relaxed) <= now_us) {
+            idle = &slot;
+            idle_key = current;
+        }
+    }
+
+    if (idle && idle->key.compare_exchange_strong(idle_key, key, std::memory_order_acq_rel)) {
+        idle->tat.store(0, std::memory_order_relaxed);
+        return idle;
+    }
+    return nullptr;
+}
+
+} // namespace web_api
+} // namespace body_controller
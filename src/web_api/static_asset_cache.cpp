@@ -0,0 +1,325 @@
+#include "web_api/static_asset_cache.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef HAVE_BROTLI
+#include <brotli/encode.h>
+#endif
+
+namespace body_controller {
+namespace web_api {
+
+namespace {
+
+std::string Trim(const std::string& value) {
+    const auto begin = value.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    const auto end = value.find_last_not_of(" \t");
+    return value.substr(begin, end - begin + 1);
+}
+
+std::vector<std::string> SplitList(const std::string& value) {
+    std::vector<std::string> items;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        item = Trim(item);
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+/**
+ * @brief 判断Accept-Encoding是否接受指定编码（q=0视为拒绝）
+ */
+bool AcceptsEncoding(const std::string& accept_encoding, const std::string& encoding) {
+    for (const auto& item : SplitList(accept_encoding)) {
+        const auto semicolon = item.find(';');
+        if (Trim(item.substr(0, semicolon)) != encoding) {
+            continue;
+        }
+        if (semicolon == std::string::npos) {
+            return true;
+        }
+        const auto q = item.find("q=", semicolon);
+        return q == std::string::npos || std::atof(item.c_str() + q + 2) > 0.0;
+    }
+    return false;
+}
+
+/**
+ * @brief 判断If-None-Match是否匹配（弱比较）
+ */
+bool MatchesETag(const std::string& if_none_match, const std::string& etag) {
+    for (auto candidate : SplitList(if_none_match)) {
+        if (candidate == "*") {
+            return true;
+        }
+        if (candidate.rfind("W/", 0) == 0) {
+            candidate = candidate.substr(2);
+        }
+        if (candidate == etag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// ============================================================================
+// 加载
+// ============================================================================
+
+void StaticAssetCache::SetCachePolicy(uint32_t max_age_s, uint32_t versioned_max_age_s) {
+    cache_control_ = max_age_s == 0 ? "no-cache" : "public, max-age=" + std::to_string(max_age_s);
+    cache_control_versioned_ = "public, max-age=" + std::to_string(versioned_max_age_s) + ", immutable";
+}
+
+bool StaticAssetCache::Load(const std::string& root_dir) {
+    namespace fs = std::filesystem;
+
+    std::error_code ec;
+    if (!fs::is_directory(root_dir, ec)) {
+        std::cerr << "[StaticAssetCache] Directory not found: " << root_dir << std::endl;
+        return false;
+    }
+
+    assets_.clear();
+    total_bytes_ = 0;
+    size_t original_bytes = 0;
+
+    for (fs::recursive_directory_iterator it(root_dir, ec), end; it != end; it.increment(ec)) {
+        if (ec) {
+            break;
+        }
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+
+        const std::string file_path = it->path().string();
+        std::ifstream file(file_path, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "[StaticAssetCache] Failed to read: " << file_path << std::endl;
+            continue;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+
+        Asset asset;
+        asset.identity = buffer.str();
+        asset.content_type = GetContentType(file_path);
+        asset.etag = ComputeETag(asset.identity);
+        asset.versioned = IsVersionedName(it->path().filename().string());
+
+        if (IsCompressible(asset.content_type)) {
+            // 只保留确实更小的压缩版本
+            asset.gzip = CompressGzip(asset.identity);
+            if (asset.gzip.size() >= asset.identity.size()) {
+                asset.gzip.clear();
+            }
+            asset.brotli = CompressBrotli(asset.identity);
+            if (asset.brotli.size() >= asset.identity.size()) {
+                asset.brotli.clear();
+            }
+        }
+
+        std::string url_path = "/" + fs::relative(it->path(), root_dir, ec).generic_string();
+        original_bytes += asset.identity.size();
+        total_bytes_ += asset.identity.size() + asset.gzip.size() + asset.brotli.size();
+        assets_[url_path] = std::move(asset);
+    }
+
+    std::cout << "[StaticAssetCache] Loaded " << assets_.size() << " assets from " << root_dir
+              << " (" << original_bytes << " bytes, " << total_bytes_ << " bytes with compressed variants)"
+              << std::endl;
+    return true;
+}
+
+// ============================================================================
+// 请求处理
+// ============================================================================
+
+bool StaticAssetCache::Serve(const httplib::Request& req, httplib::Response& res) const {
+    std::string path = req.path;
+    if (path.empty() || path.back() == '/') {
+        path += "index.html";
+    }
+
+    auto it = assets_.find(path);
+    if (it == assets_.end()) {
+        return false;
+    }
+    const Asset& asset = it->second;
+
+    // 选择编码：brotli > gzip > 原始内容
+    const std::string accept_encoding = req.get_header_value("Accept-Encoding");
+    const std::string* body = &asset.identity;
+    std::string etag = asset.etag;
+    const char* content_encoding = nullptr;
+    if (!asset.brotli.empty() && AcceptsEncoding(accept_encoding, "br")) {
+        body = &asset.brotli;
+        content_encoding = "br";
+    } else if (!asset.gzip.empty() && AcceptsEncoding(accept_encoding, "gzip")) {
+        body = &asset.gzip;
+        content_encoding = "gzip";
+    }
+    if (content_encoding) {
+        // 强ETag需区分不同表示
+        etag.insert(etag.size() - 1, std::string("-") + content_encoding);
+    }
+
+    const bool immutable = asset.versioned || req.has_param("v");
+    res.set_header("ETag", etag);
+    res.set_header("Cache-Control", immutable ? cache_control_versioned_ : cache_control_);
+    if (!asset.gzip.empty() || !asset.brotli.empty()) {
+        res.set_header("Vary", "Accept-Encoding");
+    }
+
+    if (req.has_header("If-None-Match") && MatchesETag(req.get_header_value("If-None-Match"), etag)) {
+        res.status = 304;
+        return true;
+    }
+
+    if (content_encoding) {
+        res.set_header("Content-Encoding", content_encoding);
+    }
+    res.set_content(body->data(), body->size(), asset.content_type);
+    return true;
+}
+
+// ============================================================================
+// 辅助方法
+// ============================================================================
+
+std::string StaticAssetCache::GetContentType(const std::string& path) {
+    static const std::unordered_map<std::string, std::string> types = {
+        {".html", "text/html"},
+        {".htm", "text/html"},
+        {".css", "text/css"},
+        {".js", "application/javascript"},
+        {".json", "application/json"},
+        {".svg", "image/svg+xml"},
+        {".png", "image/png"},
+        {".jpg", "image/jpeg"},
+        {".jpeg", "image/jpeg"},
+        {".gif", "image/gif"},
+        {".ico", "image/x-icon"},
+        {".woff", "font/woff"},
+        {".woff2", "font/woff2"},
+        {".txt", "text/plain"}
+    };
+
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    auto it = types.find(extension);
+    return it != types.end() ? it->second : "application/octet-stream";
+}
+
+bool StaticAssetCache::IsCompressible(const std::string& content_type) {
+    return content_type.rfind("text/", 0) == 0 ||
+           content_type == "application/javascript" ||
+           content_type == "application/json" ||
+           content_type == "image/svg+xml";
+}
+
+bool StaticAssetCache::IsVersionedName(const std::string& filename) {
+    // 形如 name.<hash>.ext 或 name-<hash>.ext，hash为至少8位十六进制
+    std::vector<std::string> segments;
+    std::string segment;
+    for (char c : filename) {
+        if (c == '.' || c == '-') {
+            segments.push_back(segment);
+            segment.clear();
+        } else {
+            segment += c;
+        }
+    }
+    segments.push_back(segment);
+
+    for (size_t i = 1; i + 1 < segments.size(); ++i) {
+        const auto& part = segments[i];
+        if (part.size() >= 8 &&
+            std::all_of(part.begin(), part.end(), [](unsigned char c) { return std::isxdigit(c) != 0; })) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string StaticAssetCache::ComputeETag(const std::string& content) {
+    // FNV-1a 64位内容哈希 + 长度
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : content) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    char buffer[48];
+    std::snprintf(buffer, sizeof(buffer), "\"%016llx-%zx\"",
+                  static_cast<unsigned long long>(hash), content.size());
+    return buffer;
+}
+
+std::string StaticAssetCache::CompressGzip(const std::string& content) {
+#ifdef HAVE_ZLIB
+    z_stream stream{};
+    // windowBits 15 + 16 输出gzip头
+    if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return "";
+    }
+
+    std::string out;
+    out.resize(deflateBound(&stream, static_cast<uLong>(content.size())) + 32);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+    stream.avail_in = static_cast<uInt>(content.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&out[0]);
+    stream.avail_out = static_cast<uInt>(out.size());
+
+    const int result = deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return result == Z_STREAM_END ? out : "";
+#else
+    (void)content;
+    return "";
+#endif
+}
+
+std::string StaticAssetCache::CompressBrotli(const std::string& content) {
+#ifdef HAVE_BROTLI
+    size_t encoded_size = BrotliEncoderMaxCompressedSize(content.size());
+    if (encoded_size == 0) {
+        return "";
+    }
+    std::string out(encoded_size, '\0');
+    if (!BrotliEncoderCompress(BROTLI_MAX_QUALITY, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_TEXT,
+                               content.size(), reinterpret_cast<const uint8_t*>(content.data()),
+                               &encoded_size, reinterpret_cast<uint8_t*>(&out[0]))) {
+        return "";
+    }
+    out.resize(encoded_size);
+    return out;
+#else
+    (void)content;
+    return "";
+#endif
+}
+
+} // namespace web_api
+} // namespace body_controller
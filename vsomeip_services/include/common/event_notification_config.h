@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vsomeip/vsomeip.hpp>
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 单个事件的通知方式
+ */
+struct EventNotificationConfig {
+    bool is_field = false;                              ///< 作为SOME/IP字段提供（新订阅者立即收到当前值）
+    std::chrono::milliseconds update_cycle{0};          ///< 周期性重发当前值的间隔（0表示不重发）
+    bool change_only = false;                           ///< 值未变化时不发送通知
+};
+
+/**
+ * @brief 按（服务ID，事件ID）索引的事件通知配置表
+ *
+ * 从VSOMEIP配置文件services[].events[]条目中读取is_field、update_cycle_ms、change_only，
+ * 与vsomeip自身使用的事件声明放在一起。未配置的事件保持普通事件行为。
+ */
+class EventNotificationTable {
+public:
+    /**
+     * @brief 从VSOMEIP配置文件加载
+     * @param config_file 配置文件路径
+     * @return 成功返回true，失败返回false（表保持为空）
+     */
+    bool LoadFromFile(const std::string& config_file);
+
+    /**
+     * @brief 获取事件的通知配置（未配置时返回默认值）
+     */
+    EventNotificationConfig Get(vsomeip::service_t service_id, vsomeip::event_t event_id) const;
+
+    /**
+     * @brief 已配置的事件数量
+     */
+    size_t Size() const { return entries_.size(); }
+
+private:
+    std::map<std::pair<vsomeip::service_t, vsomeip::event_t>, EventNotificationConfig> entries_;
+};
+
+} // namespace services
+} // namespace body_controller
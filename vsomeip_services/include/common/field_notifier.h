@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <vsomeip/vsomeip.hpp>
+#include "common/event_notification_config.h"
+#include "common/sim_clock.h"
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 单个事件（字段）的通知发布器
+ *
+ * 服务的事件负载都带有车门/车窗/灯光等ID，一个SOME/IP事件承载多个条目，
+ * vsomeip只缓存最后一次负载，无法让新订阅者拿到全部条目。这里按条目键缓存最新负载：
+ * - change_only：条目值未变化时不发送
+ * - update_cycle：按周期重发所有条目，订阅方缓存的陈旧时间有上界
+ * - is_field：以ET_FIELD提供，新订阅者在订阅后立即收到所有条目的当前值
+ */
+class FieldNotifier {
+public:
+    /**
+     * @brief 发布统计
+     */
+    struct Stats {
+        uint64_t published = 0;     ///< 因值变化发送的通知数
+        uint64_t suppressed = 0;    ///< 因值未变化被抑制的通知数
+        uint64_t cyclic = 0;        ///< 周期重发的通知数
+        uint64_t replayed = 0;      ///< 向新订阅者补发的通知数
+    };
+
+    /**
+     * @brief 构造函数
+     * @param app VSOMEIP应用程序实例
+     * @param service_id 服务ID
+     * @param instance_id 实例ID
+     * @param event_id 事件ID
+     * @param config 通知配置
+     * @param clock 周期重发和补发使用的时钟（为空时使用真实时间）
+     */
+    FieldNotifier(std::shared_ptr<vsomeip::application> app,
+                  vsomeip::service_t service_id,
+                  vsomeip::instance_t instance_id,
+                  vsomeip::event_t event_id,
+                  const EventNotificationConfig& config,
+                  std::shared_ptr<SimClock> clock = nullptr);
+
+    ~FieldNotifier();
+
+    FieldNotifier(const FieldNotifier&) = delete;
+    FieldNotifier& operator=(const FieldNotifier&) = delete;
+
+    /**
+     * @brief 向vsomeip提供事件（按配置选择ET_FIELD或ET_EVENT）
+     */
+    void Offer(const std::set<vsomeip::eventgroup_t>& event_groups);
+
+    /**
+     * @brief 启动周期重发/补发线程（普通事件且无周期时不启动）
+     */
+    void Start();
+
+    /**
+     * @brief 停止周期重发/补发线程
+     */
+    void Stop();
+
+    /**
+     * @brief 发布条目的新值
+     * @param key 条目键（车门、车窗、灯光类型等）
+     * @param payload 序列化后的事件负载
+     * @return 已发送返回true，因值未变化被抑制返回false
+     */
+    bool Publish(uint32_t key, const std::vector<uint8_t>& payload);
+
+    /**
+     * @brief 安排向新订阅者补发所有条目的当前值（仅字段有效）
+     */
+    void ScheduleReplay(vsomeip::client_t client);
+
+    bool IsField() const { return config_.is_field; }
+
+    Stats GetStats() const;
+
+private:
+    // vsomeip在订阅处理器返回后才登记订阅者，补发稍作延迟
+    static constexpr std::chrono::milliseconds REPLAY_DELAY{20};
+
+    void TimerLoop();
+
+    void Notify(const std::vector<uint8_t>& payload, bool force) const;
+
+    std::shared_ptr<vsomeip::application> app_;
+    const vsomeip::service_t service_id_;
+    const vsomeip::instance_t instance_id_;
+    const vsomeip::event_t event_id_;
+    const EventNotificationConfig config_;
+    std::shared_ptr<SimClock> clock_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<uint32_t, std::vector<uint8_t>> values_;
+    std::vector<std::pair<vsomeip::client_t, SimClock::TimePoint>> pending_replays_;
+    bool running_ = false;
+    std::thread timer_thread_;
+
+    std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> suppressed_{0};
+    std::atomic<uint64_t> cyclic_{0};
+    std::atomic<uint64_t> replayed_{0};
+};
+
+} // namespace services
+} // namespace body_controller
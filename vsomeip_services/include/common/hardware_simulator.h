@@ -1,19 +1,52 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <thread>
 #include <atomic>
 #include <chrono>
 #include <functional>
 #include <random>
+#include <string>
 #include "application/data_structures.h"
+#include "common/sim_clock.h"
+#include "common/vehicle_state.h"
 
 namespace body_controller {
 namespace services {
 
+/**
+ * @brief 自动生成的事件类型（顺序与SimulationProfile中的数组下标对应）
+ */
+enum class SimulatedEventType : uint8_t {
+    DOOR_LOCK       = 0,
+    DOOR_STATE      = 1,
+    WINDOW_POSITION = 2,
+    LIGHT_STATE     = 3,
+    SEAT_POSITION   = 4
+};
+
+constexpr size_t SIMULATED_EVENT_TYPE_COUNT = 5;
+
+class SimulationScenario;
+
+/**
+ * @brief 自动事件的生成方式
+ *
+ * events_per_second为0时沿用秒级的事件间隔；大于0时进入高频模式：按单调时钟的绝对时间调度，
+ * 每次触发按mix权重选择一种事件类型，再连续生成该类型burst个事件，用于对通知、客户端分发和SSE扇出做压力测试。
+ */
+struct SimulationProfile {
+    uint32_t events_per_second = 0;                                            ///< 每秒触发次数（0表示秒级模式）
+    std::array<uint32_t, SIMULATED_EVENT_TYPE_COUNT> mix{{1, 1, 1, 1, 1}};     ///< 各事件类型的权重
+    std::array<uint32_t, SIMULATED_EVENT_TYPE_COUNT> burst{{1, 1, 1, 1, 1}};   ///< 每次触发连续生成的事件数
+};
+
 /**
  * @brief 硬件事件模拟器
- * 模拟真实硬件的状态变化，定期触发事件
+ * 模拟真实硬件的状态变化，定期触发事件。
+ * 执行器状态写入共享的VehicleState，服务只读取它，不再各自保存副本。
  */
 class HardwareSimulator {
 public:
@@ -26,8 +59,10 @@ public:
 
     /**
      * @brief 构造函数
+     * @param state 整车执行器状态（与服务共享）
+     * @param clock 模拟器时钟（为空时使用真实时间）
      */
-    HardwareSimulator();
+    explicit HardwareSimulator(std::shared_ptr<VehicleState> state, std::shared_ptr<SimClock> clock = nullptr);
     
     /**
      * @brief 析构函数
@@ -49,6 +84,11 @@ public:
      */
     bool IsRunning() const { return running_; }
 
+    /**
+     * @brief 获取整车执行器状态
+     */
+    std::shared_ptr<VehicleState> GetVehicleState() const { return state_; }
+
     // ============================================================================
     // 事件回调设置
     // ============================================================================
@@ -107,6 +147,16 @@ public:
      */
     void TriggerLightStateEvent(application::LightType light_type, uint8_t new_state);
 
+    /**
+     * @brief 手动触发车门开关状态变化事件
+     */
+    void TriggerDoorStateEvent(application::Position door_id, application::DoorState new_state);
+
+    /**
+     * @brief 手动触发座椅位置变化事件
+     */
+    void TriggerSeatPositionEvent(application::Position seat_id, application::SeatAxis axis, int32_t new_position);
+
     // ============================================================================
     // 配置方法
     // ============================================================================
@@ -121,11 +171,58 @@ public:
      */
     void SetAutoEventEnabled(bool enabled) { auto_events_enabled_ = enabled; }
 
+    /**
+     * @brief 设置自动事件的生成方式（需在Start之前调用）
+     */
+    void SetSimulationProfile(const SimulationProfile& profile) { profile_ = profile; }
+
+    /**
+     * @brief 加载场景文件（需在Start之前调用）
+     * 加载成功后自动事件按场景的事件表播放，不再随机生成
+     * @return 加载失败时返回false，保持原有的生成方式
+     */
+    bool LoadScenario(const std::string& path);
+
 private:
     /**
      * @brief 硬件模拟线程主函数
      */
     void SimulationThread();
+
+    /**
+     * @brief 秒级模式：每隔event_interval_seconds_生成一个随机事件
+     */
+    void RunIntervalLoop();
+
+    /**
+     * @brief 高频模式：按profile_的速率、权重和突发数生成事件，每秒输出一次统计
+     */
+    void RunHighRateLoop();
+
+    /**
+     * @brief 场景模式：按场景事件表的时间播放，结束后输出时间偏差统计
+     */
+    void RunScenario();
+
+    /**
+     * @brief 执行场景中的单个事件
+     */
+    void PlayScenarioEvent(const SimulationScenario& scenario, size_t index);
+
+    /**
+     * @brief 生成指定类型的随机事件
+     */
+    void GenerateEvent(SimulatedEventType type);
+
+    /**
+     * @brief 等待到模拟器时钟的绝对时间（纳秒）
+     * 真实时间下先用clock_nanosleep休眠到截止时间前SPIN_WINDOW_NS，剩余部分忙等，抵消内核唤醒延迟；
+     * 长时间等待分段进行，以便及时响应Stop。虚拟时间下交给时钟等待
+     * @return 到达截止时间返回true，期间模拟器被停止返回false
+     */
+    bool WaitUntil(int64_t deadline_ns) const;
+
+    int64_t NowNs() const;
     
     /**
      * @brief 生成随机车门锁定状态变化事件
@@ -157,9 +254,29 @@ private:
     std::atomic<bool> running_;
     std::unique_ptr<std::thread> simulation_thread_;
     
-    // 配置参数
-    int event_interval_seconds_;
-    bool auto_events_enabled_;
+    // 配置参数（模拟线程读取）
+    std::atomic<int> event_interval_seconds_;
+    std::atomic<bool> auto_events_enabled_;
+    SimulationProfile profile_;
+    std::shared_ptr<const SimulationScenario> scenario_;
+
+    // 高频模式下不逐条打印事件日志，避免标准输出成为瓶颈
+    std::atomic<bool> log_events_;
+
+    // 忙等窗口：覆盖clock_nanosleep典型的唤醒延迟
+    static constexpr int64_t SPIN_WINDOW_NS = 50000;
+
+    // 落后超过该时长时放弃补发积压的触发，重新对齐节拍
+    static constexpr int64_t MAX_BACKLOG_NS = 100000000;
+
+    // 单次休眠的上限，保证Stop的响应时间
+    static constexpr int64_t MAX_SLEEP_NS = 100000000;
+
+    // 整车执行器状态
+    std::shared_ptr<VehicleState> state_;
+
+    // 模拟器时钟
+    std::shared_ptr<SimClock> clock_;
     
     // 随机数生成器
     std::mt19937 random_generator_;
@@ -176,14 +293,6 @@ private:
     WindowPositionEventCallback window_position_callback_;
     LightStateEventCallback light_state_callback_;
     SeatPositionEventCallback seat_position_callback_;
-    
-    // 当前状态（用于生成合理的状态变化）
-    std::array<application::LockState, 4> current_door_lock_states_;
-    std::array<application::DoorState, 4> current_door_states_;
-    std::array<uint8_t, 4> current_window_positions_;
-    application::HeadlightState current_headlight_state_;
-    application::IndicatorState current_indicator_state_;
-    application::PositionLightState current_position_light_state_;
 };
 
 } // namespace services
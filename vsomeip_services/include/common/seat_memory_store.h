@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "application/data_structures.h"
+#include "common/vehicle_state.h"
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 座椅记忆位置存储（按座椅、用户、记忆位置编号索引）
+ *
+ * 数据保存在一个固定布局的小文件中并以MAP_SHARED映射：启动时只校验文件头，
+ * 无需解析，查找是一次数组下标计算。每个记忆位置有两份记录，写入总是覆盖
+ * 序号较旧的一份，记录带序号和校验和，读取时取校验通过且序号最新的一份。
+ * 因此写入中途进程崩溃或掉电只会损坏正在写的那份，上一次保存的值仍然有效。
+ * 未能打开文件时退化为匿名映射（进程内有效，不持久化）。
+ */
+class SeatMemoryStore {
+public:
+    static constexpr size_t SEAT_COUNT = VehicleState::SEAT_COUNT;
+    static constexpr size_t USER_COUNT = 4;
+    static constexpr size_t PRESET_COUNT = 3;   ///< 记忆位置编号1-3
+
+    SeatMemoryStore() = default;
+    ~SeatMemoryStore();
+
+    SeatMemoryStore(const SeatMemoryStore&) = delete;
+    SeatMemoryStore& operator=(const SeatMemoryStore&) = delete;
+
+    /**
+     * @brief 打开（必要时创建）存储文件
+     * @param path 文件路径；为空时使用匿名映射
+     * @return 文件映射成功返回true；失败时退化为匿名映射并返回false
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief 解除映射并关闭文件
+     */
+    void Close();
+
+    /**
+     * @brief 是否映射到持久化文件
+     */
+    bool IsPersistent() const { return fd_ >= 0; }
+
+    /**
+     * @brief 保存记忆位置（写入后同步到磁盘）
+     * @return 参数越界或存储不可用时返回false
+     */
+    bool Save(application::Position seat_id, uint8_t user_id, uint8_t preset_id, const SeatPosition& position);
+
+    /**
+     * @brief 读取记忆位置
+     * @return 该记忆位置从未保存过或参数越界时返回false
+     */
+    bool Load(application::Position seat_id, uint8_t user_id, uint8_t preset_id, SeatPosition& position) const;
+
+private:
+    struct FileHeader;
+    struct PresetRecord;
+    struct PresetSlot;
+
+    static size_t MappingSize();
+    static uint32_t Checksum(const PresetRecord& record);
+    static bool IsValid(const PresetRecord& record);
+
+    bool MapFile(const std::string& path);
+    bool MapAnonymous();
+    PresetSlot* FindSlot(application::Position seat_id, uint8_t user_id, uint8_t preset_id) const;
+
+    mutable std::mutex mutex_;
+    int fd_ = -1;
+    void* mapping_ = nullptr;
+    PresetSlot* slots_ = nullptr;
+};
+
+} // namespace services
+} // namespace body_controller
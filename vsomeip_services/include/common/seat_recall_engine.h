@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "application/data_structures.h"
+#include "common/sim_clock.h"
+#include "common/vehicle_state.h"
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 座椅记忆位置恢复引擎
+ *
+ * 每个座椅一条运动计划，前后和靠背两个轴同时运动：按各轴步进量求出最慢轴所需的步数，
+ * 各轴在该步数内线性插值、同时到达目标，总时长等于最慢轴单独运动的时长。
+ * 一个线程按固定节拍推进所有座椅的计划，多个座椅的恢复并行进行；
+ * 每一步通过进度回调输出位置变化，计划结束（到达或被打断）时通过完成回调输出一次结果。
+ */
+class SeatRecallEngine {
+public:
+    using ProgressCallback = std::function<void(const application::OnSeatPositionChangedData&)>;
+    using CompleteCallback = std::function<void(const application::OnSeatRecallCompleteData&)>;
+
+    /**
+     * @brief 构造函数
+     * @param state 整车执行器状态
+     * @param step_interval 运动节拍（每个节拍各轴最多移动一个步进量）
+     * @param clock 节拍使用的时钟（为空时使用真实时间）
+     */
+    SeatRecallEngine(std::shared_ptr<VehicleState> state, std::chrono::milliseconds step_interval,
+                     std::shared_ptr<SimClock> clock = nullptr);
+
+    ~SeatRecallEngine();
+
+    SeatRecallEngine(const SeatRecallEngine&) = delete;
+    SeatRecallEngine& operator=(const SeatRecallEngine&) = delete;
+
+    void SetProgressCallback(const ProgressCallback& callback) { progress_callback_ = callback; }
+    void SetCompleteCallback(const CompleteCallback& callback) { complete_callback_ = callback; }
+
+    /**
+     * @brief 启动运动线程
+     */
+    void Start();
+
+    /**
+     * @brief 停止运动线程，丢弃未完成的计划
+     */
+    void Stop();
+
+    /**
+     * @brief 开始向目标位置恢复
+     *
+     * 替换该座椅正在进行的恢复（被替换的计划以失败结束）；已在目标位置时立即完成。
+     * @return 座椅ID越界或引擎未启动时返回false
+     */
+    bool Recall(application::Position seat_id, uint8_t preset_id, const SeatPosition& target);
+
+    /**
+     * @brief 取消该座椅正在进行的恢复（手动调节时调用），计划以失败结束
+     */
+    void Cancel(application::Position seat_id);
+
+    /**
+     * @brief 该座椅是否有正在进行的恢复
+     */
+    bool IsActive(application::Position seat_id) const;
+
+private:
+    struct AxisTrajectory {
+        application::SeatAxis axis = application::SeatAxis::FORWARD_BACKWARD;
+        int32_t start = 0;
+        int32_t target = 0;
+        int32_t current = 0;
+    };
+
+    struct SeatPlan {
+        bool active = false;
+        uint8_t preset_id = 0;
+        uint32_t total_steps = 0;
+        uint32_t step = 0;
+        std::array<AxisTrajectory, 2> axes;
+    };
+
+    void Run();
+
+    /**
+     * @brief 推进所有计划一步，收集需要输出的进度和完成事件（持锁调用）
+     */
+    void AdvanceLocked(std::vector<application::OnSeatPositionChangedData>& progress,
+                       std::vector<application::OnSeatRecallCompleteData>& completed);
+
+    /**
+     * @brief 结束计划并生成完成事件（持锁调用）
+     */
+    static application::OnSeatRecallCompleteData FinishLocked(SeatPlan& plan, application::Position seat_id,
+                                                              application::Result result);
+
+    void Emit(const std::vector<application::OnSeatPositionChangedData>& progress,
+              const std::vector<application::OnSeatRecallCompleteData>& completed) const;
+
+    std::shared_ptr<VehicleState> state_;
+    const std::chrono::milliseconds step_interval_;
+    std::shared_ptr<SimClock> clock_;
+
+    ProgressCallback progress_callback_;
+    CompleteCallback complete_callback_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::array<SeatPlan, VehicleState::SEAT_COUNT> plans_;
+    size_t active_count_ = 0;
+    bool running_ = false;
+    bool idle_ = false;                 ///< 工作线程在无计划时的等待中
+    bool handoff_pending_ = false;      ///< 已替工作线程占住时钟的运行中计数，等它醒来接手
+    std::thread thread_;
+};
+
+} // namespace services
+} // namespace body_controller
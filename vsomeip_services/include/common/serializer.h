@@ -147,6 +147,26 @@ public:
      */
     static bool Deserialize(const std::vector<uint8_t>& data, application::SetHeadlightStateReq& request);
     
+    /**
+     * @brief 序列化灯光状态查询请求
+     */
+    static std::vector<uint8_t> Serialize(const application::GetLightStateReq& request);
+    
+    /**
+     * @brief 反序列化灯光状态查询请求
+     */
+    static bool Deserialize(const std::vector<uint8_t>& data, application::GetLightStateReq& request);
+    
+    /**
+     * @brief 序列化灯光状态查询响应
+     */
+    static std::vector<uint8_t> Serialize(const application::GetLightStateResp& response);
+    
+    /**
+     * @brief 反序列化灯光状态查询响应
+     */
+    static bool Deserialize(const std::vector<uint8_t>& data, application::GetLightStateResp& response);
+    
     /**
      * @brief 序列化灯光状态变化事件
      */
@@ -180,6 +200,46 @@ public:
      * @brief 反序列化座椅位置变化事件
      */
     static bool Deserialize(const std::vector<uint8_t>& data, application::OnSeatPositionChangedData& event);
+    
+    /**
+     * @brief 序列化记忆位置恢复请求
+     */
+    static std::vector<uint8_t> Serialize(const application::RecallMemoryPositionReq& request);
+    
+    /**
+     * @brief 反序列化记忆位置恢复请求（缺少userID时按用户0处理）
+     */
+    static bool Deserialize(const std::vector<uint8_t>& data, application::RecallMemoryPositionReq& request);
+    
+    /**
+     * @brief 序列化记忆位置恢复响应
+     */
+    static std::vector<uint8_t> Serialize(const application::RecallMemoryPositionResp& response);
+    
+    /**
+     * @brief 序列化记忆位置保存请求
+     */
+    static std::vector<uint8_t> Serialize(const application::SaveMemoryPositionReq& request);
+    
+    /**
+     * @brief 反序列化记忆位置保存请求（缺少userID时按用户0处理）
+     */
+    static bool Deserialize(const std::vector<uint8_t>& data, application::SaveMemoryPositionReq& request);
+    
+    /**
+     * @brief 序列化记忆位置保存响应
+     */
+    static std::vector<uint8_t> Serialize(const application::SaveMemoryPositionResp& response);
+    
+    /**
+     * @brief 序列化记忆保存确认事件
+     */
+    static std::vector<uint8_t> Serialize(const application::OnMemorySaveConfirmData& event);
+    
+    /**
+     * @brief 序列化记忆位置恢复完成事件
+     */
+    static std::vector<uint8_t> Serialize(const application::OnSeatRecallCompleteData& event);
 
     // ============================================================================
     // 通用响应序列化
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <vsomeip/vsomeip.hpp>
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 单个服务的请求执行器
+ *
+ * 所有服务共用一个vsomeip应用程序，默认情况下请求在vsomeip的分发线程上串行处理，
+ * 一个慢的座椅请求会拖住车门、灯光请求。每个服务持有自己的执行器后，
+ * 分发线程只负责把请求投递到对应服务的有界队列，各服务的请求并行处理。
+ * 单线程执行器保持该服务内的请求顺序。
+ */
+class ServiceExecutor {
+public:
+    /**
+     * @brief 执行器统计
+     */
+    struct Stats {
+        size_t threads = 0;         ///< 工作线程数
+        size_t queued = 0;          ///< 排队的请求数
+        uint64_t executed = 0;      ///< 已执行的请求数
+        uint64_t rejected = 0;      ///< 队列已满被拒绝的请求数
+    };
+
+    /**
+     * @brief 构造函数
+     * @param name 执行器名称（用于日志）
+     * @param thread_count 工作线程数（至少为1）
+     * @param queue_capacity 队列容量（0表示不限）
+     */
+    ServiceExecutor(std::string name, size_t thread_count, size_t queue_capacity);
+
+    /**
+     * @brief 析构函数，停止并等待工作线程结束
+     */
+    ~ServiceExecutor();
+
+    ServiceExecutor(const ServiceExecutor&) = delete;
+    ServiceExecutor& operator=(const ServiceExecutor&) = delete;
+
+    /**
+     * @brief 启动工作线程
+     */
+    void Start();
+
+    /**
+     * @brief 停止接收任务，执行完已排队的任务后结束工作线程
+     */
+    void Stop();
+
+    /**
+     * @brief 投递任务
+     * @return 队列已满或已停止时返回false
+     */
+    bool Post(std::function<void()> task);
+
+    /**
+     * @brief 获取执行器名称
+     */
+    const std::string& GetName() const { return name_; }
+
+    /**
+     * @brief 获取统计信息
+     */
+    Stats GetStats() const;
+
+private:
+    void WorkerLoop();
+
+    const std::string name_;
+    const size_t thread_count_;
+    const size_t queue_capacity_;
+
+    std::deque<std::function<void()>> tasks_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    bool running_ = false;
+    std::vector<std::thread> workers_;
+
+    std::atomic<uint64_t> executed_{0};
+    std::atomic<uint64_t> rejected_{0};
+};
+
+/**
+ * @brief 执行器队列已满时回复MT_ERROR/E_NOT_READY（与正常响应负载不会混淆）
+ *
+ * 请求没有被执行，客户端可以把它当作可重试的拒绝，而不是服务故障。
+ */
+void SendBusyResponse(const std::shared_ptr<vsomeip::application>& app,
+                      const std::shared_ptr<vsomeip::message>& request);
+
+} // namespace services
+} // namespace body_controller
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 模拟器时钟
+ *
+ * 硬件模拟器、服务中的执行延迟、字段周期重发和座椅运动节拍都通过它取时间和等待：
+ * - REAL_TIME：直接使用std::chrono::steady_clock（即CLOCK_MONOTONIC）
+ * - VIRTUAL：时间只在所有等待者都未到期、且各线程静默QUIESCENCE_WINDOW之后前进，
+ *   一次跳到最早的截止时间。等待本身几乎不耗真实时间，长时间的场景和超时逻辑可以在几秒内跑完
+ *
+ * 虚拟时间下离开等待的线程（到期或被条件唤醒）计入运行中，直到它重新进入本时钟的等待，
+ * 或调用Done()声明本轮处理结束；运行中计数不为0时时间不前进，因此依赖先后次序的定时逻辑
+ * 与真实时间下一致。等待之后不会再回到本时钟等待的线程（请求处理、一次性延迟线程、
+ * 退出前的循环线程、转入无限期等待的线程）必须调用Done()，否则虚拟时间停住。
+ * 线程之间经由其它条件变量的唤醒用Handoff()/Adopt()交接计数，外部请求触发的唤醒只靠静默窗口。
+ * 等待之外的计算不计入虚拟时间。
+ */
+class SimClock {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+    using Duration = std::chrono::steady_clock::duration;
+
+    enum class Mode {
+        REAL_TIME,
+        VIRTUAL
+    };
+
+    /**
+     * @brief 构造函数
+     * @param mode 时钟模式（虚拟时间从构造时的真实时间开始）
+     */
+    explicit SimClock(Mode mode = Mode::REAL_TIME);
+
+    ~SimClock();
+
+    SimClock(const SimClock&) = delete;
+    SimClock& operator=(const SimClock&) = delete;
+
+    bool IsVirtual() const { return mode_ == Mode::VIRTUAL; }
+
+    TimePoint Now() const;
+
+    /**
+     * @brief 睡眠到指定时间
+     * @param cancelled 可选的取消条件，真实时间下每REAL_SLEEP_SLICE、虚拟时间下每POLL_INTERVAL检查一次
+     * @return 到达截止时间返回true，被取消返回false
+     */
+    bool SleepUntil(TimePoint deadline, const std::function<bool()>& cancelled = nullptr);
+
+    bool SleepFor(Duration duration, const std::function<bool()>& cancelled = nullptr) {
+        return SleepUntil(Now() + duration, cancelled);
+    }
+
+    /**
+     * @brief 当前线程本轮处理结束，不再阻止虚拟时间前进
+     *
+     * 当前线程未持有运行中计数（或为真实时间模式）时什么也不做，可以无条件调用。
+     */
+    void Done();
+
+    /**
+     * @brief 通过其它条件变量唤醒一个线程之前调用，替被唤醒的线程占住运行中计数
+     *
+     * 被唤醒的线程醒来后调用Adopt()接手，否则唤醒方一重新等待，时间就可能越过被唤醒方的处理。
+     */
+    void Handoff();
+
+    /**
+     * @brief 接手Handoff()占住的运行中计数，之后按本线程的计数释放
+     */
+    void Adopt();
+
+    /**
+     * @brief 按本时钟的时间执行condition_variable::wait_until
+     * @return 返回时pred()的值
+     */
+    template <typename Predicate>
+    bool WaitUntil(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+                   TimePoint deadline, Predicate pred) {
+        if (mode_ == Mode::REAL_TIME) {
+            return cv.wait_until(lock, deadline, pred);
+        }
+        // 时间前进时会notify该条件变量；通知恰好落在检查与等待之间时靠轮询兜底
+        PendingDeadline pending(*this, deadline, &cv);
+        while (!pred()) {
+            if (Now() >= deadline) {
+                return pred();
+            }
+            cv.wait_for(lock, POLL_INTERVAL);
+        }
+        return true;
+    }
+
+private:
+    using DeadlineMap = std::multimap<TimePoint, std::condition_variable*>;
+
+    /**
+     * @brief 等待期间登记截止时间，虚拟时间据此前进
+     */
+    class PendingDeadline {
+    public:
+        PendingDeadline(SimClock& clock, TimePoint deadline, std::condition_variable* cv)
+            : clock_(clock), entry_(clock.AddDeadline(deadline, cv)) {}
+        ~PendingDeadline() { clock_.RemoveDeadline(entry_); }
+
+        PendingDeadline(const PendingDeadline&) = delete;
+        PendingDeadline& operator=(const PendingDeadline&) = delete;
+
+    private:
+        SimClock& clock_;
+        DeadlineMap::iterator entry_;
+    };
+
+    // 运行中计数归零后再静默这么久（真实时间）才前进，留给刚收到请求、尚未登记等待的线程
+    static constexpr std::chrono::microseconds QUIESCENCE_WINDOW{200};
+    // 虚拟时间下等待者检查取消条件和漏掉的通知的间隔（真实时间）
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{1};
+    // 真实时间下可取消的睡眠分段长度
+    static constexpr std::chrono::milliseconds REAL_SLEEP_SLICE{100};
+
+    DeadlineMap::iterator AddDeadline(TimePoint deadline, std::condition_variable* cv);
+    void RemoveDeadline(DeadlineMap::iterator entry);
+
+    void AdvanceLoop();
+
+    const Mode mode_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable sleepers_cv_;
+    std::condition_variable advance_cv_;
+    DeadlineMap deadlines_;
+    uint64_t generation_ = 0;           ///< 每次登记/注销/Done递增，用于判断静默
+    size_t running_ = 0;                ///< 离开等待、尚未重新等待或Done的线程数
+    bool stopping_ = false;
+    std::atomic<int64_t> virtual_now_ns_{0};
+    std::thread advance_thread_;
+
+    uint64_t advances_ = 0;
+    std::chrono::steady_clock::time_point real_start_;
+    int64_t virtual_start_ns_ = 0;
+};
+
+} // namespace services
+} // namespace body_controller
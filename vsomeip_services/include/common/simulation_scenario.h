@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "common/hardware_simulator.h"
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 硬件模拟场景
+ *
+ * 从JSON文件加载定时事件序列，加载时按固定种子展开为按时间排序的事件表：
+ * - 单个事件：{"at_ms": 0, "event": "window", "id": 0, "value": 50}
+ * - 渐变：{"at_ms": 0, "event": "window", "id": "all", "ramp": {"from": 100, "to": 0, "duration_ms": 3000, "steps": 30}}
+ * - 循环：{"at_ms": 0, "loop": {"count": 6, "period_ms": 500, "events": [...]}}，内层时间相对每次迭代的起点
+ *
+ * "id"可以是"all"（展开为该类型的所有条目）；"at_ms"和"value"可以写成[min, max]，由种子决定取值。
+ * 随机数只使用std::mt19937的原始输出（标准规定了其序列），不依赖标准库实现相关的分布算法，
+ * 因此同一场景文件在不同机器、不同编译器上展开出完全相同的事件表。
+ */
+class SimulationScenario {
+public:
+    /**
+     * @brief 展开后的单个事件
+     */
+    struct Event {
+        int64_t offset_ns = 0;                                  ///< 相对场景起点的时间
+        SimulatedEventType type = SimulatedEventType::DOOR_LOCK;
+        uint8_t id = 0;                                         ///< 车门/车窗/座椅位置或灯光类型
+        uint8_t axis = 0;                                       ///< 座椅调节轴（仅座椅事件）
+        int32_t value = 0;                                      ///< 新状态或新位置
+    };
+
+    /**
+     * @brief 从文件加载并展开场景
+     * @return 文件无法打开或格式错误时返回false（原有内容被清空）
+     */
+    bool LoadFromFile(const std::string& path);
+
+    const std::string& GetName() const { return name_; }
+    const std::vector<Event>& GetEvents() const { return events_; }
+
+    /**
+     * @brief 一次播放的时长（未指定duration_ms时为最后一个事件的时间）
+     */
+    int64_t GetDurationNs() const { return duration_ns_; }
+
+    /**
+     * @brief 播放次数（0表示循环播放直到模拟器停止）
+     */
+    uint32_t GetRepeat() const { return repeat_; }
+
+private:
+    std::string name_;
+    std::vector<Event> events_;
+    int64_t duration_ns_ = 0;
+    uint32_t repeat_ = 1;
+};
+
+} // namespace services
+} // namespace body_controller
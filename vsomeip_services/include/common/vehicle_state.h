@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "application/data_structures.h"
+
+namespace body_controller {
+namespace services {
+
+/**
+ * @brief 座椅位置（两个调节轴）
+ */
+struct SeatPosition {
+    int32_t forward_backward_position = 0;  ///< 前后位置 (-100 到 100)
+    int32_t recline_position = 45;          ///< 靠背角度 (0 到 90)
+};
+
+/**
+ * @brief 整车执行器状态（服务与硬件模拟器共享的唯一一份）
+ *
+ * vsomeip分发线程、模拟线程和服务的延迟线程会并发读写执行器状态，
+ * 这里每个执行器占一个独立缓存行的原子量：读取是单次原子load（无等待），
+ * 不同车门/车窗/座椅的写入互不产生伪共享。座椅的两个轴打包在一个64位原子量中，
+ * 读取总是得到一致的两轴快照，步进调节以CAS完成。
+ * 越界的位置ID读取返回默认值，写入被忽略。
+ */
+class VehicleState {
+public:
+    static constexpr size_t DOOR_COUNT = 4;
+    static constexpr size_t WINDOW_COUNT = 4;
+    static constexpr size_t SEAT_COUNT = 4;
+    static constexpr size_t LIGHT_TYPE_COUNT = application::LIGHT_TYPE_COUNT;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    static constexpr uint8_t DEFAULT_WINDOW_POSITION = 50;
+
+    // 座椅调节范围与单次步进量
+    static constexpr int32_t FORWARD_BACKWARD_MIN = -100;
+    static constexpr int32_t FORWARD_BACKWARD_MAX = 100;
+    static constexpr int32_t FORWARD_BACKWARD_STEP = 10;
+    static constexpr int32_t RECLINE_MIN = 0;
+    static constexpr int32_t RECLINE_MAX = 90;
+    static constexpr int32_t RECLINE_STEP = 5;
+
+    /**
+     * @brief 构造函数，所有执行器处于默认状态
+     */
+    VehicleState();
+
+    VehicleState(const VehicleState&) = delete;
+    VehicleState& operator=(const VehicleState&) = delete;
+
+    // ============================================================================
+    // 车门
+    // ============================================================================
+
+    application::LockState GetLockState(application::Position door_id) const;
+    void SetLockState(application::Position door_id, application::LockState state);
+
+    /**
+     * @brief 原子地切换车门锁定状态
+     * @return 切换后的状态
+     */
+    application::LockState ToggleLockState(application::Position door_id);
+
+    application::DoorState GetDoorState(application::Position door_id) const;
+    void SetDoorState(application::Position door_id, application::DoorState state);
+
+    /**
+     * @brief 原子地切换车门开关状态
+     * @return 切换后的状态
+     */
+    application::DoorState ToggleDoorState(application::Position door_id);
+
+    // ============================================================================
+    // 车窗
+    // ============================================================================
+
+    uint8_t GetWindowPosition(application::Position window_id) const;
+    void SetWindowPosition(application::Position window_id, uint8_t position);
+
+    // ============================================================================
+    // 灯光
+    // ============================================================================
+
+    /**
+     * @brief 获取灯光状态（按类型对应HeadlightState/IndicatorState/PositionLightState的值）
+     */
+    uint8_t GetLightState(application::LightType light_type) const;
+    void SetLightState(application::LightType light_type, uint8_t state);
+
+    // ============================================================================
+    // 座椅
+    // ============================================================================
+
+    SeatPosition GetSeatPosition(application::Position seat_id) const;
+    void SetSeatPosition(application::Position seat_id, const SeatPosition& position);
+
+    /**
+     * @brief 设置座椅单个轴的位置（值被限制在轴的范围内）
+     */
+    void SetSeatAxis(application::Position seat_id, application::SeatAxis axis, int32_t value);
+
+    /**
+     * @brief 按方向将座椅单个轴移动一个步进量
+     * @return 移动后该轴的位置
+     */
+    int32_t StepSeatAxis(application::Position seat_id, application::SeatAxis axis,
+                         application::SeatDirection direction);
+
+private:
+    template <typename T>
+    struct alignas(CACHE_LINE_SIZE) PaddedAtomic {
+        std::atomic<T> value;
+    };
+
+    static uint64_t PackSeat(const SeatPosition& position);
+    static SeatPosition UnpackSeat(uint64_t packed);
+    static int32_t ClampAxis(application::SeatAxis axis, int32_t value);
+
+    std::array<PaddedAtomic<uint8_t>, DOOR_COUNT> lock_states_;
+    std::array<PaddedAtomic<uint8_t>, DOOR_COUNT> door_states_;
+    std::array<PaddedAtomic<uint8_t>, WINDOW_COUNT> window_positions_;
+    std::array<PaddedAtomic<uint8_t>, LIGHT_TYPE_COUNT> light_states_;
+    std::array<PaddedAtomic<uint64_t>, SEAT_COUNT> seat_positions_;
+};
+
+} // namespace services
+} // namespace body_controller
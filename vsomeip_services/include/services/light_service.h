@@ -1,17 +1,22 @@
 #pragma once
 
 #include <memory>
+#include <set>
 #include <vsomeip/vsomeip.hpp>
 #include "application/data_structures.h"
 #include "communication/someip_service_definitions.h"
 #include "common/hardware_simulator.h"
+#include "common/field_notifier.h"
+#include "common/service_executor.h"
+#include "common/sim_clock.h"
+#include "common/vehicle_state.h"
 
 namespace body_controller {
 namespace services {
 
 /**
  * @brief 灯光服务实现
- * 提供前大灯、转向灯、位置灯控制功能
+ * 提供前大灯、转向灯、位置灯控制功能；灯光状态以字段形式提供（getter、setter、notifier）
  */
 class LightService {
 public:
@@ -19,9 +24,13 @@ public:
      * @brief 构造函数
      * @param app VSOMEIP应用程序实例
      * @param simulator 硬件模拟器实例
+     * @param state 整车执行器状态（与硬件模拟器共享）
+     * @param clock 模拟器时钟（为空时使用真实时间）
      */
     explicit LightService(std::shared_ptr<vsomeip::application> app, 
-                         std::shared_ptr<HardwareSimulator> simulator);
+                         std::shared_ptr<HardwareSimulator> simulator,
+                          std::shared_ptr<VehicleState> state,
+                          std::shared_ptr<SimClock> clock = nullptr);
     
     /**
      * @brief 析构函数
@@ -50,6 +59,19 @@ public:
      */
     bool IsRunning() const { return running_; }
 
+    /**
+     * @brief 设置请求执行器
+     * 需在Initialize之前调用；未设置时请求在vsomeip分发线程上直接处理
+     */
+    void SetExecutor(std::shared_ptr<ServiceExecutor> executor) { executor_ = std::move(executor); }
+    
+    /**
+     * @brief 设置事件通知配置（需在Initialize之前调用，未设置时全部为普通事件）
+     */
+    void SetEventConfig(std::shared_ptr<const EventNotificationTable> event_config) {
+        event_config_ = std::move(event_config);
+    }
+
 private:
     /**
      * @brief 处理前大灯状态设置请求
@@ -66,6 +88,28 @@ private:
      */
     void HandleSetPositionLightStateRequest(const std::shared_ptr<vsomeip::message>& request);
     
+    /**
+     * @brief 处理灯光状态查询请求（字段getter）
+     */
+    void HandleGetLightStateRequest(const std::shared_ptr<vsomeip::message>& request);
+    
+    /**
+     * @brief 按配置创建事件发布器并向vsomeip提供事件
+     */
+    std::unique_ptr<FieldNotifier> OfferEvent(vsomeip::event_t event_id,
+                                              const std::set<vsomeip::eventgroup_t>& event_groups);
+    
+    /**
+     * @brief 发布所有条目的当前状态作为字段初始值
+     */
+    void PublishInitialValues();
+    
+    /**
+     * @brief 将请求交给执行器处理（队列已满时回复MT_ERROR/E_NOT_READY）
+     */
+    void DispatchRequest(const std::shared_ptr<vsomeip::message>& request,
+                         void (LightService::*handler)(const std::shared_ptr<vsomeip::message>&));
+    
     /**
      * @brief 发送响应消息
      */
@@ -117,10 +161,18 @@ private:
     // 硬件模拟器
     std::shared_ptr<HardwareSimulator> hardware_simulator_;
     
-    // 当前状态存储
-    application::HeadlightState current_headlight_state_;
-    application::IndicatorState current_indicator_state_;
-    application::PositionLightState current_position_light_state_;
+    // 整车执行器状态
+    std::shared_ptr<VehicleState> state_;
+    
+    // 模拟器时钟（硬件动作延迟）
+    std::shared_ptr<SimClock> clock_;
+    
+    // 请求执行器
+    std::shared_ptr<ServiceExecutor> executor_;
+    
+    // 事件通知配置与发布器
+    std::shared_ptr<const EventNotificationTable> event_config_;
+    std::unique_ptr<FieldNotifier> light_state_notifier_;
     
     // 服务配置
     static constexpr vsomeip::service_t SERVICE_ID = communication::LIGHT_SERVICE_ID;
@@ -132,6 +184,7 @@ private:
     static constexpr vsomeip::method_t SET_HEADLIGHT_STATE_METHOD = communication::light_service::SET_HEADLIGHT_STATE;
     static constexpr vsomeip::method_t SET_INDICATOR_STATE_METHOD = communication::light_service::SET_INDICATOR_STATE;
     static constexpr vsomeip::method_t SET_POSITION_LIGHT_STATE_METHOD = communication::light_service::SET_POSITION_LIGHT_STATE;
+    static constexpr vsomeip::method_t GET_LIGHT_STATE_METHOD = communication::light_service::GET_LIGHT_STATE;
     
     // 事件ID
     static constexpr vsomeip::event_t LIGHT_STATE_CHANGED_EVENT = communication::light_events::ON_LIGHT_STATE_CHANGED;
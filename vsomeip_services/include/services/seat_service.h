@@ -1,17 +1,27 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <set>
 #include <vsomeip/vsomeip.hpp>
 #include "application/data_structures.h"
 #include "communication/someip_service_definitions.h"
 #include "common/hardware_simulator.h"
+#include "common/field_notifier.h"
+#include "common/seat_memory_store.h"
+#include "common/seat_recall_engine.h"
+#include "common/service_executor.h"
+#include "common/sim_clock.h"
+#include "common/vehicle_state.h"
 
 namespace body_controller {
 namespace services {
 
 /**
  * @brief 座椅服务实现
- * 提供座椅调节和记忆位置功能
+ * 提供四个座椅的调节和记忆位置功能，请求和事件都携带座椅ID，各座椅的调节与恢复互相独立；
+ * 记忆位置按（座椅，用户，编号）持久化在SeatMemoryStore中，恢复由SeatRecallEngine驱动各轴同时运动，
+ * 运动过程以OnSeatPositionChanged输出，结束时发送一次OnSeatRecallComplete
  */
 class SeatService {
 public:
@@ -19,9 +29,13 @@ public:
      * @brief 构造函数
      * @param app VSOMEIP应用程序实例
      * @param simulator 硬件模拟器实例
+     * @param state 整车执行器状态（与硬件模拟器共享）
+     * @param clock 模拟器时钟（为空时使用真实时间）
      */
     explicit SeatService(std::shared_ptr<vsomeip::application> app, 
-                        std::shared_ptr<HardwareSimulator> simulator);
+                        std::shared_ptr<HardwareSimulator> simulator,
+                         std::shared_ptr<VehicleState> state,
+                         std::shared_ptr<SimClock> clock = nullptr);
     
     /**
      * @brief 析构函数
@@ -50,6 +64,26 @@ public:
      */
     bool IsRunning() const { return running_; }
 
+    /**
+     * @brief 设置请求执行器
+     * 需在Initialize之前调用；未设置时请求在vsomeip分发线程上直接处理
+     */
+    void SetExecutor(std::shared_ptr<ServiceExecutor> executor) { executor_ = std::move(executor); }
+    
+    /**
+     * @brief 设置事件通知配置（需在Initialize之前调用，未设置时全部为普通事件）
+     */
+    void SetEventConfig(std::shared_ptr<const EventNotificationTable> event_config) {
+        event_config_ = std::move(event_config);
+    }
+    
+    /**
+     * @brief 设置记忆位置存储（需在Initialize之前调用，未设置时使用不持久化的内存存储）
+     */
+    void SetMemoryStore(std::shared_ptr<SeatMemoryStore> memory_store) {
+        memory_store_ = std::move(memory_store);
+    }
+
 private:
     /**
      * @brief 处理座椅调节请求
@@ -66,6 +100,23 @@ private:
      */
     void HandleSaveMemoryPositionRequest(const std::shared_ptr<vsomeip::message>& request);
     
+    /**
+     * @brief 按配置创建事件发布器并向vsomeip提供事件
+     */
+    std::unique_ptr<FieldNotifier> OfferEvent(vsomeip::event_t event_id,
+                                              const std::set<vsomeip::eventgroup_t>& event_groups);
+    
+    /**
+     * @brief 发布所有条目的当前状态作为字段初始值
+     */
+    void PublishInitialValues();
+    
+    /**
+     * @brief 将请求交给执行器处理（队列已满时回复MT_ERROR/E_NOT_READY）
+     */
+    void DispatchRequest(const std::shared_ptr<vsomeip::message>& request,
+                         void (SeatService::*handler)(const std::shared_ptr<vsomeip::message>&));
+    
     /**
      * @brief 发送响应消息
      */
@@ -92,6 +143,11 @@ private:
      * @brief 发送记忆保存确认事件
      */
     void SendMemorySaveConfirmEvent(const application::OnMemorySaveConfirmData& event_data);
+    
+    /**
+     * @brief 发送记忆位置恢复完成事件
+     */
+    void SendRecallCompleteEvent(const application::OnSeatRecallCompleteData& event_data);
 
     /**
      * @brief 模拟座椅调节操作
@@ -104,24 +160,6 @@ private:
                                               application::SeatAxis axis,
                                               application::SeatDirection direction);
     
-    /**
-     * @brief 模拟记忆位置恢复操作
-     * @param seat_id 座椅ID
-     * @param memory_id 记忆位置ID
-     * @return 操作结果
-     */
-    application::Result SimulateRecallMemoryOperation(application::Position seat_id,
-                                                    uint8_t memory_id);
-    
-    /**
-     * @brief 模拟记忆位置保存操作
-     * @param seat_id 座椅ID
-     * @param memory_id 记忆位置ID
-     * @return 操作结果
-     */
-    application::Result SimulateSaveMemoryOperation(application::Position seat_id,
-                                                  uint8_t memory_id);
-
 private:
     // VSOMEIP相关
     std::shared_ptr<vsomeip::application> app_;
@@ -130,15 +168,29 @@ private:
     // 硬件模拟器
     std::shared_ptr<HardwareSimulator> hardware_simulator_;
     
-    // 当前状态存储（简化的座椅位置表示）
-    struct SeatPosition {
-        int forward_backward_position;  // 前后位置 (-100 到 100)
-        int recline_position;          // 靠背角度 (0 到 90)
-    };
-    std::array<SeatPosition, 4> current_positions_;
+    // 整车执行器状态
+    std::shared_ptr<VehicleState> state_;
+    
+    // 模拟器时钟（硬件动作延迟）
+    std::shared_ptr<SimClock> clock_;
+    
+    // 请求执行器
+    std::shared_ptr<ServiceExecutor> executor_;
+    
+    // 事件通知配置与发布器
+    std::shared_ptr<const EventNotificationTable> event_config_;
+    std::unique_ptr<FieldNotifier> position_notifier_;
+    std::unique_ptr<FieldNotifier> memory_save_notifier_;
+    std::unique_ptr<FieldNotifier> recall_complete_notifier_;
     
     // 记忆位置存储
-    std::array<std::array<SeatPosition, 3>, 4> memory_positions_;  // 每个座椅3个记忆位置
+    std::shared_ptr<SeatMemoryStore> memory_store_;
+    
+    // 记忆位置恢复引擎（各轴、各座椅并行运动）
+    std::unique_ptr<SeatRecallEngine> recall_engine_;
+    
+    // 恢复记忆位置时每一步的间隔
+    static constexpr std::chrono::milliseconds RECALL_STEP_INTERVAL{100};
     
     // 服务配置
     static constexpr vsomeip::service_t SERVICE_ID = communication::SEAT_SERVICE_ID;
@@ -154,6 +206,7 @@ private:
     // 事件ID
     static constexpr vsomeip::event_t SEAT_POSITION_CHANGED_EVENT = communication::seat_events::ON_SEAT_POSITION_CHANGED;
     static constexpr vsomeip::event_t MEMORY_SAVE_CONFIRM_EVENT = communication::seat_events::ON_MEMORY_SAVE_CONFIRM;
+    static constexpr vsomeip::event_t RECALL_COMPLETE_EVENT = communication::seat_events::ON_RECALL_COMPLETE;
     
     // 事件组ID
     static constexpr vsomeip::eventgroup_t EVENT_GROUP = 0x0001;
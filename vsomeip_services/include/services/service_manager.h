@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <string>
 #include <atomic>
 #include <vsomeip/vsomeip.hpp>
 #include "services/door_service.h"
@@ -9,10 +10,27 @@
 #include "services/light_service.h"
 #include "services/seat_service.h"
 #include "common/hardware_simulator.h"
+#include "common/service_executor.h"
+#include "common/sim_clock.h"
+#include "common/vehicle_state.h"
 
 namespace body_controller {
 namespace services {
 
+/**
+ * @brief 服务管理器运行选项
+ * vsomeip自身的IO线程数（threads）和分发线程上限（max_dispatchers、max_dispatch_time）
+ * 在VSOMEIP配置文件的applications条目中设置
+ */
+struct ServiceManagerOptions {
+    size_t executor_threads = 1;            ///< 每个服务执行器的工作线程数（0表示在vsomeip分发线程上直接处理）
+    size_t executor_queue_capacity = 64;    ///< 每个服务执行器的队列容量（0表示不限）
+    std::string seat_memory_file = "seat_memory.dat";  ///< 座椅记忆位置存储文件（为空时不持久化）
+    SimulationProfile simulation;           ///< 硬件模拟器自动事件的速率、类型权重和突发数
+    std::string scenario_file;              ///< 硬件模拟场景文件（非空时替代随机事件）
+    bool virtual_time = false;              ///< 模拟器、硬件动作延迟和定时器使用虚拟时间
+};
+
 /**
  * @brief 服务管理器
  * 统一管理所有VSOMEIP服务的生命周期
@@ -21,8 +39,9 @@ class ServiceManager {
 public:
     /**
      * @brief 构造函数
+     * @param options 运行选项
      */
-    ServiceManager();
+    explicit ServiceManager(const ServiceManagerOptions& options = ServiceManagerOptions());
     
     /**
      * @brief 析构函数
@@ -64,6 +83,20 @@ public:
         return hardware_simulator_;
     }
 
+    /**
+     * @brief 获取整车执行器状态
+     */
+    std::shared_ptr<VehicleState> GetVehicleState() const {
+        return vehicle_state_;
+    }
+
+    /**
+     * @brief 获取模拟器时钟
+     */
+    std::shared_ptr<SimClock> GetClock() const {
+        return clock_;
+    }
+
 private:
     /**
      * @brief VSOMEIP应用程序状态回调
@@ -89,15 +122,35 @@ private:
      * @brief 停止硬件模拟器
      */
     void StopHardwareSimulator();
+    
+    /**
+     * @brief 为服务创建并启动执行器
+     * @return 未启用执行器时返回nullptr
+     */
+    std::shared_ptr<ServiceExecutor> CreateExecutor(const std::string& name);
+    
+    /**
+     * @brief 停止所有执行器（执行完已排队的请求）
+     */
+    void StopExecutors();
 
 private:
     // VSOMEIP应用程序
     std::shared_ptr<vsomeip::application> app_;
     
+    // 运行选项
+    ServiceManagerOptions options_;
+    
     // 运行状态
     std::atomic<bool> running_;
     std::atomic<bool> vsomeip_ready_;
     
+    // 模拟器时钟（模拟器、服务和定时器共用）
+    std::shared_ptr<SimClock> clock_;
+    
+    // 整车执行器状态
+    std::shared_ptr<VehicleState> vehicle_state_;
+    
     // 硬件模拟器
     std::shared_ptr<HardwareSimulator> hardware_simulator_;
     
@@ -107,6 +160,9 @@ private:
     std::unique_ptr<LightService> light_service_;
     std::unique_ptr<SeatService> seat_service_;
     
+    // 每个服务的请求执行器
+    std::vector<std::shared_ptr<ServiceExecutor>> executors_;
+    
     // 应用程序名称
     static constexpr const char* APPLICATION_NAME = "body_controller_services";
 };
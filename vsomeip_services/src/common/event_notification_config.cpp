@@ -0,0 +1,86 @@
+#include "common/event_notification_config.h"
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+namespace body_controller {
+namespace services {
+
+namespace {
+
+// VSOMEIP配置中的ID和数值既可能是"0x1001"这样的字符串，也可能是数字
+uint32_t ParseNumber(const nlohmann::json& value) {
+    if (value.is_string()) {
+        return static_cast<uint32_t>(std::stoul(value.get<std::string>(), nullptr, 0));
+    }
+    return value.get<uint32_t>();
+}
+
+bool ParseBool(const nlohmann::json& value) {
+    if (value.is_string()) {
+        return value.get<std::string>() == "true";
+    }
+    return value.get<bool>();
+}
+
+} // namespace
+
+bool EventNotificationTable::LoadFromFile(const std::string& config_file) {
+    entries_.clear();
+
+    std::ifstream file(config_file);
+    if (!file.is_open()) {
+        std::cerr << "[EventNotificationTable] Cannot open " << config_file << std::endl;
+        return false;
+    }
+
+    try {
+        nlohmann::json config = nlohmann::json::parse(file);
+        if (!config.contains("services")) {
+            return true;
+        }
+
+        for (const auto& service : config["services"]) {
+            if (!service.contains("service") || !service.contains("events")) {
+                continue;
+            }
+            const auto service_id = static_cast<vsomeip::service_t>(ParseNumber(service["service"]));
+
+            for (const auto& event : service["events"]) {
+                if (!event.contains("event")) {
+                    continue;
+                }
+                EventNotificationConfig entry;
+                if (event.contains("is_field")) {
+                    entry.is_field = ParseBool(event["is_field"]);
+                }
+                if (event.contains("update_cycle_ms")) {
+                    entry.update_cycle = std::chrono::milliseconds(ParseNumber(event["update_cycle_ms"]));
+                }
+                if (event.contains("change_only")) {
+                    entry.change_only = ParseBool(event["change_only"]);
+                }
+                const auto event_id = static_cast<vsomeip::event_t>(ParseNumber(event["event"]));
+                entries_[{service_id, event_id}] = entry;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[EventNotificationTable] Failed to parse " << config_file << ": " << e.what() << std::endl;
+        entries_.clear();
+        return false;
+    }
+
+    std::cout << "[EventNotificationTable] Loaded " << entries_.size() << " event(s) from " << config_file << std::endl;
+    return true;
+}
+
+EventNotificationConfig EventNotificationTable::Get(vsomeip::service_t service_id, vsomeip::event_t event_id) const {
+    auto it = entries_.find({service_id, event_id});
+    if (it == entries_.end()) {
+        return EventNotificationConfig{};
+    }
+    return it->second;
+}
+
+} // namespace services
+} // namespace body_controller
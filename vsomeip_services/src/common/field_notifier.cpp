@@ -0,0 +1,181 @@
+#include "common/field_notifier.h"
+#include <algorithm>
+#include <iostream>
+
+namespace body_controller {
+namespace services {
+
+FieldNotifier::FieldNotifier(std::shared_ptr<vsomeip::application> app,
+                             vsomeip::service_t service_id,
+                             vsomeip::instance_t instance_id,
+                             vsomeip::event_t event_id,
+                             const EventNotificationConfig& config,
+                             std::shared_ptr<SimClock> clock)
+    : app_(std::move(app))
+    , service_id_(service_id)
+    , instance_id_(instance_id)
+    , event_id_(event_id)
+    , config_(config)
+    , clock_(clock ? std::move(clock) : std::make_shared<SimClock>()) {
+}
+
+FieldNotifier::~FieldNotifier() {
+    Stop();
+}
+
+void FieldNotifier::Offer(const std::set<vsomeip::eventgroup_t>& event_groups) {
+    if (!app_) return;
+
+    // 周期重发由本类按条目完成，vsomeip层不再设置周期
+    app_->offer_event(service_id_, instance_id_, event_id_,
+                      event_groups,
+                      config_.is_field ? vsomeip::event_type_e::ET_FIELD : vsomeip::event_type_e::ET_EVENT,
+                      std::chrono::milliseconds::zero(),
+                      false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+
+    std::cout << "[FieldNotifier] Offered event 0x" << std::hex << event_id_ << std::dec
+              << " type=" << (config_.is_field ? "field" : "event")
+              << " cycle=" << config_.update_cycle.count() << "ms"
+              << " change_only=" << (config_.change_only ? "true" : "false") << std::endl;
+}
+
+void FieldNotifier::Start() {
+    if (!config_.is_field && config_.update_cycle.count() == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    timer_thread_ = std::thread(&FieldNotifier::TimerLoop, this);
+}
+
+void FieldNotifier::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        pending_replays_.clear();
+    }
+    cv_.notify_all();
+    if (timer_thread_.joinable()) {
+        timer_thread_.join();
+    }
+}
+
+bool FieldNotifier::Publish(uint32_t key, const std::vector<uint8_t>& payload) {
+    // 通知在锁内发出，保证订阅者收到的顺序与缓存的最新值一致
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = values_.find(key);
+    if (it != values_.end() && config_.change_only && it->second == payload) {
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    values_[key] = payload;
+
+    // 非change_only时相同的值也要发出（字段默认会丢弃重复值）
+    Notify(payload, !config_.change_only);
+    published_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void FieldNotifier::ScheduleReplay(vsomeip::client_t client) {
+    if (!config_.is_field) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        pending_replays_.emplace_back(client, clock_->Now() + REPLAY_DELAY);
+    }
+    cv_.notify_all();
+}
+
+FieldNotifier::Stats FieldNotifier::GetStats() const {
+    Stats stats;
+    stats.published = published_.load(std::memory_order_relaxed);
+    stats.suppressed = suppressed_.load(std::memory_order_relaxed);
+    stats.cyclic = cyclic_.load(std::memory_order_relaxed);
+    stats.replayed = replayed_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void FieldNotifier::TimerLoop() {
+    const bool cyclic = config_.update_cycle.count() > 0;
+    auto next_cycle = clock_->Now() + config_.update_cycle;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        auto wake_at = cyclic ? next_cycle : SimClock::TimePoint::max();
+        for (const auto& replay : pending_replays_) {
+            wake_at = std::min(wake_at, replay.second);
+        }
+        if (wake_at == SimClock::TimePoint::max()) {
+            // 无限期等待不经过时钟，先让出运行中计数
+            clock_->Done();
+            cv_.wait(lock);
+        } else {
+            // 新的补发请求会提前唤醒，重新计算唤醒时间
+            const size_t pending_count = pending_replays_.size();
+            clock_->WaitUntil(cv_, lock, wake_at, [this, pending_count]() {
+                return !running_ || pending_replays_.size() != pending_count;
+            });
+        }
+        if (!running_) {
+            break;
+        }
+
+        const auto now = clock_->Now();
+
+        std::vector<vsomeip::client_t> due_clients;
+        for (auto it = pending_replays_.begin(); it != pending_replays_.end();) {
+            if (it->second <= now) {
+                due_clients.push_back(it->first);
+                it = pending_replays_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        const bool cycle_due = cyclic && next_cycle <= now;
+        if (cycle_due) {
+            next_cycle = now + config_.update_cycle;
+        }
+        if (due_clients.empty() && !cycle_due) {
+            continue;
+        }
+
+        for (vsomeip::client_t client : due_clients) {
+            if (!app_) break;
+            for (const auto& value : values_) {
+                auto vsomeip_payload = vsomeip::runtime::get()->create_payload();
+                vsomeip_payload->set_data(value.second.data(), static_cast<uint32_t>(value.second.size()));
+                app_->notify_one(service_id_, instance_id_, event_id_, vsomeip_payload, client, true);
+            }
+            replayed_.fetch_add(values_.size(), std::memory_order_relaxed);
+        }
+        if (cycle_due) {
+            for (const auto& value : values_) {
+                Notify(value.second, true);
+            }
+            cyclic_.fetch_add(values_.size(), std::memory_order_relaxed);
+        }
+    }
+    clock_->Done();
+}
+
+void FieldNotifier::Notify(const std::vector<uint8_t>& payload, bool force) const {
+    if (!app_) return;
+
+    auto vsomeip_payload = vsomeip::runtime::get()->create_payload();
+    vsomeip_payload->set_data(payload.data(), static_cast<uint32_t>(payload.size()));
+    app_->notify(service_id_, instance_id_, event_id_, vsomeip_payload, force);
+}
+
+} // namespace services
+} // namespace body_controller
@@ -1,14 +1,22 @@
 #include "common/hardware_simulator.h"
+#include "common/simulation_scenario.h"
+#include <algorithm>
+#include <cerrno>
 #include <iostream>
 #include <chrono>
+#include <numeric>
+#include <time.h>
 
 namespace body_controller {
 namespace services {
 
-HardwareSimulator::HardwareSimulator()
+HardwareSimulator::HardwareSimulator(std::shared_ptr<VehicleState> state, std::shared_ptr<SimClock> clock)
     : running_(false)
     , event_interval_seconds_(10)  // 默认10秒触发一次事件
     , auto_events_enabled_(true)
+    , log_events_(true)
+    , state_(state ? std::move(state) : std::make_shared<VehicleState>())
+    , clock_(clock ? std::move(clock) : std::make_shared<SimClock>())
     , random_generator_(std::chrono::steady_clock::now().time_since_epoch().count())
     , door_distribution_(0, 3)      // 4个车门
     , window_distribution_(0, 3)    // 4个车窗
@@ -17,17 +25,6 @@ HardwareSimulator::HardwareSimulator()
     , light_state_distribution_(0, 2) // 灯光状态
     , seat_axis_distribution_(0, 1)  // 2个座椅调节轴
 {
-    // 初始化当前状态
-    for (int i = 0; i < 4; ++i) {
-        current_door_lock_states_[i] = application::LockState::UNLOCKED;
-        current_door_states_[i] = application::DoorState::CLOSED;
-        current_window_positions_[i] = 50; // 默认50%位置
-    }
-    
-    current_headlight_state_ = application::HeadlightState::OFF;
-    current_indicator_state_ = application::IndicatorState::OFF;
-    current_position_light_state_ = application::PositionLightState::OFF;
-    
     std::cout << "[HardwareSimulator] Hardware simulator created" << std::endl;
 }
 
@@ -43,11 +40,18 @@ void HardwareSimulator::Start() {
     }
     
     running_ = true;
+    log_events_ = (profile_.events_per_second == 0 && !scenario_);
     simulation_thread_ = std::make_unique<std::thread>(&HardwareSimulator::SimulationThread, this);
     
     std::cout << "[HardwareSimulator] Hardware simulator started" << std::endl;
     std::cout << "[HardwareSimulator] Auto events: " << (auto_events_enabled_ ? "enabled" : "disabled") << std::endl;
-    std::cout << "[HardwareSimulator] Event interval: " << event_interval_seconds_ << " seconds" << std::endl;
+    if (scenario_) {
+        std::cout << "[HardwareSimulator] Scenario mode: " << scenario_->GetName() << std::endl;
+    } else if (profile_.events_per_second > 0) {
+        std::cout << "[HardwareSimulator] High-rate mode: " << profile_.events_per_second << " triggers/s" << std::endl;
+    } else {
+        std::cout << "[HardwareSimulator] Event interval: " << event_interval_seconds_ << " seconds" << std::endl;
+    }
 }
 
 void HardwareSimulator::Stop() {
@@ -70,12 +74,14 @@ void HardwareSimulator::TriggerDoorLockEvent(application::Position door_id, appl
         event_data.doorID = door_id;
         event_data.newLockState = new_state;
         
-        // 更新内部状态
-        current_door_lock_states_[static_cast<int>(door_id)] = new_state;
+        // 更新共享状态
+        state_->SetLockState(door_id, new_state);
         
-        std::cout << "[HardwareSimulator] Triggering door lock event: Door " 
-                  << static_cast<int>(door_id) << " -> " 
-                  << (new_state == application::LockState::LOCKED ? "LOCKED" : "UNLOCKED") << std::endl;
+        if (log_events_) {
+            std::cout << "[HardwareSimulator] Triggering door lock event: Door " 
+                      << static_cast<int>(door_id) << " -> " 
+                      << (new_state == application::LockState::LOCKED ? "LOCKED" : "UNLOCKED") << std::endl;
+        }
         
         door_lock_callback_(event_data);
     }
@@ -87,11 +93,13 @@ void HardwareSimulator::TriggerWindowPositionEvent(application::Position window_
         event_data.windowID = window_id;
         event_data.newPosition = new_position;
         
-        // 更新内部状态
-        current_window_positions_[static_cast<int>(window_id)] = new_position;
+        // 更新共享状态
+        state_->SetWindowPosition(window_id, new_position);
         
-        std::cout << "[HardwareSimulator] Triggering window position event: Window " 
-                  << static_cast<int>(window_id) << " -> " << static_cast<int>(new_position) << "%" << std::endl;
+        if (log_events_) {
+            std::cout << "[HardwareSimulator] Triggering window position event: Window " 
+                      << static_cast<int>(window_id) << " -> " << static_cast<int>(new_position) << "%" << std::endl;
+        }
         
         window_position_callback_(event_data);
     }
@@ -103,62 +111,262 @@ void HardwareSimulator::TriggerLightStateEvent(application::LightType light_type
         event_data.lightType = light_type;
         event_data.newState = new_state;
         
-        // 更新内部状态
-        switch (light_type) {
-            case application::LightType::HEADLIGHT:
-                current_headlight_state_ = static_cast<application::HeadlightState>(new_state);
-                break;
-            case application::LightType::INDICATOR:
-                current_indicator_state_ = static_cast<application::IndicatorState>(new_state);
-                break;
-            case application::LightType::POSITION_LIGHT:
-                current_position_light_state_ = static_cast<application::PositionLightState>(new_state);
-                break;
-        }
+        // 更新共享状态
+        state_->SetLightState(light_type, new_state);
         
-        std::cout << "[HardwareSimulator] Triggering light state event: Type " 
-                  << static_cast<int>(light_type) << " -> " << static_cast<int>(new_state) << std::endl;
+        if (log_events_) {
+            std::cout << "[HardwareSimulator] Triggering light state event: Type " 
+                      << static_cast<int>(light_type) << " -> " << static_cast<int>(new_state) << std::endl;
+        }
         
         light_state_callback_(event_data);
     }
 }
 
+void HardwareSimulator::TriggerDoorStateEvent(application::Position door_id, application::DoorState new_state) {
+    if (door_state_callback_) {
+        application::OnDoorStateChangedData event_data;
+        event_data.doorID = door_id;
+        event_data.newDoorState = new_state;
+        
+        // 更新共享状态
+        state_->SetDoorState(door_id, new_state);
+        
+        if (log_events_) {
+            std::cout << "[HardwareSimulator] Triggering door state event: Door " 
+                      << static_cast<int>(door_id) << " -> " 
+                      << (new_state == application::DoorState::OPEN ? "OPEN" : "CLOSED") << std::endl;
+        }
+        
+        door_state_callback_(event_data);
+    }
+}
+
+void HardwareSimulator::TriggerSeatPositionEvent(application::Position seat_id, application::SeatAxis axis,
+                                                 int32_t new_position) {
+    if (seat_position_callback_) {
+        // 更新共享状态
+        state_->SetSeatAxis(seat_id, axis, new_position);
+        
+        application::OnSeatPositionChangedData event_data;
+        event_data.axis = axis;
+        event_data.newPosition = new_position;
+        event_data.seatID = seat_id;
+        
+        if (log_events_) {
+            std::cout << "[HardwareSimulator] Triggering seat position event: Seat " 
+                      << static_cast<int>(seat_id) << " Axis " << static_cast<int>(axis)
+                      << " -> " << new_position << std::endl;
+        }
+        
+        seat_position_callback_(event_data);
+    }
+}
+
 void HardwareSimulator::SimulationThread() {
     std::cout << "[HardwareSimulator] Simulation thread started" << std::endl;
     
+    if (scenario_) {
+        RunScenario();
+    } else if (profile_.events_per_second > 0) {
+        RunHighRateLoop();
+    } else {
+        RunIntervalLoop();
+    }
+    clock_->Done();
+    
+    std::cout << "[HardwareSimulator] Simulation thread stopped" << std::endl;
+}
+
+void HardwareSimulator::RunIntervalLoop() {
     while (running_) {
         // 等待指定的时间间隔
-        for (int i = 0; i < event_interval_seconds_ && running_; ++i) {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+        if (!WaitUntil(NowNs() + event_interval_seconds_ * 1000000000LL)) break;
+        
+        // 如果启用了自动事件生成，随机生成一个事件
+        if (auto_events_enabled_) {
+            GenerateEvent(static_cast<SimulatedEventType>(random_generator_() % SIMULATED_EVENT_TYPE_COUNT));
+        }
+    }
+}
+
+void HardwareSimulator::RunHighRateLoop() {
+    const int64_t period_ns = std::max<int64_t>(1000000000LL / profile_.events_per_second, 1);
+    
+    // 权重全为0时退化为均匀分布
+    std::array<uint32_t, SIMULATED_EVENT_TYPE_COUNT> weights = profile_.mix;
+    if (std::accumulate(weights.begin(), weights.end(), 0ULL) == 0) {
+        weights.fill(1);
+    }
+    std::discrete_distribution<int> type_distribution(weights.begin(), weights.end());
+    
+    uint64_t triggers = 0;
+    uint64_t events = 0;
+    uint64_t late_triggers = 0;
+    uint64_t dropped_triggers = 0;
+    int64_t max_lag_ns = 0;
+    
+    int64_t deadline_ns = NowNs();
+    int64_t report_at_ns = deadline_ns + 1000000000LL;
+    while (running_) {
+        deadline_ns += period_ns;
+        if (!WaitUntil(deadline_ns)) {
+            break;
         }
         
-        if (!running_) break;
+        const int64_t now_ns = NowNs();
+        const int64_t lag_ns = now_ns - deadline_ns;
+        max_lag_ns = std::max(max_lag_ns, lag_ns);
+        if (lag_ns > period_ns) {
+            ++late_triggers;
+        }
+        if (lag_ns > MAX_BACKLOG_NS) {
+            // 回调阻塞过久，丢弃积压的触发而不是集中补发
+            dropped_triggers += static_cast<uint64_t>(lag_ns / period_ns);
+            deadline_ns = now_ns;
+        }
         
-        // 如果启用了自动事件生成，随机生成一个事件
         if (auto_events_enabled_) {
-            int event_type = random_generator_() % 5; // 5种事件类型
-            
-            switch (event_type) {
-                case 0:
-                    GenerateRandomDoorLockEvent();
-                    break;
-                case 1:
-                    GenerateRandomDoorStateEvent();
-                    break;
-                case 2:
-                    GenerateRandomWindowPositionEvent();
-                    break;
-                case 3:
-                    GenerateRandomLightStateEvent();
-                    break;
-                case 4:
-                    GenerateRandomSeatPositionEvent();
-                    break;
+            const int type_index = type_distribution(random_generator_);
+            const uint32_t burst = std::max<uint32_t>(profile_.burst[type_index], 1);
+            for (uint32_t i = 0; i < burst && running_; ++i) {
+                GenerateEvent(static_cast<SimulatedEventType>(type_index));
             }
+            ++triggers;
+            events += burst;
+        }
+        
+        if (now_ns >= report_at_ns) {
+            std::cout << "[HardwareSimulator] " << triggers << " triggers/s, " << events << " events/s"
+                      << ", late: " << late_triggers << ", dropped: " << dropped_triggers
+                      << ", max lag: " << max_lag_ns / 1000 << "us" << std::endl;
+            triggers = events = late_triggers = dropped_triggers = 0;
+            max_lag_ns = 0;
+            report_at_ns = now_ns + 1000000000LL;
         }
     }
-    
-    std::cout << "[HardwareSimulator] Simulation thread stopped" << std::endl;
+}
+
+void HardwareSimulator::GenerateEvent(SimulatedEventType type) {
+    switch (type) {
+        case SimulatedEventType::DOOR_LOCK:
+            GenerateRandomDoorLockEvent();
+            break;
+        case SimulatedEventType::DOOR_STATE:
+            GenerateRandomDoorStateEvent();
+            break;
+        case SimulatedEventType::WINDOW_POSITION:
+            GenerateRandomWindowPositionEvent();
+            break;
+        case SimulatedEventType::LIGHT_STATE:
+            GenerateRandomLightStateEvent();
+            break;
+        case SimulatedEventType::SEAT_POSITION:
+            GenerateRandomSeatPositionEvent();
+            break;
+    }
+}
+
+int64_t HardwareSimulator::NowNs() const {
+    // steady_clock与clock_nanosleep使用同一个CLOCK_MONOTONIC
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_->Now().time_since_epoch()).count();
+}
+
+bool HardwareSimulator::WaitUntil(int64_t deadline_ns) const {
+    if (clock_->IsVirtual()) {
+        const SimClock::TimePoint deadline(
+            std::chrono::duration_cast<SimClock::Duration>(std::chrono::nanoseconds(deadline_ns)));
+        return clock_->SleepUntil(deadline, [this]() { return !running_; });
+    }
+    while (running_) {
+        const int64_t now_ns = NowNs();
+        const int64_t sleep_until_ns = std::min(deadline_ns - SPIN_WINDOW_NS, now_ns + MAX_SLEEP_NS);
+        if (now_ns >= sleep_until_ns) {
+            break;
+        }
+        timespec wake_at;
+        wake_at.tv_sec = static_cast<time_t>(sleep_until_ns / 1000000000LL);
+        wake_at.tv_nsec = static_cast<long>(sleep_until_ns % 1000000000LL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_at, nullptr) == EINTR) {
+        }
+    }
+    while (running_ && NowNs() < deadline_ns) {
+        // 忙等剩余时间
+    }
+    return running_;
+}
+
+bool HardwareSimulator::LoadScenario(const std::string& path) {
+    auto scenario = std::make_shared<SimulationScenario>();
+    if (!scenario->LoadFromFile(path)) {
+        return false;
+    }
+    scenario_ = std::move(scenario);
+    return true;
+}
+
+void HardwareSimulator::RunScenario() {
+    const SimulationScenario& scenario = *scenario_;
+    const auto& events = scenario.GetEvents();
+    const uint32_t repeat = scenario.GetRepeat();
+    // 每轮至少1ms，避免空场景在repeat为0时空转
+    const int64_t cycle_ns = std::max<int64_t>(scenario.GetDurationNs(), 1000000);
+
+    const int64_t start_ns = NowNs();
+    for (uint32_t round = 0; running_ && (repeat == 0 || round < repeat); ++round) {
+        const int64_t round_start_ns = start_ns + static_cast<int64_t>(round) * cycle_ns;
+        uint64_t played = 0;
+        int64_t total_lag_ns = 0;
+        int64_t max_lag_ns = 0;
+
+        // 落后时立即执行后续事件，事件顺序和取值始终与事件表一致
+        for (size_t i = 0; i < events.size(); ++i) {
+            const int64_t deadline_ns = round_start_ns + events[i].offset_ns;
+            if (!WaitUntil(deadline_ns)) {
+                break;
+            }
+            const int64_t lag_ns = NowNs() - deadline_ns;
+            total_lag_ns += lag_ns;
+            max_lag_ns = std::max(max_lag_ns, lag_ns);
+            if (auto_events_enabled_) {
+                PlayScenarioEvent(scenario, i);
+            }
+            ++played;
+        }
+        if (!WaitUntil(round_start_ns + cycle_ns)) {
+            break;
+        }
+
+        std::cout << "[HardwareSimulator] Scenario \"" << scenario.GetName() << "\" round " << round + 1
+                  << ": " << played << " events, mean lag: "
+                  << (played ? total_lag_ns / static_cast<int64_t>(played) / 1000 : 0)
+                  << "us, max lag: " << max_lag_ns / 1000 << "us" << std::endl;
+    }
+}
+
+void HardwareSimulator::PlayScenarioEvent(const SimulationScenario& scenario, size_t index) {
+    const SimulationScenario::Event& event = scenario.GetEvents()[index];
+    const auto position = static_cast<application::Position>(event.id);
+    switch (event.type) {
+        case SimulatedEventType::DOOR_LOCK:
+            TriggerDoorLockEvent(position, event.value ? application::LockState::UNLOCKED
+                                                       : application::LockState::LOCKED);
+            break;
+        case SimulatedEventType::DOOR_STATE:
+            TriggerDoorStateEvent(position, event.value ? application::DoorState::OPEN
+                                                        : application::DoorState::CLOSED);
+            break;
+        case SimulatedEventType::WINDOW_POSITION:
+            TriggerWindowPositionEvent(position, static_cast<uint8_t>(std::clamp(event.value, 0, 100)));
+            break;
+        case SimulatedEventType::LIGHT_STATE:
+            TriggerLightStateEvent(static_cast<application::LightType>(event.id),
+                                   static_cast<uint8_t>(std::clamp(event.value, 0, 255)));
+            break;
+        case SimulatedEventType::SEAT_POSITION:
+            TriggerSeatPositionEvent(position, static_cast<application::SeatAxis>(event.axis), event.value);
+            break;
+    }
 }
 
 void HardwareSimulator::GenerateRandomDoorLockEvent() {
@@ -168,8 +376,7 @@ void HardwareSimulator::GenerateRandomDoorLockEvent() {
     application::Position door_id = static_cast<application::Position>(door_index);
     
     // 切换当前状态
-    application::LockState current_state = current_door_lock_states_[door_index];
-    application::LockState new_state = (current_state == application::LockState::LOCKED) 
+    application::LockState new_state = (state_->GetLockState(door_id) == application::LockState::LOCKED)
                                      ? application::LockState::UNLOCKED 
                                      : application::LockState::LOCKED;
     
@@ -182,21 +389,18 @@ void HardwareSimulator::GenerateRandomDoorStateEvent() {
     int door_index = door_distribution_(random_generator_);
     application::Position door_id = static_cast<application::Position>(door_index);
     
-    // 切换当前状态
-    application::DoorState current_state = current_door_states_[door_index];
-    application::DoorState new_state = (current_state == application::DoorState::CLOSED) 
-                                     ? application::DoorState::OPEN 
-                                     : application::DoorState::CLOSED;
-    
-    current_door_states_[door_index] = new_state;
+    // 原子地切换共享状态
+    application::DoorState new_state = state_->ToggleDoorState(door_id);
     
     application::OnDoorStateChangedData event_data;
     event_data.doorID = door_id;
     event_data.newDoorState = new_state;
     
-    std::cout << "[HardwareSimulator] Generated door state event: Door " 
-              << door_index << " -> " 
-              << (new_state == application::DoorState::OPEN ? "OPEN" : "CLOSED") << std::endl;
+    if (log_events_) {
+        std::cout << "[HardwareSimulator] Generated door state event: Door " 
+                  << door_index << " -> " 
+                  << (new_state == application::DoorState::OPEN ? "OPEN" : "CLOSED") << std::endl;
+    }
     
     door_state_callback_(event_data);
 }
@@ -256,12 +460,18 @@ void HardwareSimulator::GenerateRandomSeatPositionEvent() {
         new_position = random_generator_() % 91; // 0 到 90
     }
     
+    // 更新共享状态
+    state_->SetSeatAxis(static_cast<application::Position>(seat_index), axis, new_position);
+    
     application::OnSeatPositionChangedData event_data;
     event_data.axis = axis;
     event_data.newPosition = new_position;
+    event_data.seatID = static_cast<application::Position>(seat_index);
     
-    std::cout << "[HardwareSimulator] Generated seat position event: Seat " 
-              << seat_index << " Axis " << axis_index << " -> " << new_position << std::endl;
+    if (log_events_) {
+        std::cout << "[HardwareSimulator] Generated seat position event: Seat " 
+                  << seat_index << " Axis " << axis_index << " -> " << new_position << std::endl;
+    }
     
     seat_position_callback_(event_data);
 }
@@ -0,0 +1,226 @@
+#include "common/seat_memory_store.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace body_controller {
+namespace services {
+
+namespace {
+
+constexpr uint32_t FILE_MAGIC = 0x4D454D53;    // "SMEM"
+constexpr uint16_t FILE_VERSION = 1;
+
+} // namespace
+
+struct SeatMemoryStore::FileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t seat_count;
+    uint8_t user_count;
+    uint8_t preset_count;
+    uint8_t reserved[3];
+    uint32_t slot_size;
+};
+
+struct SeatMemoryStore::PresetRecord {
+    uint32_t sequence;                  ///< 0表示从未写入
+    int32_t forward_backward_position;
+    int32_t recline_position;
+    uint32_t checksum;
+};
+
+struct SeatMemoryStore::PresetSlot {
+    PresetRecord copies[2];
+};
+
+SeatMemoryStore::~SeatMemoryStore() {
+    Close();
+}
+
+bool SeatMemoryStore::Open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (mapping_) {
+        return IsPersistent();
+    }
+
+    if (!path.empty() && MapFile(path)) {
+        std::cout << "[SeatMemoryStore] Mapped preset store " << path << std::endl;
+        return true;
+    }
+
+    MapAnonymous();
+    std::cerr << "[SeatMemoryStore] Presets will not persist across restarts" << std::endl;
+    return false;
+}
+
+void SeatMemoryStore::Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (mapping_) {
+        munmap(mapping_, MappingSize());
+        mapping_ = nullptr;
+        slots_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool SeatMemoryStore::Save(application::Position seat_id, uint8_t user_id, uint8_t preset_id,
+                           const SeatPosition& position) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PresetSlot* slot = FindSlot(seat_id, user_id, preset_id);
+    if (!slot) {
+        return false;
+    }
+
+    // 覆盖无效或较旧的一份，另一份在写入完成前保持有效
+    const bool valid0 = IsValid(slot->copies[0]);
+    const bool valid1 = IsValid(slot->copies[1]);
+    const uint32_t seq0 = valid0 ? slot->copies[0].sequence : 0;
+    const uint32_t seq1 = valid1 ? slot->copies[1].sequence : 0;
+    PresetRecord& target = (seq0 <= seq1) ? slot->copies[0] : slot->copies[1];
+
+    PresetRecord record;
+    record.sequence = std::max(seq0, seq1) + 1;
+    record.forward_backward_position = position.forward_backward_position;
+    record.recline_position = position.recline_position;
+    record.checksum = Checksum(record);
+    std::memcpy(&target, &record, sizeof(record));
+
+    if (fd_ >= 0) {
+        // 只同步记录所在的页
+        const long page_size = sysconf(_SC_PAGESIZE);
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(&target) & ~static_cast<uintptr_t>(page_size - 1);
+        const uintptr_t end = reinterpret_cast<uintptr_t>(&target) + sizeof(PresetRecord);
+        if (msync(reinterpret_cast<void*>(begin), end - begin, MS_SYNC) != 0) {
+            std::cerr << "[SeatMemoryStore] msync failed: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SeatMemoryStore::Load(application::Position seat_id, uint8_t user_id, uint8_t preset_id,
+                           SeatPosition& position) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const PresetSlot* slot = FindSlot(seat_id, user_id, preset_id);
+    if (!slot) {
+        return false;
+    }
+
+    const PresetRecord* latest = nullptr;
+    for (const auto& copy : slot->copies) {
+        if (IsValid(copy) && (!latest || copy.sequence > latest->sequence)) {
+            latest = &copy;
+        }
+    }
+    if (!latest) {
+        return false;
+    }
+
+    position.forward_backward_position = latest->forward_backward_position;
+    position.recline_position = latest->recline_position;
+    return true;
+}
+
+size_t SeatMemoryStore::MappingSize() {
+    return sizeof(FileHeader) + SEAT_COUNT * USER_COUNT * PRESET_COUNT * sizeof(PresetSlot);
+}
+
+uint32_t SeatMemoryStore::Checksum(const PresetRecord& record) {
+    // FNV-1a，覆盖序号和位置字段
+    uint32_t hash = 2166136261u;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&record);
+    for (size_t i = 0; i < offsetof(PresetRecord, checksum); ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+bool SeatMemoryStore::IsValid(const PresetRecord& record) {
+    return record.sequence != 0 && record.checksum == Checksum(record);
+}
+
+bool SeatMemoryStore::MapFile(const std::string& path) {
+    const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "[SeatMemoryStore] Cannot open " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return false;
+    }
+
+    const size_t size = MappingSize();
+    const bool size_matches = static_cast<size_t>(file_stat.st_size) == size;
+    if (!size_matches && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        std::cerr << "[SeatMemoryStore] Cannot resize " << path << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "[SeatMemoryStore] mmap failed: " << std::strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+
+    auto* header = static_cast<FileHeader*>(mapping);
+    const bool layout_matches = size_matches &&
+        header->magic == FILE_MAGIC && header->version == FILE_VERSION &&
+        header->seat_count == SEAT_COUNT && header->user_count == USER_COUNT &&
+        header->preset_count == PRESET_COUNT && header->slot_size == sizeof(PresetSlot);
+    if (!layout_matches) {
+        // 新文件或布局不兼容：清空后写入文件头
+        std::memset(mapping, 0, size);
+        header->magic = FILE_MAGIC;
+        header->version = FILE_VERSION;
+        header->seat_count = SEAT_COUNT;
+        header->user_count = USER_COUNT;
+        header->preset_count = PRESET_COUNT;
+        header->slot_size = sizeof(PresetSlot);
+        msync(mapping, size, MS_SYNC);
+        std::cout << "[SeatMemoryStore] Initialized empty preset store " << path << std::endl;
+    }
+
+    fd_ = fd;
+    mapping_ = mapping;
+    slots_ = reinterpret_cast<PresetSlot*>(static_cast<uint8_t*>(mapping) + sizeof(FileHeader));
+    return true;
+}
+
+bool SeatMemoryStore::MapAnonymous() {
+    void* mapping = mmap(nullptr, MappingSize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "[SeatMemoryStore] Anonymous mmap failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    mapping_ = mapping;
+    slots_ = reinterpret_cast<PresetSlot*>(static_cast<uint8_t*>(mapping) + sizeof(FileHeader));
+    return true;
+}
+
+SeatMemoryStore::PresetSlot* SeatMemoryStore::FindSlot(application::Position seat_id, uint8_t user_id,
+                                                       uint8_t preset_id) const {
+    const size_t seat_index = static_cast<size_t>(seat_id);
+    if (!slots_ || seat_index >= SEAT_COUNT || user_id >= USER_COUNT ||
+        preset_id < 1 || preset_id > PRESET_COUNT) {
+        return nullptr;
+    }
+    return &slots_[(seat_index * USER_COUNT + user_id) * PRESET_COUNT + (preset_id - 1)];
+}
+
+} // namespace services
+} // namespace body_controller
@@ -0,0 +1,227 @@
+#include "common/seat_recall_engine.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace body_controller {
+namespace services {
+
+namespace {
+
+uint32_t StepsFor(application::SeatAxis axis, int32_t distance) {
+    const int32_t step = (axis == application::SeatAxis::FORWARD_BACKWARD)
+                       ? VehicleState::FORWARD_BACKWARD_STEP : VehicleState::RECLINE_STEP;
+    const int32_t magnitude = std::abs(distance);
+    return static_cast<uint32_t>((magnitude + step - 1) / step);
+}
+
+} // namespace
+
+SeatRecallEngine::SeatRecallEngine(std::shared_ptr<VehicleState> state, std::chrono::milliseconds step_interval,
+                                   std::shared_ptr<SimClock> clock)
+    : state_(std::move(state))
+    , step_interval_(step_interval)
+    , clock_(clock ? std::move(clock) : std::make_shared<SimClock>()) {
+}
+
+SeatRecallEngine::~SeatRecallEngine() {
+    Stop();
+}
+
+void SeatRecallEngine::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread(&SeatRecallEngine::Run, this);
+}
+
+void SeatRecallEngine::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        for (auto& plan : plans_) {
+            plan.active = false;
+        }
+        active_count_ = 0;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+bool SeatRecallEngine::Recall(application::Position seat_id, uint8_t preset_id, const SeatPosition& target) {
+    const size_t seat_index = static_cast<size_t>(seat_id);
+    if (seat_index >= VehicleState::SEAT_COUNT) {
+        return false;
+    }
+
+    std::vector<application::OnSeatRecallCompleteData> completed;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return false;
+        }
+
+        SeatPlan& plan = plans_[seat_index];
+        if (plan.active) {
+            completed.push_back(FinishLocked(plan, seat_id, application::Result::FAIL));
+            --active_count_;
+        }
+
+        // 以当前位置为起点规划，最慢轴决定总步数
+        const SeatPosition current = state_->GetSeatPosition(seat_id);
+        plan.axes[0] = {application::SeatAxis::FORWARD_BACKWARD, current.forward_backward_position,
+                        target.forward_backward_position, current.forward_backward_position};
+        plan.axes[1] = {application::SeatAxis::RECLINE, current.recline_position,
+                        target.recline_position, current.recline_position};
+        plan.preset_id = preset_id;
+        plan.step = 0;
+        plan.total_steps = 0;
+        for (const auto& axis : plan.axes) {
+            plan.total_steps = std::max(plan.total_steps, StepsFor(axis.axis, axis.target - axis.start));
+        }
+
+        if (plan.total_steps == 0) {
+            completed.push_back(FinishLocked(plan, seat_id, application::Result::SUCCESS));
+        } else {
+            plan.active = true;
+            ++active_count_;
+            std::cout << "[SeatRecallEngine] Seat " << seat_index << " recall planned: "
+                      << plan.total_steps << " steps" << std::endl;
+        }
+
+        // 虚拟时间下工作线程登记第一个节拍之前时间不能前进
+        if (idle_ && active_count_ > 0 && !handoff_pending_) {
+            handoff_pending_ = true;
+            clock_->Handoff();
+        }
+    }
+    cv_.notify_all();
+
+    Emit({}, completed);
+    return true;
+}
+
+void SeatRecallEngine::Cancel(application::Position seat_id) {
+    const size_t seat_index = static_cast<size_t>(seat_id);
+    if (seat_index >= VehicleState::SEAT_COUNT) {
+        return;
+    }
+
+    std::vector<application::OnSeatRecallCompleteData> completed;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        SeatPlan& plan = plans_[seat_index];
+        if (!plan.active) {
+            return;
+        }
+        completed.push_back(FinishLocked(plan, seat_id, application::Result::FAIL));
+        --active_count_;
+    }
+
+    std::cout << "[SeatRecallEngine] Seat " << seat_index << " recall interrupted" << std::endl;
+    Emit({}, completed);
+}
+
+bool SeatRecallEngine::IsActive(application::Position seat_id) const {
+    const size_t seat_index = static_cast<size_t>(seat_id);
+    if (seat_index >= VehicleState::SEAT_COUNT) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return plans_[seat_index].active;
+}
+
+void SeatRecallEngine::Run() {
+    std::vector<application::OnSeatPositionChangedData> progress;
+    std::vector<application::OnSeatRecallCompleteData> completed;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        if (active_count_ == 0) {
+            clock_->Done();
+            idle_ = true;
+            cv_.wait(lock, [this]() { return !running_ || active_count_ > 0; });
+            idle_ = false;
+            if (handoff_pending_) {
+                handoff_pending_ = false;
+                clock_->Adopt();
+            }
+            continue;
+        }
+
+        // 只在停止时提前唤醒，新计划在下一个节拍加入
+        const auto next_step = clock_->Now() + step_interval_;
+        if (clock_->WaitUntil(cv_, lock, next_step, [this]() { return !running_; })) {
+            break;
+        }
+
+        AdvanceLocked(progress, completed);
+
+        // 回调在锁外执行，回调中可以再次调用Recall/Cancel
+        lock.unlock();
+        Emit(progress, completed);
+        progress.clear();
+        completed.clear();
+        lock.lock();
+    }
+    clock_->Done();
+}
+
+void SeatRecallEngine::AdvanceLocked(std::vector<application::OnSeatPositionChangedData>& progress,
+                                     std::vector<application::OnSeatRecallCompleteData>& completed) {
+    for (size_t i = 0; i < plans_.size(); ++i) {
+        SeatPlan& plan = plans_[i];
+        if (!plan.active) {
+            continue;
+        }
+
+        const auto seat_id = static_cast<application::Position>(i);
+        ++plan.step;
+        for (auto& axis : plan.axes) {
+            // 线性插值，最后一步精确落在目标上
+            const int64_t distance = static_cast<int64_t>(axis.target) - axis.start;
+            const int32_t position = axis.start + static_cast<int32_t>(distance * plan.step / plan.total_steps);
+            if (position == axis.current) {
+                continue;
+            }
+            axis.current = position;
+            state_->SetSeatAxis(seat_id, axis.axis, position);
+            progress.emplace_back(axis.axis, static_cast<uint8_t>(position), seat_id);
+        }
+
+        if (plan.step >= plan.total_steps) {
+            completed.push_back(FinishLocked(plan, seat_id, application::Result::SUCCESS));
+            --active_count_;
+        }
+    }
+}
+
+application::OnSeatRecallCompleteData SeatRecallEngine::FinishLocked(SeatPlan& plan, application::Position seat_id,
+                                                                     application::Result result) {
+    plan.active = false;
+    return application::OnSeatRecallCompleteData(seat_id, plan.preset_id, result);
+}
+
+void SeatRecallEngine::Emit(const std::vector<application::OnSeatPositionChangedData>& progress,
+                            const std::vector<application::OnSeatRecallCompleteData>& completed) const {
+    if (progress_callback_) {
+        for (const auto& event : progress) {
+            progress_callback_(event);
+        }
+    }
+    if (complete_callback_) {
+        for (const auto& event : completed) {
+            complete_callback_(event);
+        }
+    }
+}
+
+} // namespace services
+} // namespace body_controller
@@ -281,6 +281,48 @@ bool Serializer::Deserialize(const std::vector<uint8_t>& data, application::SetH
     return true;
 }
 
+std::vector<uint8_t> Serializer::Serialize(const application::GetLightStateReq& request) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, static_cast<uint8_t>(request.lightType));
+    return buffer;
+}
+
+bool Serializer::Deserialize(const std::vector<uint8_t>& data, application::GetLightStateReq& request) {
+    if (data.size() < 1) return false;
+
+    size_t offset = 0;
+    uint8_t light_type;
+
+    if (!ReadFromBuffer(data, offset, light_type)) {
+        return false;
+    }
+
+    request.lightType = static_cast<application::LightType>(light_type);
+    return true;
+}
+
+std::vector<uint8_t> Serializer::Serialize(const application::GetLightStateResp& response) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, static_cast<uint8_t>(response.lightType));
+    WriteToBuffer(buffer, response.state);
+    return buffer;
+}
+
+bool Serializer::Deserialize(const std::vector<uint8_t>& data, application::GetLightStateResp& response) {
+    if (data.size() < 2) return false;
+
+    size_t offset = 0;
+    uint8_t light_type;
+
+    if (!ReadFromBuffer(data, offset, light_type) ||
+        !ReadFromBuffer(data, offset, response.state)) {
+        return false;
+    }
+
+    response.lightType = static_cast<application::LightType>(light_type);
+    return true;
+}
+
 std::vector<uint8_t> Serializer::Serialize(const application::OnLightStateChangedData& event) {
     std::vector<uint8_t> buffer;
     WriteToBuffer(buffer, static_cast<uint8_t>(event.lightType));
@@ -311,6 +353,7 @@ std::vector<uint8_t> Serializer::Serialize(const application::AdjustSeatReq& req
     std::vector<uint8_t> buffer;
     WriteToBuffer(buffer, static_cast<uint8_t>(request.axis));
     WriteToBuffer(buffer, static_cast<uint8_t>(request.direction));
+    WriteToBuffer(buffer, static_cast<uint8_t>(request.seatID));
     return buffer;
 }
 
@@ -319,14 +362,20 @@ bool Serializer::Deserialize(const std::vector<uint8_t>& data, application::Adju
 
     size_t offset = 0;
     uint8_t axis, direction;
+    uint8_t seat = static_cast<uint8_t>(application::Position::FRONT_LEFT);
 
     if (!ReadFromBuffer(data, offset, axis) ||
         !ReadFromBuffer(data, offset, direction)) {
         return false;
     }
+    // seatID为可选字段，旧客户端不携带
+    if (offset < data.size() && !ReadFromBuffer(data, offset, seat)) {
+        return false;
+    }
 
     request.axis = static_cast<application::SeatAxis>(axis);
     request.direction = static_cast<application::SeatDirection>(direction);
+    request.seatID = static_cast<application::Position>(seat);
     return true;
 }
 
@@ -334,6 +383,7 @@ std::vector<uint8_t> Serializer::Serialize(const application::OnSeatPositionChan
     std::vector<uint8_t> buffer;
     WriteToBuffer(buffer, static_cast<uint8_t>(event.axis));
     WriteToBuffer(buffer, event.newPosition);
+    WriteToBuffer(buffer, static_cast<uint8_t>(event.seatID));
     return buffer;
 }
 
@@ -342,16 +392,98 @@ bool Serializer::Deserialize(const std::vector<uint8_t>& data, application::OnSe
 
     size_t offset = 0;
     uint8_t axis;
+    uint8_t seat = static_cast<uint8_t>(application::Position::FRONT_LEFT);
 
     if (!ReadFromBuffer(data, offset, axis) ||
         !ReadFromBuffer(data, offset, event.newPosition)) {
         return false;
     }
+    if (offset < data.size() && !ReadFromBuffer(data, offset, seat)) {
+        return false;
+    }
 
     event.axis = static_cast<application::SeatAxis>(axis);
+    event.seatID = static_cast<application::Position>(seat);
     return true;
 }
 
+std::vector<uint8_t> Serializer::Serialize(const application::RecallMemoryPositionReq& request) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, request.presetID);
+    WriteToBuffer(buffer, request.userID);
+    WriteToBuffer(buffer, static_cast<uint8_t>(request.seatID));
+    return buffer;
+}
+
+bool Serializer::Deserialize(const std::vector<uint8_t>& data, application::RecallMemoryPositionReq& request) {
+    size_t offset = 0;
+    uint8_t seat = static_cast<uint8_t>(application::Position::FRONT_LEFT);
+    request.userID = 0;
+
+    if (!ReadFromBuffer(data, offset, request.presetID)) {
+        return false;
+    }
+    if ((offset < data.size() && !ReadFromBuffer(data, offset, request.userID)) ||
+        (offset < data.size() && !ReadFromBuffer(data, offset, seat))) {
+        return false;
+    }
+    request.seatID = static_cast<application::Position>(seat);
+    return true;
+}
+
+std::vector<uint8_t> Serializer::Serialize(const application::RecallMemoryPositionResp& response) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, response.presetID);
+    WriteToBuffer(buffer, static_cast<uint8_t>(response.result));
+    return buffer;
+}
+
+std::vector<uint8_t> Serializer::Serialize(const application::SaveMemoryPositionReq& request) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, request.presetID);
+    WriteToBuffer(buffer, request.userID);
+    WriteToBuffer(buffer, static_cast<uint8_t>(request.seatID));
+    return buffer;
+}
+
+bool Serializer::Deserialize(const std::vector<uint8_t>& data, application::SaveMemoryPositionReq& request) {
+    size_t offset = 0;
+    uint8_t seat = static_cast<uint8_t>(application::Position::FRONT_LEFT);
+    request.userID = 0;
+
+    if (!ReadFromBuffer(data, offset, request.presetID)) {
+        return false;
+    }
+    if ((offset < data.size() && !ReadFromBuffer(data, offset, request.userID)) ||
+        (offset < data.size() && !ReadFromBuffer(data, offset, seat))) {
+        return false;
+    }
+    request.seatID = static_cast<application::Position>(seat);
+    return true;
+}
+
+std::vector<uint8_t> Serializer::Serialize(const application::SaveMemoryPositionResp& response) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, response.presetID);
+    WriteToBuffer(buffer, static_cast<uint8_t>(response.result));
+    return buffer;
+}
+
+std::vector<uint8_t> Serializer::Serialize(const application::OnMemorySaveConfirmData& event) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, event.presetID);
+    WriteToBuffer(buffer, static_cast<uint8_t>(event.saveResult));
+    return buffer;
+}
+
+std::vector<uint8_t> Serializer::Serialize(const application::OnSeatRecallCompleteData& event) {
+    std::vector<uint8_t> buffer;
+    WriteToBuffer(buffer, static_cast<uint8_t>(event.seatID));
+    WriteToBuffer(buffer, event.presetID);
+    WriteToBuffer(buffer, static_cast<uint8_t>(event.result));
+    return buffer;
+}
+
 // ============================================================================
 // 通用响应序列化实现
 // ============================================================================
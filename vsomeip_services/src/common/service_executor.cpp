@@ -0,0 +1,108 @@
+#include "common/service_executor.h"
+#include <algorithm>
+#include <iostream>
+
+namespace body_controller {
+namespace services {
+
+ServiceExecutor::ServiceExecutor(std::string name, size_t thread_count, size_t queue_capacity)
+    : name_(std::move(name))
+    , thread_count_(std::max<size_t>(thread_count, 1))
+    , queue_capacity_(queue_capacity) {
+}
+
+ServiceExecutor::~ServiceExecutor() {
+    Stop();
+}
+
+void ServiceExecutor::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    workers_.reserve(thread_count_);
+    for (size_t i = 0; i < thread_count_; ++i) {
+        workers_.emplace_back(&ServiceExecutor::WorkerLoop, this);
+    }
+    std::cout << "[ServiceExecutor] " << name_ << " started with " << thread_count_ << " worker(s)" << std::endl;
+}
+
+void ServiceExecutor::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+    std::cout << "[ServiceExecutor] " << name_ << " stopped" << std::endl;
+}
+
+bool ServiceExecutor::Post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_ || (queue_capacity_ != 0 && tasks_.size() >= queue_capacity_)) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+    return true;
+}
+
+ServiceExecutor::Stats ServiceExecutor::GetStats() const {
+    Stats stats;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats.threads = workers_.size();
+        stats.queued = tasks_.size();
+    }
+    stats.executed = executed_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ServiceExecutor::WorkerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return !running_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            std::cerr << "[ServiceExecutor] " << name_ << " task error: " << e.what() << std::endl;
+        }
+        executed_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SendBusyResponse(const std::shared_ptr<vsomeip::application>& app,
+                      const std::shared_ptr<vsomeip::message>& request) {
+    if (!app) return;
+
+    auto response = vsomeip::runtime::get()->create_response(request);
+    response->set_message_type(vsomeip::message_type_e::MT_ERROR);
+    response->set_return_code(vsomeip::return_code_e::E_NOT_READY);
+
+    app->send(response);
+}
+
+} // namespace services
+} // namespace body_controller
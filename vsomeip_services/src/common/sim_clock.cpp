@@ -0,0 +1,190 @@
+#include "common/sim_clock.h"
+#include <algorithm>
+#include <iostream>
+
+namespace body_controller {
+namespace services {
+
+namespace {
+
+int64_t ToNs(SimClock::TimePoint time_point) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+}
+
+SimClock::TimePoint FromNs(int64_t ns) {
+    return SimClock::TimePoint(std::chrono::duration_cast<SimClock::Duration>(std::chrono::nanoseconds(ns)));
+}
+
+// 当前线程持有运行中计数的时钟（同一线程同时只会在一个时钟上等待）
+thread_local const SimClock* t_running_clock = nullptr;
+
+} // namespace
+
+SimClock::SimClock(Mode mode)
+    : mode_(mode) {
+    if (mode_ == Mode::VIRTUAL) {
+        real_start_ = std::chrono::steady_clock::now();
+        virtual_start_ns_ = ToNs(real_start_);
+        virtual_now_ns_ = virtual_start_ns_;
+        advance_thread_ = std::thread(&SimClock::AdvanceLoop, this);
+        std::cout << "[SimClock] Virtual time mode" << std::endl;
+    }
+}
+
+SimClock::~SimClock() {
+    if (mode_ != Mode::VIRTUAL) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    advance_cv_.notify_all();
+    if (advance_thread_.joinable()) {
+        advance_thread_.join();
+    }
+
+    const auto real_elapsed = std::chrono::steady_clock::now() - real_start_;
+    std::cout << "[SimClock] Virtual time advanced " << (virtual_now_ns_ - virtual_start_ns_) / 1000000
+              << "ms in " << std::chrono::duration_cast<std::chrono::milliseconds>(real_elapsed).count()
+              << "ms real time (" << advances_ << " steps)" << std::endl;
+}
+
+SimClock::TimePoint SimClock::Now() const {
+    if (mode_ == Mode::REAL_TIME) {
+        return std::chrono::steady_clock::now();
+    }
+    return FromNs(virtual_now_ns_);
+}
+
+bool SimClock::SleepUntil(TimePoint deadline, const std::function<bool()>& cancelled) {
+    if (mode_ == Mode::REAL_TIME) {
+        if (!cancelled) {
+            std::this_thread::sleep_until(deadline);
+            return true;
+        }
+        while (!cancelled()) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return true;
+            }
+            std::this_thread::sleep_until(std::min<TimePoint>(deadline, now + REAL_SLEEP_SLICE));
+        }
+        return false;
+    }
+
+    const int64_t deadline_ns = ToNs(deadline);
+    if (virtual_now_ns_ >= deadline_ns) {
+        return true;
+    }
+
+    PendingDeadline pending(*this, deadline, nullptr);
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (virtual_now_ns_ < deadline_ns) {
+        if (cancelled && cancelled()) {
+            return false;
+        }
+        sleepers_cv_.wait_for(lock, POLL_INTERVAL);
+    }
+    return true;
+}
+
+SimClock::DeadlineMap::iterator SimClock::AddDeadline(TimePoint deadline, std::condition_variable* cv) {
+    DeadlineMap::iterator entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (t_running_clock == this) {
+            t_running_clock = nullptr;
+            --running_;
+        }
+        entry = deadlines_.emplace(deadline, cv);
+        ++generation_;
+    }
+    advance_cv_.notify_one();
+    return entry;
+}
+
+void SimClock::RemoveDeadline(DeadlineMap::iterator entry) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        deadlines_.erase(entry);
+        if (t_running_clock != this) {
+            t_running_clock = this;
+            ++running_;
+        }
+        ++generation_;
+    }
+    advance_cv_.notify_one();
+}
+
+void SimClock::Done() {
+    if (t_running_clock != this) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        t_running_clock = nullptr;
+        --running_;
+        ++generation_;
+    }
+    advance_cv_.notify_one();
+}
+
+void SimClock::Handoff() {
+    if (mode_ != Mode::VIRTUAL) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++running_;
+    ++generation_;
+}
+
+void SimClock::Adopt() {
+    if (mode_ != Mode::VIRTUAL) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (t_running_clock == this) {
+            // 本线程已持有计数，交接来的那份直接归还
+            --running_;
+        } else {
+            t_running_clock = this;
+        }
+        ++generation_;
+    }
+    advance_cv_.notify_one();
+}
+
+void SimClock::AdvanceLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        const uint64_t seen = generation_;
+        auto changed = [this, seen]() { return stopping_ || generation_ != seen; };
+
+        // 有线程仍在运行、没有等待者，或有已到期但尚未醒来的等待者时不前进
+        if (running_ > 0 || deadlines_.empty() || ToNs(deadlines_.begin()->first) <= virtual_now_ns_) {
+            advance_cv_.wait(lock, changed);
+            continue;
+        }
+
+        // 所有线程都已回到等待，再留一个静默窗口给刚收到外部请求的线程
+        if (advance_cv_.wait_for(lock, QUIESCENCE_WINDOW, changed)) {
+            continue;
+        }
+
+        const TimePoint next = deadlines_.begin()->first;
+        virtual_now_ns_ = ToNs(next);
+        ++advances_;
+
+        sleepers_cv_.notify_all();
+        for (auto it = deadlines_.begin(); it != deadlines_.end() && it->first <= next; ++it) {
+            if (it->second) {
+                it->second->notify_all();
+            }
+        }
+    }
+}
+
+} // namespace services
+} // namespace body_controller
@@ -0,0 +1,200 @@
+#include "common/simulation_scenario.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+
+namespace body_controller {
+namespace services {
+
+namespace {
+
+constexpr int64_t NS_PER_MS = 1000000;
+
+// 防止循环嵌套写错时展开出过大的事件表
+constexpr size_t MAX_EVENTS = 10000000;
+
+struct EventKind {
+    const char* name;
+    SimulatedEventType type;
+    uint8_t entity_count;
+};
+
+constexpr EventKind EVENT_KINDS[] = {
+    {"door_lock", SimulatedEventType::DOOR_LOCK,       static_cast<uint8_t>(application::POSITION_COUNT)},
+    {"door",      SimulatedEventType::DOOR_STATE,      static_cast<uint8_t>(application::POSITION_COUNT)},
+    {"window",    SimulatedEventType::WINDOW_POSITION, static_cast<uint8_t>(application::POSITION_COUNT)},
+    {"light",     SimulatedEventType::LIGHT_STATE,     static_cast<uint8_t>(application::LIGHT_TYPE_COUNT)},
+    {"seat",      SimulatedEventType::SEAT_POSITION,   static_cast<uint8_t>(application::POSITION_COUNT)},
+};
+
+/**
+ * @brief 按固定种子把场景描述展开为事件表
+ */
+class ScenarioBuilder {
+public:
+    ScenarioBuilder(uint32_t seed, std::vector<SimulationScenario::Event>& events)
+        : random_(seed), events_(events) {}
+
+    void ExpandList(const nlohmann::json& list, int64_t base_ns) {
+        if (!list.is_array()) {
+            throw std::runtime_error("\"events\" must be an array");
+        }
+        for (const auto& entry : list) {
+            ExpandEntry(entry, base_ns);
+        }
+    }
+
+private:
+    void ExpandEntry(const nlohmann::json& entry, int64_t base_ns) {
+        const int64_t at_ns = base_ns + ReadValue(entry.value("at_ms", nlohmann::json(0))) * NS_PER_MS;
+
+        if (entry.contains("loop")) {
+            const auto& loop = entry["loop"];
+            const int64_t count = ReadValue(loop.at("count"));
+            const int64_t period_ns = ReadValue(loop.at("period_ms")) * NS_PER_MS;
+            if (count < 0 || period_ns < 0) {
+                throw std::runtime_error("loop count and period_ms must not be negative");
+            }
+            for (int64_t i = 0; i < count; ++i) {
+                ExpandList(loop.at("events"), at_ns + i * period_ns);
+            }
+            return;
+        }
+
+        const EventKind& kind = FindKind(entry.at("event").get<std::string>());
+        for (uint8_t id : ReadIds(entry, kind)) {
+            if (entry.contains("ramp")) {
+                ExpandRamp(entry, kind, id, at_ns);
+            } else {
+                Append(entry, kind, id, at_ns, ReadValue(entry.at("value")));
+            }
+        }
+    }
+
+    void ExpandRamp(const nlohmann::json& entry, const EventKind& kind, uint8_t id, int64_t at_ns) {
+        const auto& ramp = entry["ramp"];
+        const int64_t from = ReadValue(ramp.at("from"));
+        const int64_t to = ReadValue(ramp.at("to"));
+        const int64_t duration_ns = ReadValue(ramp.at("duration_ms")) * NS_PER_MS;
+        const int64_t steps = ReadValue(ramp.at("steps"));
+        if (steps <= 0 || duration_ns < 0) {
+            throw std::runtime_error("ramp steps must be positive and duration_ms must not be negative");
+        }
+        // steps段等分，起点和终点都输出
+        for (int64_t i = 0; i <= steps; ++i) {
+            Append(entry, kind, id, at_ns + duration_ns * i / steps, from + (to - from) * i / steps);
+        }
+    }
+
+    void Append(const nlohmann::json& entry, const EventKind& kind, uint8_t id, int64_t at_ns, int64_t value) {
+        if (events_.size() >= MAX_EVENTS) {
+            throw std::runtime_error("scenario expands to more than " + std::to_string(MAX_EVENTS) + " events");
+        }
+        SimulationScenario::Event event;
+        event.offset_ns = at_ns;
+        event.type = kind.type;
+        event.id = id;
+        // 先按宽类型校验再收窄，避免256之类的值回绕成合法的轴
+        const int64_t axis = ReadValue(entry.value("axis", nlohmann::json(0)));
+        if (axis != static_cast<int64_t>(application::SeatAxis::FORWARD_BACKWARD) &&
+            axis != static_cast<int64_t>(application::SeatAxis::RECLINE)) {
+            throw std::runtime_error("axis must be 0 (FORWARD_BACKWARD) or 1 (RECLINE), got " + std::to_string(axis));
+        }
+        event.axis = static_cast<uint8_t>(axis);
+        event.value = static_cast<int32_t>(value);
+        events_.push_back(event);
+    }
+
+    std::vector<uint8_t> ReadIds(const nlohmann::json& entry, const EventKind& kind) {
+        const auto& id = entry.value("id", nlohmann::json(0));
+        std::vector<uint8_t> ids;
+        if (id.is_string() && id.get<std::string>() == "all") {
+            for (uint8_t i = 0; i < kind.entity_count; ++i) {
+                ids.push_back(i);
+            }
+            return ids;
+        }
+        const int64_t value = ReadValue(id);
+        if (value < 0 || value >= kind.entity_count) {
+            throw std::runtime_error(std::string("id out of range for ") + kind.name);
+        }
+        ids.push_back(static_cast<uint8_t>(value));
+        return ids;
+    }
+
+    // 只使用mt19937的原始输出，保证跨平台取值一致
+    int64_t ReadValue(const nlohmann::json& value) {
+        if (value.is_array()) {
+            const int64_t low = value.at(0).get<int64_t>();
+            const int64_t high = value.at(1).get<int64_t>();
+            if (high < low) {
+                throw std::runtime_error("range [min, max] has max < min");
+            }
+            const uint64_t span = static_cast<uint64_t>(high - low) + 1;
+            return low + static_cast<int64_t>(random_() % span);
+        }
+        return value.get<int64_t>();
+    }
+
+    static const EventKind& FindKind(const std::string& name) {
+        for (const auto& kind : EVENT_KINDS) {
+            if (name == kind.name) {
+                return kind;
+            }
+        }
+        throw std::runtime_error("unknown event type \"" + name + "\"");
+    }
+
+    std::mt19937 random_;
+    std::vector<SimulationScenario::Event>& events_;
+};
+
+} // namespace
+
+bool SimulationScenario::LoadFromFile(const std::string& path) {
+    name_.clear();
+    events_.clear();
+    duration_ns_ = 0;
+    repeat_ = 1;
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[SimulationScenario] Cannot open " << path << std::endl;
+        return false;
+    }
+
+    try {
+        const nlohmann::json scenario = nlohmann::json::parse(file);
+        name_ = scenario.value("name", path);
+        repeat_ = scenario.value("repeat", 1u);
+
+        ScenarioBuilder builder(scenario.value("seed", 0u), events_);
+        builder.ExpandList(scenario.at("events"), 0);
+
+        // 同一时刻的事件保持文件中的顺序
+        std::stable_sort(events_.begin(), events_.end(), [](const Event& a, const Event& b) {
+            return a.offset_ns < b.offset_ns;
+        });
+
+        duration_ns_ = events_.empty() ? 0 : events_.back().offset_ns;
+        if (scenario.contains("duration_ms")) {
+            duration_ns_ = std::max(duration_ns_, scenario["duration_ms"].get<int64_t>() * NS_PER_MS);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[SimulationScenario] Failed to load " << path << ": " << e.what() << std::endl;
+        name_.clear();
+        events_.clear();
+        duration_ns_ = 0;
+        return false;
+    }
+
+    std::cout << "[SimulationScenario] Loaded \"" << name_ << "\": " << events_.size() << " event(s) over "
+              << duration_ns_ / NS_PER_MS << "ms, repeat " << repeat_ << std::endl;
+    return true;
+}
+
+} // namespace services
+} // namespace body_controller
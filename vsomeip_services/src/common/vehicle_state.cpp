@@ -0,0 +1,198 @@
+#include "common/vehicle_state.h"
+#include <algorithm>
+
+namespace body_controller {
+namespace services {
+
+namespace {
+
+size_t ToIndex(application::Position id) {
+    return static_cast<size_t>(id);
+}
+
+} // namespace
+
+VehicleState::VehicleState() {
+    for (auto& slot : lock_states_) {
+        slot.value.store(static_cast<uint8_t>(application::LockState::UNLOCKED), std::memory_order_relaxed);
+    }
+    for (auto& slot : door_states_) {
+        slot.value.store(static_cast<uint8_t>(application::DoorState::CLOSED), std::memory_order_relaxed);
+    }
+    for (auto& slot : window_positions_) {
+        slot.value.store(DEFAULT_WINDOW_POSITION, std::memory_order_relaxed);
+    }
+    for (auto& slot : light_states_) {
+        slot.value.store(0, std::memory_order_relaxed);  // 各类灯光OFF均为0
+    }
+    for (auto& slot : seat_positions_) {
+        slot.value.store(PackSeat(SeatPosition{}), std::memory_order_relaxed);
+    }
+}
+
+application::LockState VehicleState::GetLockState(application::Position door_id) const {
+    const size_t index = ToIndex(door_id);
+    if (index >= DOOR_COUNT) {
+        return application::LockState::UNLOCKED;
+    }
+    return static_cast<application::LockState>(lock_states_[index].value.load(std::memory_order_acquire));
+}
+
+void VehicleState::SetLockState(application::Position door_id, application::LockState state) {
+    const size_t index = ToIndex(door_id);
+    if (index < DOOR_COUNT) {
+        lock_states_[index].value.store(static_cast<uint8_t>(state), std::memory_order_release);
+    }
+}
+
+application::LockState VehicleState::ToggleLockState(application::Position door_id) {
+    const size_t index = ToIndex(door_id);
+    if (index >= DOOR_COUNT) {
+        return application::LockState::UNLOCKED;
+    }
+    // LOCKED=0、UNLOCKED=1，异或1即切换
+    const uint8_t previous = lock_states_[index].value.fetch_xor(1, std::memory_order_acq_rel);
+    return static_cast<application::LockState>(previous ^ 1);
+}
+
+application::DoorState VehicleState::GetDoorState(application::Position door_id) const {
+    const size_t index = ToIndex(door_id);
+    if (index >= DOOR_COUNT) {
+        return application::DoorState::CLOSED;
+    }
+    return static_cast<application::DoorState>(door_states_[index].value.load(std::memory_order_acquire));
+}
+
+void VehicleState::SetDoorState(application::Position door_id, application::DoorState state) {
+    const size_t index = ToIndex(door_id);
+    if (index < DOOR_COUNT) {
+        door_states_[index].value.store(static_cast<uint8_t>(state), std::memory_order_release);
+    }
+}
+
+application::DoorState VehicleState::ToggleDoorState(application::Position door_id) {
+    const size_t index = ToIndex(door_id);
+    if (index >= DOOR_COUNT) {
+        return application::DoorState::CLOSED;
+    }
+    // CLOSED=0、OPEN=1，异或1即切换
+    const uint8_t previous = door_states_[index].value.fetch_xor(1, std::memory_order_acq_rel);
+    return static_cast<application::DoorState>(previous ^ 1);
+}
+
+uint8_t VehicleState::GetWindowPosition(application::Position window_id) const {
+    const size_t index = ToIndex(window_id);
+    if (index >= WINDOW_COUNT) {
+        return DEFAULT_WINDOW_POSITION;
+    }
+    return window_positions_[index].value.load(std::memory_order_acquire);
+}
+
+void VehicleState::SetWindowPosition(application::Position window_id, uint8_t position) {
+    const size_t index = ToIndex(window_id);
+    if (index < WINDOW_COUNT) {
+        window_positions_[index].value.store(std::min<uint8_t>(position, 100), std::memory_order_release);
+    }
+}
+
+uint8_t VehicleState::GetLightState(application::LightType light_type) const {
+    const size_t index = static_cast<size_t>(light_type);
+    if (index >= LIGHT_TYPE_COUNT) {
+        return 0;
+    }
+    return light_states_[index].value.load(std::memory_order_acquire);
+}
+
+void VehicleState::SetLightState(application::LightType light_type, uint8_t state) {
+    const size_t index = static_cast<size_t>(light_type);
+    if (index < LIGHT_TYPE_COUNT) {
+        light_states_[index].value.store(state, std::memory_order_release);
+    }
+}
+
+SeatPosition VehicleState::GetSeatPosition(application::Position seat_id) const {
+    const size_t index = ToIndex(seat_id);
+    if (index >= SEAT_COUNT) {
+        return SeatPosition{};
+    }
+    return UnpackSeat(seat_positions_[index].value.load(std::memory_order_acquire));
+}
+
+void VehicleState::SetSeatPosition(application::Position seat_id, const SeatPosition& position) {
+    const size_t index = ToIndex(seat_id);
+    if (index >= SEAT_COUNT) {
+        return;
+    }
+    SeatPosition clamped;
+    clamped.forward_backward_position = ClampAxis(application::SeatAxis::FORWARD_BACKWARD,
+                                                  position.forward_backward_position);
+    clamped.recline_position = ClampAxis(application::SeatAxis::RECLINE, position.recline_position);
+    seat_positions_[index].value.store(PackSeat(clamped), std::memory_order_release);
+}
+
+void VehicleState::SetSeatAxis(application::Position seat_id, application::SeatAxis axis, int32_t value) {
+    const size_t index = ToIndex(seat_id);
+    if (index >= SEAT_COUNT) {
+        return;
+    }
+    const int32_t clamped = ClampAxis(axis, value);
+    auto& slot = seat_positions_[index].value;
+    uint64_t expected = slot.load(std::memory_order_relaxed);
+    while (true) {
+        SeatPosition position = UnpackSeat(expected);
+        if (axis == application::SeatAxis::FORWARD_BACKWARD) {
+            position.forward_backward_position = clamped;
+        } else {
+            position.recline_position = clamped;
+        }
+        if (slot.compare_exchange_weak(expected, PackSeat(position), std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+}
+
+int32_t VehicleState::StepSeatAxis(application::Position seat_id, application::SeatAxis axis,
+                                   application::SeatDirection direction) {
+    const size_t index = ToIndex(seat_id);
+    if (index >= SEAT_COUNT) {
+        return 0;
+    }
+    const bool forward_backward = (axis == application::SeatAxis::FORWARD_BACKWARD);
+    const int32_t step = forward_backward ? FORWARD_BACKWARD_STEP : RECLINE_STEP;
+    const int32_t delta = (direction == application::SeatDirection::POSITIVE) ? step
+                        : (direction == application::SeatDirection::NEGATIVE) ? -step
+                        : 0;
+
+    auto& slot = seat_positions_[index].value;
+    uint64_t expected = slot.load(std::memory_order_relaxed);
+    while (true) {
+        SeatPosition position = UnpackSeat(expected);
+        int32_t& value = forward_backward ? position.forward_backward_position : position.recline_position;
+        value = ClampAxis(axis, value + delta);
+        if (slot.compare_exchange_weak(expected, PackSeat(position), std::memory_order_acq_rel)) {
+            return value;
+        }
+    }
+}
+
+uint64_t VehicleState::PackSeat(const SeatPosition& position) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(position.forward_backward_position)) << 32) |
+           static_cast<uint32_t>(position.recline_position);
+}
+
+SeatPosition VehicleState::UnpackSeat(uint64_t packed) {
+    SeatPosition position;
+    position.forward_backward_position = static_cast<int32_t>(static_cast<uint32_t>(packed >> 32));
+    position.recline_position = static_cast<int32_t>(static_cast<uint32_t>(packed));
+    return position;
+}
+
+int32_t VehicleState::ClampAxis(application::SeatAxis axis, int32_t value) {
+    if (axis == application::SeatAxis::FORWARD_BACKWARD) {
+        return std::clamp(value, FORWARD_BACKWARD_MIN, FORWARD_BACKWARD_MAX);
+    }
+    return std::clamp(value, RECLINE_MIN, RECLINE_MAX);
+}
+
+} // namespace services
+} // namespace body_controller
@@ -1,10 +1,51 @@
 #include <iostream>
 #include <memory>
+#include <array>
+#include <cstdint>
 #include <cstdlib>
+#include <sstream>
+#include <string>
 #include "services/service_manager.h"
 
 using namespace body_controller::services;
 
+void PrintUsage(const char* program_name);
+void PrintVersion();
+
+/**
+ * @brief 解析非负整数参数
+ */
+bool ParseCount(const char* text, size_t& value) {
+    try {
+        size_t consumed = 0;
+        long long parsed = std::stoll(text, &consumed);
+        if (consumed != std::string(text).size() || parsed < 0) {
+            return false;
+        }
+        value = static_cast<size_t>(parsed);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * @brief 解析逗号分隔的非负整数列表（每种模拟事件类型一个值）
+ */
+bool ParseCountList(const char* text, std::array<uint32_t, SIMULATED_EVENT_TYPE_COUNT>& values) {
+    std::stringstream stream(text);
+    std::string item;
+    size_t index = 0;
+    while (std::getline(stream, item, ',')) {
+        size_t value = 0;
+        if (index >= values.size() || !ParseCount(item.c_str(), value) || value > UINT32_MAX) {
+            return false;
+        }
+        values[index++] = static_cast<uint32_t>(value);
+    }
+    return index == values.size();
+}
+
 /**
  * @brief 打印程序启动横幅
  */
@@ -73,6 +114,56 @@ void PrintServiceInfo() {
  * @brief 主函数
  */
 int main(int argc, char* argv[]) {
+    // 解析命令行参数
+    ServiceManagerOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (arg == "-v" || arg == "--version") {
+            PrintVersion();
+            return 0;
+        } else if (arg == "--executor-threads" && i + 1 < argc) {
+            if (!ParseCount(argv[++i], options.executor_threads)) {
+                std::cerr << "[Main] Invalid value for --executor-threads: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (arg == "--executor-queue" && i + 1 < argc) {
+            if (!ParseCount(argv[++i], options.executor_queue_capacity)) {
+                std::cerr << "[Main] Invalid value for --executor-queue: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (arg == "--seat-memory" && i + 1 < argc) {
+            options.seat_memory_file = argv[++i];
+        } else if (arg == "--sim-rate" && i + 1 < argc) {
+            size_t rate = 0;
+            if (!ParseCount(argv[++i], rate) || rate > 1000000) {
+                std::cerr << "[Main] Invalid value for --sim-rate: " << argv[i] << std::endl;
+                return 1;
+            }
+            options.simulation.events_per_second = static_cast<uint32_t>(rate);
+        } else if (arg == "--sim-mix" && i + 1 < argc) {
+            if (!ParseCountList(argv[++i], options.simulation.mix)) {
+                std::cerr << "[Main] Invalid value for --sim-mix: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (arg == "--scenario" && i + 1 < argc) {
+            options.scenario_file = argv[++i];
+        } else if (arg == "--virtual-time") {
+            options.virtual_time = true;
+        } else if (arg == "--sim-burst" && i + 1 < argc) {
+            if (!ParseCountList(argv[++i], options.simulation.burst)) {
+                std::cerr << "[Main] Invalid value for --sim-burst: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else {
+            std::cerr << "[Main] Unknown option: " << arg << std::endl;
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    
     // 打印启动横幅
     PrintBanner();
     
@@ -85,7 +176,7 @@ int main(int argc, char* argv[]) {
     try {
         // 创建服务管理器
         std::cout << "[Main] Creating service manager...\n";
-        auto service_manager = std::make_unique<ServiceManager>();
+        auto service_manager = std::make_unique<ServiceManager>(options);
         
         // 运行服务管理器（阻塞调用）
         std::cout << "[Main] Starting services...\n";
@@ -111,6 +202,16 @@ void PrintUsage(const char* program_name) {
     std::cout << "\nOptions:\n";
     std::cout << "  -h, --help     Show this help message\n";
     std::cout << "  -v, --version  Show version information\n";
+    std::cout << "  --executor-threads N   Worker threads per service executor (default 1, 0 = run on vsomeip dispatcher)\n";
+    std::cout << "  --executor-queue N     Queue capacity per service executor (default 64, 0 = unbounded)\n";
+    std::cout << "  --seat-memory PATH     Seat memory preset file (default seat_memory.dat, \"\" = not persisted)\n";
+    std::cout << "  --sim-rate N           Simulated event triggers per second (default 0 = one event every 15 s)\n";
+    std::cout << "  --sim-mix A,B,C,D,E    Weights of door lock, door state, window, light, seat events (default 1,1,1,1,1)\n";
+    std::cout << "  --sim-burst A,B,C,D,E  Events emitted back-to-back per trigger of each type (default 1,1,1,1,1)\n";
+    std::cout << "  --scenario PATH        Play a scripted simulation scenario instead of random events\n";
+    std::cout << "  --virtual-time         Run simulator, hardware delays and timers on virtual time (CI)\n";
+    std::cout << "\nvsomeip dispatch threads are configured per application in the VSOMEIP configuration\n";
+    std::cout << "(\"threads\", \"max_dispatchers\", \"max_dispatch_time\").\n";
     std::cout << "\nEnvironment Variables:\n";
     std::cout << "  VSOMEIP_CONFIGURATION      Path to VSOMEIP configuration file\n";
     std::cout << "  VSOMEIP_APPLICATION_NAME   Application name for VSOMEIP\n";
@@ -9,20 +9,15 @@ namespace body_controller {
 namespace services {
 
 DoorService::DoorService(std::shared_ptr<vsomeip::application> app, 
-                        std::shared_ptr<HardwareSimulator> simulator)
+                        std::shared_ptr<HardwareSimulator> simulator,
+                         std::shared_ptr<VehicleState> state,
+                         std::shared_ptr<SimClock> clock)
     : app_(app)
     , running_(false)
     , hardware_simulator_(simulator)
+    , state_(state ? std::move(state) : std::make_shared<VehicleState>())
+    , clock_(clock ? std::move(clock) : std::make_shared<SimClock>())
 {
-    // 初始化当前状态
-    for (int i = 0; i < 4; ++i) {
-        current_lock_states_[i] = application::LockState::UNLOCKED;
-        current_door_states_[i] = application::DoorState::CLOSED;
-    }
-
-    // 初始化随机数生成器
-    random_generator_.seed(std::chrono::steady_clock::now().time_since_epoch().count());
-    
     std::cout << "[DoorService] Door service created" << std::endl;
 }
 
@@ -44,27 +39,32 @@ bool DoorService::Initialize() {
         // 注册方法处理器
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, SET_LOCK_STATE_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleSetLockStateRequest(request);
+                DispatchRequest(request, &DoorService::HandleSetLockStateRequest);
             });
             
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, GET_LOCK_STATE_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleGetLockStateRequest(request);
+                DispatchRequest(request, &DoorService::HandleGetLockStateRequest);
             });
         
         // 注册事件
         std::set<vsomeip::eventgroup_t> event_groups;
         event_groups.insert(EVENT_GROUP);
         
-        app_->offer_event(SERVICE_ID, INSTANCE_ID, LOCK_STATE_CHANGED_EVENT, 
-                         event_groups, vsomeip::event_type_e::ET_EVENT, 
-                         std::chrono::milliseconds::zero(),
-                         false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+        lock_state_notifier_ = OfferEvent(LOCK_STATE_CHANGED_EVENT, event_groups);
                          
-        app_->offer_event(SERVICE_ID, INSTANCE_ID, DOOR_STATE_CHANGED_EVENT, 
-                         event_groups, vsomeip::event_type_e::ET_EVENT, 
-                         std::chrono::milliseconds::zero(),
-                         false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+        door_state_notifier_ = OfferEvent(DOOR_STATE_CHANGED_EVENT, event_groups);
+        
+        // 发布字段初始值，新订阅者补发所有条目的当前值
+        PublishInitialValues();
+        app_->register_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP,
+            [this](vsomeip::client_t client, uid_t, gid_t, bool subscribed) {
+                if (subscribed) {
+                    lock_state_notifier_->ScheduleReplay(client);
+                    door_state_notifier_->ScheduleReplay(client);
+                }
+                return true;
+            });
         
         // 设置硬件模拟器回调
         if (hardware_simulator_) {
@@ -98,6 +98,11 @@ bool DoorService::Start() {
     }
     
     running_ = true;
+    
+    // 启动字段周期重发
+    if (lock_state_notifier_) lock_state_notifier_->Start();
+    if (door_state_notifier_) door_state_notifier_->Start();
+    
     std::cout << "[DoorService] Door service started" << std::endl;
     return true;
 }
@@ -109,9 +114,13 @@ void DoorService::Stop() {
     
     running_ = false;
     
+    if (lock_state_notifier_) lock_state_notifier_->Stop();
+    if (door_state_notifier_) door_state_notifier_->Stop();
+    
     if (app_) {
         // 停止提供服务
         app_->stop_offer_service(SERVICE_ID, INSTANCE_ID, MAJOR_VERSION, MINOR_VERSION);
+        app_->unregister_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP);
         
         // 取消注册处理器
         app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, SET_LOCK_STATE_METHOD);
@@ -159,8 +168,9 @@ void DoorService::HandleSetLockStateRequest(const std::shared_ptr<vsomeip::messa
             
             // 延迟触发事件，模拟硬件响应时间
             std::thread([this, req, new_state]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                clock_->SleepFor(std::chrono::milliseconds(100));
                 hardware_simulator_->TriggerDoorLockEvent(req.doorID, new_state);
+                clock_->Done();
             }).detach();
         }
         
@@ -208,6 +218,48 @@ void DoorService::HandleGetLockStateRequest(const std::shared_ptr<vsomeip::messa
     }
 }
 
+std::unique_ptr<FieldNotifier> DoorService::OfferEvent(vsomeip::event_t event_id,
+                                                       const std::set<vsomeip::eventgroup_t>& event_groups) {
+    EventNotificationConfig config = event_config_ ? event_config_->Get(SERVICE_ID, event_id) : EventNotificationConfig{};
+    auto notifier = std::make_unique<FieldNotifier>(app_, SERVICE_ID, INSTANCE_ID, event_id, config, clock_);
+    notifier->Offer(event_groups);
+    return notifier;
+}
+
+void DoorService::PublishInitialValues() {
+    for (size_t i = 0; i < VehicleState::DOOR_COUNT; ++i) {
+        application::Position door_id = static_cast<application::Position>(i);
+        
+        application::OnLockStateChangedData lock_data;
+        lock_data.doorID = door_id;
+        lock_data.newLockState = state_->GetLockState(door_id);
+        lock_state_notifier_->Publish(static_cast<uint32_t>(i), Serializer::Serialize(lock_data));
+        
+        application::OnDoorStateChangedData door_data;
+        door_data.doorID = door_id;
+        door_data.newDoorState = state_->GetDoorState(door_id);
+        door_state_notifier_->Publish(static_cast<uint32_t>(i), Serializer::Serialize(door_data));
+    }
+}
+
+void DoorService::DispatchRequest(const std::shared_ptr<vsomeip::message>& request,
+                                  void (DoorService::*handler)(const std::shared_ptr<vsomeip::message>&)) {
+    // 处理中可能在时钟上睡眠，处理完不再阻止虚拟时间前进
+    if (!executor_) {
+        (this->*handler)(request);
+        clock_->Done();
+        return;
+    }
+    
+    if (!executor_->Post([this, request, handler]() {
+            (this->*handler)(request);
+            clock_->Done();
+        })) {
+        std::cerr << "[DoorService] Executor queue full, rejecting request" << std::endl;
+        SendBusyResponse(app_, request);
+    }
+}
+
 void DoorService::SendResponse(const std::shared_ptr<vsomeip::message>& request,
                               const std::vector<uint8_t>& payload) {
     if (!app_) return;
@@ -237,9 +289,6 @@ void DoorService::OnDoorLockStateChanged(const application::OnLockStateChangedDa
               << static_cast<int>(event_data.doorID) << " -> " 
               << (event_data.newLockState == application::LockState::LOCKED ? "LOCKED" : "UNLOCKED") << std::endl;
     
-    // 更新内部状态
-    current_lock_states_[static_cast<int>(event_data.doorID)] = event_data.newLockState;
-    
     // 发送事件到客户端
     SendLockStateChangedEvent(event_data);
 }
@@ -249,41 +298,34 @@ void DoorService::OnDoorStateChanged(const application::OnDoorStateChangedData&
               << static_cast<int>(event_data.doorID) << " -> " 
               << (event_data.newDoorState == application::DoorState::OPEN ? "OPEN" : "CLOSED") << std::endl;
     
-    // 更新内部状态
-    current_door_states_[static_cast<int>(event_data.doorID)] = event_data.newDoorState;
-    
     // 发送事件到客户端
     SendDoorStateChangedEvent(event_data);
 }
 
 void DoorService::SendLockStateChangedEvent(const application::OnLockStateChangedData& event_data) {
-    if (!app_) return;
-    
-    auto event_payload = Serializer::Serialize(event_data);
-    auto payload = vsomeip::runtime::get()->create_payload();
-    payload->set_data(event_payload.data(), static_cast<uint32_t>(event_payload.size()));
+    if (!lock_state_notifier_) return;
     
-    app_->notify(SERVICE_ID, INSTANCE_ID, LOCK_STATE_CHANGED_EVENT, payload);
-    
-    std::cout << "[DoorService] Sent lock state changed event to clients" << std::endl;
+    if (lock_state_notifier_->Publish(static_cast<uint32_t>(event_data.doorID), Serializer::Serialize(event_data))) {
+        std::cout << "[DoorService] Sent lock state changed event to clients" << std::endl;
+    } else {
+        std::cout << "[DoorService] Lock state changed event unchanged, notification suppressed" << std::endl;
+    }
 }
 
 void DoorService::SendDoorStateChangedEvent(const application::OnDoorStateChangedData& event_data) {
-    if (!app_) return;
-    
-    auto event_payload = Serializer::Serialize(event_data);
-    auto payload = vsomeip::runtime::get()->create_payload();
-    payload->set_data(event_payload.data(), static_cast<uint32_t>(event_payload.size()));
-    
-    app_->notify(SERVICE_ID, INSTANCE_ID, DOOR_STATE_CHANGED_EVENT, payload);
+    if (!door_state_notifier_) return;
     
-    std::cout << "[DoorService] Sent door state changed event to clients" << std::endl;
+    if (door_state_notifier_->Publish(static_cast<uint32_t>(event_data.doorID), Serializer::Serialize(event_data))) {
+        std::cout << "[DoorService] Sent door state changed event to clients" << std::endl;
+    } else {
+        std::cout << "[DoorService] Door state changed event unchanged, notification suppressed" << std::endl;
+    }
 }
 
 application::Result DoorService::SimulateLockOperation(application::Position door_id, 
                                                       application::LockCommand command) {
     // 模拟操作延迟
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    clock_->SleepFor(std::chrono::milliseconds(50));
     
     // 简单的成功模拟（实际硬件可能会有失败情况）
     int door_index = static_cast<int>(door_id);
@@ -291,8 +333,9 @@ application::Result DoorService::SimulateLockOperation(application::Position doo
         return application::Result::FAIL;
     }
     
-    // 模拟操作成功率（95%成功率）
-    if ((random_generator_() % 100) < 95) {
+    // 模拟操作成功率（95%成功率），各分发线程使用独立的生成器
+    thread_local std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
+    if ((gen() % 100) < 95) {
         return application::Result::SUCCESS;
     } else {
         std::cout << "[DoorService] Simulated lock operation failure" << std::endl;
@@ -301,11 +344,7 @@ application::Result DoorService::SimulateLockOperation(application::Position doo
 }
 
 application::LockState DoorService::GetCurrentLockState(application::Position door_id) const {
-    int door_index = static_cast<int>(door_id);
-    if (door_index >= 0 && door_index < 4) {
-        return current_lock_states_[door_index];
-    }
-    return application::LockState::UNLOCKED;
+    return state_->GetLockState(door_id);
 }
 
 } // namespace services
@@ -9,13 +9,14 @@ namespace body_controller {
 namespace services {
 
 LightService::LightService(std::shared_ptr<vsomeip::application> app, 
-                          std::shared_ptr<HardwareSimulator> simulator)
+                          std::shared_ptr<HardwareSimulator> simulator,
+                           std::shared_ptr<VehicleState> state,
+                           std::shared_ptr<SimClock> clock)
     : app_(app)
     , running_(false)
     , hardware_simulator_(simulator)
-    , current_headlight_state_(application::HeadlightState::OFF)
-    , current_indicator_state_(application::IndicatorState::OFF)
-    , current_position_light_state_(application::PositionLightState::OFF)
+    , state_(state ? std::move(state) : std::make_shared<VehicleState>())
+    , clock_(clock ? std::move(clock) : std::make_shared<SimClock>())
 {
     std::cout << "[LightService] Light service created" << std::endl;
 }
@@ -38,27 +39,39 @@ bool LightService::Initialize() {
         // 注册方法处理器
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, SET_HEADLIGHT_STATE_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleSetHeadlightStateRequest(request);
+                DispatchRequest(request, &LightService::HandleSetHeadlightStateRequest);
             });
             
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, SET_INDICATOR_STATE_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleSetIndicatorStateRequest(request);
+                DispatchRequest(request, &LightService::HandleSetIndicatorStateRequest);
             });
             
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, SET_POSITION_LIGHT_STATE_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleSetPositionLightStateRequest(request);
+                DispatchRequest(request, &LightService::HandleSetPositionLightStateRequest);
+            });
+            
+        app_->register_message_handler(SERVICE_ID, INSTANCE_ID, GET_LIGHT_STATE_METHOD,
+            [this](const std::shared_ptr<vsomeip::message>& request) {
+                DispatchRequest(request, &LightService::HandleGetLightStateRequest);
             });
         
         // 注册事件
         std::set<vsomeip::eventgroup_t> event_groups;
         event_groups.insert(EVENT_GROUP);
         
-        app_->offer_event(SERVICE_ID, INSTANCE_ID, LIGHT_STATE_CHANGED_EVENT, 
-                         event_groups, vsomeip::event_type_e::ET_EVENT, 
-                         std::chrono::milliseconds::zero(),
-                         false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+        light_state_notifier_ = OfferEvent(LIGHT_STATE_CHANGED_EVENT, event_groups);
+        
+        // 发布字段初始值，新订阅者补发所有条目的当前值
+        PublishInitialValues();
+        app_->register_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP,
+            [this](vsomeip::client_t client, uid_t, gid_t, bool subscribed) {
+                if (subscribed) {
+                    light_state_notifier_->ScheduleReplay(client);
+                }
+                return true;
+            });
         
         // 设置硬件模拟器回调
         if (hardware_simulator_) {
@@ -87,6 +100,10 @@ bool LightService::Start() {
     }
     
     running_ = true;
+    
+    // 启动字段周期重发
+    if (light_state_notifier_) light_state_notifier_->Start();
+    
     std::cout << "[LightService] Light service started" << std::endl;
     return true;
 }
@@ -98,14 +115,18 @@ void LightService::Stop() {
     
     running_ = false;
     
+    if (light_state_notifier_) light_state_notifier_->Stop();
+    
     if (app_) {
         // 停止提供服务
         app_->stop_offer_service(SERVICE_ID, INSTANCE_ID, MAJOR_VERSION, MINOR_VERSION);
+        app_->unregister_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP);
         
         // 取消注册处理器
         app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, SET_HEADLIGHT_STATE_METHOD);
         app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, SET_INDICATOR_STATE_METHOD);
         app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, SET_POSITION_LIGHT_STATE_METHOD);
+        app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, GET_LIGHT_STATE_METHOD);
     }
     
     std::cout << "[LightService] Light service stopped" << std::endl;
@@ -147,9 +168,10 @@ void LightService::HandleSetHeadlightStateRequest(const std::shared_ptr<vsomeip:
         // 如果操作成功，触发硬件事件
         if (result == application::Result::SUCCESS && hardware_simulator_) {
             std::thread([this, req]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                clock_->SleepFor(std::chrono::milliseconds(100));
                 hardware_simulator_->TriggerLightStateEvent(application::LightType::HEADLIGHT,
                                                           static_cast<uint8_t>(req.command));
+                clock_->Done();
             }).detach();
         }
         
@@ -175,8 +197,9 @@ void LightService::HandleSetIndicatorStateRequest(const std::shared_ptr<vsomeip:
         // 触发硬件事件（模拟转向灯状态变化）
         if (hardware_simulator_) {
             std::thread([this]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                clock_->SleepFor(std::chrono::milliseconds(100));
                 hardware_simulator_->TriggerLightStateEvent(application::LightType::INDICATOR, 1);
+                clock_->Done();
             }).detach();
         }
         
@@ -197,8 +220,9 @@ void LightService::HandleSetPositionLightStateRequest(const std::shared_ptr<vsom
         // 触发硬件事件
         if (hardware_simulator_) {
             std::thread([this]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                clock_->SleepFor(std::chrono::milliseconds(100));
                 hardware_simulator_->TriggerLightStateEvent(application::LightType::POSITION_LIGHT, 1);
+                clock_->Done();
             }).detach();
         }
         
@@ -208,6 +232,74 @@ void LightService::HandleSetPositionLightStateRequest(const std::shared_ptr<vsom
     }
 }
 
+void LightService::HandleGetLightStateRequest(const std::shared_ptr<vsomeip::message>& request) {
+    std::cout << "[LightService] Received GetLightState request" << std::endl;
+    
+    try {
+        // 反序列化请求数据
+        auto payload = request->get_payload();
+        std::vector<uint8_t> data(payload->get_data(), payload->get_data() + payload->get_length());
+        
+        application::GetLightStateReq req;
+        if (!Serializer::Deserialize(data, req) ||
+            static_cast<size_t>(req.lightType) >= VehicleState::LIGHT_TYPE_COUNT) {
+            std::cerr << "[LightService] Invalid GetLightState request" << std::endl;
+            SendErrorResponse(request, 1);
+            return;
+        }
+        
+        // 创建响应
+        application::GetLightStateResp response;
+        response.lightType = req.lightType;
+        response.state = state_->GetLightState(req.lightType);
+        
+        // 序列化并发送响应
+        SendResponse(request, Serializer::Serialize(response));
+        
+        std::cout << "[LightService] GetLightState response - Type: " << static_cast<int>(response.lightType)
+                  << " State: " << static_cast<int>(response.state) << std::endl;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "[LightService] Error handling GetLightState request: " << e.what() << std::endl;
+        SendErrorResponse(request, 2);
+    }
+}
+
+std::unique_ptr<FieldNotifier> LightService::OfferEvent(vsomeip::event_t event_id,
+                                                        const std::set<vsomeip::eventgroup_t>& event_groups) {
+    EventNotificationConfig config = event_config_ ? event_config_->Get(SERVICE_ID, event_id) : EventNotificationConfig{};
+    auto notifier = std::make_unique<FieldNotifier>(app_, SERVICE_ID, INSTANCE_ID, event_id, config, clock_);
+    notifier->Offer(event_groups);
+    return notifier;
+}
+
+void LightService::PublishInitialValues() {
+    for (size_t i = 0; i < VehicleState::LIGHT_TYPE_COUNT; ++i) {
+        application::OnLightStateChangedData event_data;
+        event_data.lightType = static_cast<application::LightType>(i);
+        event_data.newState = state_->GetLightState(event_data.lightType);
+        light_state_notifier_->Publish(static_cast<uint32_t>(i), Serializer::Serialize(event_data));
+    }
+}
+
+void LightService::DispatchRequest(const std::shared_ptr<vsomeip::message>& request,
+                                   void (LightService::*handler)(const std::shared_ptr<vsomeip::message>&)) {
+    // 处理中可能在时钟上睡眠，处理完不再阻止虚拟时间前进
+    if (!executor_) {
+        (this->*handler)(request);
+        clock_->Done();
+        return;
+    }
+    
+    if (!executor_->Post([this, request, handler]() {
+            (this->*handler)(request);
+            clock_->Done();
+        })) {
+        std::cerr << "[LightService] Executor queue full, rejecting request" << std::endl;
+        SendBusyResponse(app_, request);
+    }
+}
+
 void LightService::SendResponse(const std::shared_ptr<vsomeip::message>& request,
                                const std::vector<uint8_t>& payload) {
     if (!app_) return;
@@ -236,40 +328,25 @@ void LightService::OnLightStateChanged(const application::OnLightStateChangedDat
               << static_cast<int>(event_data.lightType) << " -> "
               << static_cast<int>(event_data.newState) << std::endl;
 
-    // 更新内部状态
-    switch (event_data.lightType) {
-        case application::LightType::HEADLIGHT:
-            current_headlight_state_ = static_cast<application::HeadlightState>(event_data.newState);
-            break;
-        case application::LightType::INDICATOR:
-            current_indicator_state_ = static_cast<application::IndicatorState>(event_data.newState);
-            break;
-        case application::LightType::POSITION_LIGHT:
-            current_position_light_state_ = static_cast<application::PositionLightState>(event_data.newState);
-            break;
-    }
-
     // 发送事件到客户端
     SendLightStateChangedEvent(event_data);
 }
 
 void LightService::SendLightStateChangedEvent(const application::OnLightStateChangedData& event_data) {
-    if (!app_) return;
-
-    auto event_payload = Serializer::Serialize(event_data);
-    auto payload = vsomeip::runtime::get()->create_payload();
-    payload->set_data(event_payload.data(), static_cast<uint32_t>(event_payload.size()));
-
-    app_->notify(SERVICE_ID, INSTANCE_ID, LIGHT_STATE_CHANGED_EVENT, payload);
-
-    std::cout << "[LightService] Sent light state changed event to clients" << std::endl;
+    if (!light_state_notifier_) return;
+    
+    if (light_state_notifier_->Publish(static_cast<uint32_t>(event_data.lightType), Serializer::Serialize(event_data))) {
+        std::cout << "[LightService] Sent light state changed event to clients" << std::endl;
+    } else {
+        std::cout << "[LightService] Light state changed event unchanged, notification suppressed" << std::endl;
+    }
 }
 
 application::Result LightService::SimulateHeadlightOperation(application::HeadlightState state) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    clock_->SleepFor(std::chrono::milliseconds(50));
 
     // 模拟95%成功率
-    static std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
+    thread_local std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
     if ((gen() % 100) < 95) {
         return application::Result::SUCCESS;
     } else {
@@ -279,10 +356,10 @@ application::Result LightService::SimulateHeadlightOperation(application::Headli
 }
 
 application::Result LightService::SimulateIndicatorOperation(application::IndicatorState state) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    clock_->SleepFor(std::chrono::milliseconds(50));
 
     // 模拟95%成功率
-    static std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
+    thread_local std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
     if ((gen() % 100) < 95) {
         return application::Result::SUCCESS;
     } else {
@@ -292,10 +369,10 @@ application::Result LightService::SimulateIndicatorOperation(application::Indica
 }
 
 application::Result LightService::SimulatePositionLightOperation(application::PositionLightState state) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    clock_->SleepFor(std::chrono::milliseconds(50));
 
     // 模拟95%成功率
-    static std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
+    thread_local std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
     if ((gen() % 100) < 95) {
         return application::Result::SUCCESS;
     } else {
@@ -8,21 +8,32 @@
 namespace body_controller {
 namespace services {
 
+namespace {
+
+// 位置字段按（座椅，轴）缓存，各座椅的值互不覆盖
+uint32_t PositionKey(application::Position seat_id, application::SeatAxis axis) {
+    return (static_cast<uint32_t>(seat_id) << 8) | static_cast<uint32_t>(axis);
+}
+
+} // namespace
+
 SeatService::SeatService(std::shared_ptr<vsomeip::application> app, 
-                        std::shared_ptr<HardwareSimulator> simulator)
+                        std::shared_ptr<HardwareSimulator> simulator,
+                         std::shared_ptr<VehicleState> state,
+                         std::shared_ptr<SimClock> clock)
     : app_(app)
     , running_(false)
     , hardware_simulator_(simulator)
+    , state_(state ? std::move(state) : std::make_shared<VehicleState>())
+    , clock_(clock ? std::move(clock) : std::make_shared<SimClock>())
+    , recall_engine_(std::make_unique<SeatRecallEngine>(state_, RECALL_STEP_INTERVAL, clock_))
 {
-    // 初始化当前位置
-    for (int i = 0; i < 4; ++i) {
-        current_positions_[i] = {0, 45}; // 默认位置：前后0，靠背45度
-        
-        // 初始化记忆位置
-        for (int j = 0; j < 3; ++j) {
-            memory_positions_[i][j] = {0, 45}; // 默认记忆位置
-        }
-    }
+    recall_engine_->SetProgressCallback([this](const application::OnSeatPositionChangedData& event) {
+        OnSeatPositionChanged(event);
+    });
+    recall_engine_->SetCompleteCallback([this](const application::OnSeatRecallCompleteData& event) {
+        SendRecallCompleteEvent(event);
+    });
     
     std::cout << "[SeatService] Seat service created" << std::endl;
 }
@@ -38,6 +49,11 @@ bool SeatService::Initialize() {
         return false;
     }
     
+    if (!memory_store_) {
+        memory_store_ = std::make_shared<SeatMemoryStore>();
+        memory_store_->Open("");
+    }
+    
     try {
         // 注册服务
         app_->offer_service(SERVICE_ID, INSTANCE_ID, MAJOR_VERSION, MINOR_VERSION);
@@ -45,32 +61,40 @@ bool SeatService::Initialize() {
         // 注册方法处理器
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, ADJUST_SEAT_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleAdjustSeatRequest(request);
+                DispatchRequest(request, &SeatService::HandleAdjustSeatRequest);
             });
             
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, RECALL_MEMORY_POSITION_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleRecallMemoryPositionRequest(request);
+                DispatchRequest(request, &SeatService::HandleRecallMemoryPositionRequest);
             });
             
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, SAVE_MEMORY_POSITION_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleSaveMemoryPositionRequest(request);
+                DispatchRequest(request, &SeatService::HandleSaveMemoryPositionRequest);
             });
         
         // 注册事件
         std::set<vsomeip::eventgroup_t> event_groups;
         event_groups.insert(EVENT_GROUP);
         
-        app_->offer_event(SERVICE_ID, INSTANCE_ID, SEAT_POSITION_CHANGED_EVENT, 
-                         event_groups, vsomeip::event_type_e::ET_EVENT, 
-                         std::chrono::milliseconds::zero(),
-                         false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+        position_notifier_ = OfferEvent(SEAT_POSITION_CHANGED_EVENT, event_groups);
                          
-        app_->offer_event(SERVICE_ID, INSTANCE_ID, MEMORY_SAVE_CONFIRM_EVENT, 
-                         event_groups, vsomeip::event_type_e::ET_EVENT, 
-                         std::chrono::milliseconds::zero(),
-                         false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+        memory_save_notifier_ = OfferEvent(MEMORY_SAVE_CONFIRM_EVENT, event_groups);
+        
+        recall_complete_notifier_ = OfferEvent(RECALL_COMPLETE_EVENT, event_groups);
+        
+        // 发布字段初始值，新订阅者补发所有条目的当前值
+        PublishInitialValues();
+        app_->register_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP,
+            [this](vsomeip::client_t client, uid_t, gid_t, bool subscribed) {
+                if (subscribed) {
+                    position_notifier_->ScheduleReplay(client);
+                    memory_save_notifier_->ScheduleReplay(client);
+                    recall_complete_notifier_->ScheduleReplay(client);
+                }
+                return true;
+            });
         
         // 设置硬件模拟器回调
         if (hardware_simulator_) {
@@ -99,6 +123,14 @@ bool SeatService::Start() {
     }
     
     running_ = true;
+    
+    // 启动字段周期重发
+    if (position_notifier_) position_notifier_->Start();
+    if (memory_save_notifier_) memory_save_notifier_->Start();
+    if (recall_complete_notifier_) recall_complete_notifier_->Start();
+    
+    recall_engine_->Start();
+    
     std::cout << "[SeatService] Seat service started" << std::endl;
     return true;
 }
@@ -110,9 +142,17 @@ void SeatService::Stop() {
     
     running_ = false;
     
+    // 停止进行中的记忆位置恢复
+    recall_engine_->Stop();
+    
+    if (position_notifier_) position_notifier_->Stop();
+    if (memory_save_notifier_) memory_save_notifier_->Stop();
+    if (recall_complete_notifier_) recall_complete_notifier_->Stop();
+    
     if (app_) {
         // 停止提供服务
         app_->stop_offer_service(SERVICE_ID, INSTANCE_ID, MAJOR_VERSION, MINOR_VERSION);
+        app_->unregister_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP);
         
         // 取消注册处理器
         app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, ADJUST_SEAT_METHOD);
@@ -146,11 +186,14 @@ void SeatService::HandleAdjustSeatRequest(const std::shared_ptr<vsomeip::message
             case application::SeatDirection::STOP: direction_str = "STOP"; break;
         }
         
-        std::cout << "[SeatService] AdjustSeat - Axis: " << axis_str
-                  << " Direction: " << direction_str << std::endl;
+        std::cout << "[SeatService] AdjustSeat - Seat: " << static_cast<int>(req.seatID)
+                  << " Axis: " << axis_str << " Direction: " << direction_str << std::endl;
+        
+        // 手动调节打断该座椅正在进行的记忆位置恢复，其他座椅不受影响
+        recall_engine_->Cancel(req.seatID);
 
-        // 模拟座椅调节操作（使用默认座椅ID）
-        application::Result result = SimulateAdjustOperation(application::Position::FRONT_LEFT, req.axis, req.direction);
+        // 模拟座椅调节操作（座椅ID越界时失败）
+        application::Result result = SimulateAdjustOperation(req.seatID, req.axis, req.direction);
         
         // 创建响应
         auto response_data = (result == application::Result::SUCCESS)
@@ -163,37 +206,20 @@ void SeatService::HandleAdjustSeatRequest(const std::shared_ptr<vsomeip::message
             req.direction != application::SeatDirection::STOP) {
             
             std::thread([this, req]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(500)); // 座椅调节需要时间
-                
-                // 计算新位置（使用默认座椅索引）
-                int seat_index = 0; // 简化实现，使用第一个座椅
-                int new_position;
+                clock_->SleepFor(std::chrono::milliseconds(500)); // 座椅调节需要时间
                 
-                if (req.axis == application::SeatAxis::FORWARD_BACKWARD) {
-                    new_position = current_positions_[seat_index].forward_backward_position;
-                    if (req.direction == application::SeatDirection::POSITIVE) {
-                        new_position = std::min(100, new_position + 10);
-                    } else {
-                        new_position = std::max(-100, new_position - 10);
-                    }
-                    current_positions_[seat_index].forward_backward_position = new_position;
-                } else {
-                    new_position = current_positions_[seat_index].recline_position;
-                    if (req.direction == application::SeatDirection::POSITIVE) {
-                        new_position = std::min(90, new_position + 5);
-                    } else {
-                        new_position = std::max(0, new_position - 5);
-                    }
-                    current_positions_[seat_index].recline_position = new_position;
-                }
+                // 原子地步进目标座椅的共享状态，并发的调节请求不会丢失更新
+                int new_position = state_->StepSeatAxis(req.seatID, req.axis, req.direction);
                 
                 // 触发位置变化事件
                 application::OnSeatPositionChangedData event_data;
                 event_data.axis = req.axis;
                 event_data.newPosition = new_position;
+                event_data.seatID = req.seatID;
                 
                 // 直接调用硬件模拟器的回调
                 OnSeatPositionChanged(event_data);
+                clock_->Done();
             }).detach();
         }
         
@@ -207,11 +233,40 @@ void SeatService::HandleRecallMemoryPositionRequest(const std::shared_ptr<vsomei
     std::cout << "[SeatService] Received RecallMemoryPosition request" << std::endl;
     
     try {
-        // 创建成功响应（简化实现）
-        auto response_data = Serializer::SerializeSuccessResponse();
-        SendResponse(request, response_data);
+        // 反序列化请求数据
+        auto payload = request->get_payload();
+        std::vector<uint8_t> data(payload->get_data(), payload->get_data() + payload->get_length());
+        
+        application::RecallMemoryPositionReq req;
+        if (!Serializer::Deserialize(data, req)) {
+            std::cerr << "[SeatService] Failed to deserialize RecallMemoryPosition request" << std::endl;
+            SendErrorResponse(request, 1);
+            return;
+        }
+        
+        const application::Position seat_id = req.seatID;
+        SeatPosition target;
+        const bool found = memory_store_->Load(seat_id, req.userID, req.presetID, target);
+        
+        application::RecallMemoryPositionResp response;
+        response.presetID = req.presetID;
+        response.result = found ? application::Result::SUCCESS : application::Result::FAIL;
+        SendResponse(request, Serializer::Serialize(response));
+        
+        if (!found) {
+            std::cout << "[SeatService] RecallMemoryPosition - No preset " << static_cast<int>(req.presetID)
+                      << " stored for seat " << static_cast<int>(seat_id)
+                      << " user " << static_cast<int>(req.userID) << std::endl;
+            return;
+        }
         
-        std::cout << "[SeatService] RecallMemoryPosition completed" << std::endl;
+        std::cout << "[SeatService] RecallMemoryPosition - Seat " << static_cast<int>(seat_id)
+                  << " Preset " << static_cast<int>(req.presetID)
+                  << " User " << static_cast<int>(req.userID)
+                  << " -> FB: " << target.forward_backward_position
+                  << " Recline: " << target.recline_position << std::endl;
+        // 各轴同时运动，到达后由恢复完成事件通知，客户端无需轮询
+        recall_engine_->Recall(seat_id, req.presetID, target);
         
     } catch (const std::exception& e) {
         std::cerr << "[SeatService] Error handling RecallMemoryPosition request: " << e.what() << std::endl;
@@ -223,24 +278,37 @@ void SeatService::HandleSaveMemoryPositionRequest(const std::shared_ptr<vsomeip:
     std::cout << "[SeatService] Received SaveMemoryPosition request" << std::endl;
     
     try {
-        // 创建成功响应
-        auto response_data = Serializer::SerializeSuccessResponse();
-        SendResponse(request, response_data);
+        // 反序列化请求数据
+        auto payload = request->get_payload();
+        std::vector<uint8_t> data(payload->get_data(), payload->get_data() + payload->get_length());
         
-        // 触发记忆保存确认事件
-        if (hardware_simulator_) {
-            std::thread([this]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                
-                application::OnMemorySaveConfirmData event_data;
-                event_data.presetID = 1; // 简化实现
-                event_data.saveResult = application::Result::SUCCESS;
-                
-                SendMemorySaveConfirmEvent(event_data);
-            }).detach();
+        application::SaveMemoryPositionReq req;
+        if (!Serializer::Deserialize(data, req)) {
+            std::cerr << "[SeatService] Failed to deserialize SaveMemoryPosition request" << std::endl;
+            SendErrorResponse(request, 1);
+            return;
         }
         
-        std::cout << "[SeatService] SaveMemoryPosition completed" << std::endl;
+        // 保存目标座椅的当前位置（座椅ID越界时存储拒绝写入）
+        const application::Position seat_id = req.seatID;
+        const SeatPosition position = state_->GetSeatPosition(seat_id);
+        const bool saved = memory_store_->Save(seat_id, req.userID, req.presetID, position);
+        
+        application::SaveMemoryPositionResp response;
+        response.presetID = req.presetID;
+        response.result = saved ? application::Result::SUCCESS : application::Result::FAIL;
+        SendResponse(request, Serializer::Serialize(response));
+        
+        // 触发记忆保存确认事件
+        application::OnMemorySaveConfirmData event_data;
+        event_data.presetID = req.presetID;
+        event_data.saveResult = response.result;
+        SendMemorySaveConfirmEvent(event_data);
+        
+        std::cout << "[SeatService] SaveMemoryPosition - Seat " << static_cast<int>(seat_id)
+                  << " Preset " << static_cast<int>(req.presetID)
+                  << " User " << static_cast<int>(req.userID)
+                  << (saved ? " saved" : " rejected") << std::endl;
         
     } catch (const std::exception& e) {
         std::cerr << "[SeatService] Error handling SaveMemoryPosition request: " << e.what() << std::endl;
@@ -248,6 +316,47 @@ void SeatService::HandleSaveMemoryPositionRequest(const std::shared_ptr<vsomeip:
     }
 }
 
+std::unique_ptr<FieldNotifier> SeatService::OfferEvent(vsomeip::event_t event_id,
+                                                       const std::set<vsomeip::eventgroup_t>& event_groups) {
+    EventNotificationConfig config = event_config_ ? event_config_->Get(SERVICE_ID, event_id) : EventNotificationConfig{};
+    auto notifier = std::make_unique<FieldNotifier>(app_, SERVICE_ID, INSTANCE_ID, event_id, config, clock_);
+    notifier->Offer(event_groups);
+    return notifier;
+}
+
+void SeatService::PublishInitialValues() {
+    for (size_t i = 0; i < VehicleState::SEAT_COUNT; ++i) {
+        const auto seat_id = static_cast<application::Position>(i);
+        const SeatPosition position = state_->GetSeatPosition(seat_id);
+        
+        application::OnSeatPositionChangedData forward_backward(application::SeatAxis::FORWARD_BACKWARD,
+                                                                position.forward_backward_position, seat_id);
+        position_notifier_->Publish(PositionKey(seat_id, forward_backward.axis), Serializer::Serialize(forward_backward));
+        
+        application::OnSeatPositionChangedData recline(application::SeatAxis::RECLINE,
+                                                       position.recline_position, seat_id);
+        position_notifier_->Publish(PositionKey(seat_id, recline.axis), Serializer::Serialize(recline));
+    }
+}
+
+void SeatService::DispatchRequest(const std::shared_ptr<vsomeip::message>& request,
+                                  void (SeatService::*handler)(const std::shared_ptr<vsomeip::message>&)) {
+    // 处理中可能在时钟上睡眠，处理完不再阻止虚拟时间前进
+    if (!executor_) {
+        (this->*handler)(request);
+        clock_->Done();
+        return;
+    }
+    
+    if (!executor_->Post([this, request, handler]() {
+            (this->*handler)(request);
+            clock_->Done();
+        })) {
+        std::cerr << "[SeatService] Executor queue full, rejecting request" << std::endl;
+        SendBusyResponse(app_, request);
+    }
+}
+
 void SeatService::SendResponse(const std::shared_ptr<vsomeip::message>& request,
                               const std::vector<uint8_t>& payload) {
     if (!app_) return;
@@ -272,64 +381,55 @@ void SeatService::SendErrorResponse(const std::shared_ptr<vsomeip::message>& req
 }
 
 void SeatService::OnSeatPositionChanged(const application::OnSeatPositionChangedData& event_data) {
-    std::cout << "[SeatService] Hardware event - Seat position changed: Axis "
+    std::cout << "[SeatService] Hardware event - Seat position changed: Seat "
+              << static_cast<int>(event_data.seatID) << " Axis "
               << static_cast<int>(event_data.axis) << " -> "
               << event_data.newPosition << std::endl;
 
-    // 更新内部状态（使用默认座椅索引）
-    int seat_index = 0;
-    if (seat_index >= 0 && seat_index < 4) {
-        if (event_data.axis == application::SeatAxis::FORWARD_BACKWARD) {
-            current_positions_[seat_index].forward_backward_position = event_data.newPosition;
-        } else {
-            current_positions_[seat_index].recline_position = event_data.newPosition;
-        }
-    }
-
     // 发送事件到客户端
     SendSeatPositionChangedEvent(event_data);
 }
 
 void SeatService::SendSeatPositionChangedEvent(const application::OnSeatPositionChangedData& event_data) {
-    if (!app_) return;
-
-    auto event_payload = Serializer::Serialize(event_data);
-    auto payload = vsomeip::runtime::get()->create_payload();
-    payload->set_data(event_payload.data(), static_cast<uint32_t>(event_payload.size()));
+    if (!position_notifier_) return;
 
-    app_->notify(SERVICE_ID, INSTANCE_ID, SEAT_POSITION_CHANGED_EVENT, payload);
-
-    std::cout << "[SeatService] Sent seat position changed event to clients" << std::endl;
+    if (position_notifier_->Publish(PositionKey(event_data.seatID, event_data.axis), Serializer::Serialize(event_data))) {
+        std::cout << "[SeatService] Sent seat position changed event to clients" << std::endl;
+    } else {
+        std::cout << "[SeatService] Seat position changed event unchanged, notification suppressed" << std::endl;
+    }
 }
 
 void SeatService::SendMemorySaveConfirmEvent(const application::OnMemorySaveConfirmData& event_data) {
-    if (!app_) return;
+    if (!memory_save_notifier_) return;
 
-    // 简化的记忆保存确认事件序列化
-    std::vector<uint8_t> event_payload;
-    event_payload.push_back(event_data.presetID);
-    event_payload.push_back(static_cast<uint8_t>(event_data.saveResult));
+    memory_save_notifier_->Publish(event_data.presetID, Serializer::Serialize(event_data));
 
-    auto payload = vsomeip::runtime::get()->create_payload();
-    payload->set_data(event_payload.data(), static_cast<uint32_t>(event_payload.size()));
+    std::cout << "[SeatService] Sent memory save confirm event to clients" << std::endl;
+}
 
-    app_->notify(SERVICE_ID, INSTANCE_ID, MEMORY_SAVE_CONFIRM_EVENT, payload);
+void SeatService::SendRecallCompleteEvent(const application::OnSeatRecallCompleteData& event_data) {
+    if (!recall_complete_notifier_) return;
 
-    std::cout << "[SeatService] Sent memory save confirm event to clients" << std::endl;
+    recall_complete_notifier_->Publish(static_cast<uint32_t>(event_data.seatID), Serializer::Serialize(event_data));
+
+    std::cout << "[SeatService] Sent recall complete event: Seat " << static_cast<int>(event_data.seatID)
+              << " Preset " << static_cast<int>(event_data.presetID)
+              << (event_data.result == application::Result::SUCCESS ? " reached" : " interrupted") << std::endl;
 }
 
 application::Result SeatService::SimulateAdjustOperation(application::Position seat_id,
                                                         application::SeatAxis axis,
                                                         application::SeatDirection direction) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    clock_->SleepFor(std::chrono::milliseconds(100));
 
-    int seat_index = static_cast<int>(seat_id);
-    if (seat_index < 0 || seat_index >= 4) {
+    const size_t seat_index = static_cast<size_t>(seat_id);
+    if (seat_index >= VehicleState::SEAT_COUNT) {
         return application::Result::FAIL;
     }
 
     // 模拟95%成功率
-    static std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
+    thread_local std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
     if ((gen() % 100) < 95) {
         return application::Result::SUCCESS;
     } else {
@@ -338,34 +438,5 @@ application::Result SeatService::SimulateAdjustOperation(application::Position s
     }
 }
 
-application::Result SeatService::SimulateRecallMemoryOperation(application::Position seat_id,
-                                                             uint8_t memory_id) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(200));
-
-    int seat_index = static_cast<int>(seat_id);
-    if (seat_index < 0 || seat_index >= 4 || memory_id < 1 || memory_id > 3) {
-        return application::Result::FAIL;
-    }
-
-    // 模拟95%成功率
-    static std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
-    return ((gen() % 100) < 95) ? application::Result::SUCCESS : application::Result::FAIL;
-}
-
-application::Result SeatService::SimulateSaveMemoryOperation(application::Position seat_id,
-                                                           uint8_t memory_id) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
-    int seat_index = static_cast<int>(seat_id);
-    if (seat_index < 0 || seat_index >= 4 || memory_id < 1 || memory_id > 3) {
-        return application::Result::FAIL;
-    }
-
-    // 保存当前位置到记忆位置
-    memory_positions_[seat_index][memory_id - 1] = current_positions_[seat_index];
-
-    return application::Result::SUCCESS;
-}
-
 } // namespace services
 } // namespace body_controller
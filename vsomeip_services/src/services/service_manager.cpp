@@ -3,6 +3,7 @@
 #include <signal.h>
 #include <thread>
 #include <chrono>
+#include <cstdlib>
 
 namespace body_controller {
 namespace services {
@@ -18,8 +19,9 @@ void signal_handler(int signal) {
     }
 }
 
-ServiceManager::ServiceManager()
-    : running_(false)
+ServiceManager::ServiceManager(const ServiceManagerOptions& options)
+    : options_(options)
+    , running_(false)
     , vsomeip_ready_(false)
 {
     std::cout << "[ServiceManager] Service manager created" << std::endl;
@@ -48,8 +50,11 @@ bool ServiceManager::Initialize() {
             return false;
         }
         
-        // 创建硬件模拟器
-        hardware_simulator_ = std::make_shared<HardwareSimulator>();
+        // 创建整车执行器状态和硬件模拟器（服务与模拟器共享同一份状态和时钟）
+        clock_ = std::make_shared<SimClock>(options_.virtual_time ? SimClock::Mode::VIRTUAL
+                                                                  : SimClock::Mode::REAL_TIME);
+        vehicle_state_ = std::make_shared<VehicleState>();
+        hardware_simulator_ = std::make_shared<HardwareSimulator>(vehicle_state_, clock_);
         
         // 初始化所有服务
         if (!InitializeServices()) {
@@ -164,6 +169,9 @@ void ServiceManager::Stop() {
         seat_service_->Stop();
     }
     
+    // 处理完已投递的请求后停止执行器
+    StopExecutors();
+    
     // 停止VSOMEIP应用程序
     if (app_) {
         app_->stop();
@@ -246,10 +254,34 @@ bool ServiceManager::InitializeVSomeIPApplication() {
 bool ServiceManager::InitializeServices() {
     try {
         // 创建所有服务实例
-        door_service_ = std::make_unique<DoorService>(app_, hardware_simulator_);
-        window_service_ = std::make_unique<WindowService>(app_, hardware_simulator_);
-        light_service_ = std::make_unique<LightService>(app_, hardware_simulator_);
-        seat_service_ = std::make_unique<SeatService>(app_, hardware_simulator_);
+        door_service_ = std::make_unique<DoorService>(app_, hardware_simulator_, vehicle_state_, clock_);
+        window_service_ = std::make_unique<WindowService>(app_, hardware_simulator_, vehicle_state_, clock_);
+        light_service_ = std::make_unique<LightService>(app_, hardware_simulator_, vehicle_state_, clock_);
+        seat_service_ = std::make_unique<SeatService>(app_, hardware_simulator_, vehicle_state_, clock_);
+        
+        // 每个服务使用独立的执行器，互不阻塞
+        door_service_->SetExecutor(CreateExecutor("door"));
+        window_service_->SetExecutor(CreateExecutor("window"));
+        light_service_->SetExecutor(CreateExecutor("light"));
+        seat_service_->SetExecutor(CreateExecutor("seat"));
+        
+        // 事件通知方式（字段、周期、仅变化时发送）与vsomeip共用同一份配置文件
+        auto event_config = std::make_shared<EventNotificationTable>();
+        const char* config_file = std::getenv("VSOMEIP_CONFIGURATION");
+        if (config_file) {
+            event_config->LoadFromFile(config_file);
+        } else {
+            std::cout << "[ServiceManager] VSOMEIP_CONFIGURATION not set, offering plain events" << std::endl;
+        }
+        door_service_->SetEventConfig(event_config);
+        window_service_->SetEventConfig(event_config);
+        light_service_->SetEventConfig(event_config);
+        seat_service_->SetEventConfig(event_config);
+        
+        // 座椅记忆位置映射到文件，服务重启后仍然有效
+        auto memory_store = std::make_shared<SeatMemoryStore>();
+        memory_store->Open(options_.seat_memory_file);
+        seat_service_->SetMemoryStore(memory_store);
         
         // 初始化所有服务
         bool all_initialized = true;
@@ -291,6 +323,10 @@ bool ServiceManager::InitializeServices() {
 void ServiceManager::StartHardwareSimulator() {
     if (hardware_simulator_) {
         hardware_simulator_->SetEventInterval(15); // 15秒触发一次事件
+        hardware_simulator_->SetSimulationProfile(options_.simulation);
+        if (!options_.scenario_file.empty() && !hardware_simulator_->LoadScenario(options_.scenario_file)) {
+            std::cerr << "[ServiceManager] Scenario not loaded, falling back to random events" << std::endl;
+        }
         hardware_simulator_->SetAutoEventEnabled(true);
         hardware_simulator_->Start();
         
@@ -305,5 +341,28 @@ void ServiceManager::StopHardwareSimulator() {
     }
 }
 
+std::shared_ptr<ServiceExecutor> ServiceManager::CreateExecutor(const std::string& name) {
+    if (options_.executor_threads == 0) {
+        return nullptr;
+    }
+    
+    auto executor = std::make_shared<ServiceExecutor>(name, options_.executor_threads,
+                                                      options_.executor_queue_capacity);
+    executor->Start();
+    executors_.push_back(executor);
+    return executor;
+}
+
+void ServiceManager::StopExecutors() {
+    for (auto& executor : executors_) {
+        executor->Stop();
+        
+        ServiceExecutor::Stats stats = executor->GetStats();
+        std::cout << "[ServiceManager] Executor " << executor->GetName()
+                  << ": executed=" << stats.executed << " rejected=" << stats.rejected << std::endl;
+    }
+    executors_.clear();
+}
+
 } // namespace services
 } // namespace body_controller
@@ -9,16 +9,15 @@ namespace body_controller {
 namespace services {
 
 WindowService::WindowService(std::shared_ptr<vsomeip::application> app, 
-                            std::shared_ptr<HardwareSimulator> simulator)
+                            std::shared_ptr<HardwareSimulator> simulator,
+                             std::shared_ptr<VehicleState> state,
+                             std::shared_ptr<SimClock> clock)
     : app_(app)
     , running_(false)
     , hardware_simulator_(simulator)
+    , state_(state ? std::move(state) : std::make_shared<VehicleState>())
+    , clock_(clock ? std::move(clock) : std::make_shared<SimClock>())
 {
-    // 初始化当前位置（默认50%）
-    for (int i = 0; i < 4; ++i) {
-        current_positions_[i] = 50;
-    }
-    
     std::cout << "[WindowService] Window service created" << std::endl;
 }
 
@@ -40,27 +39,34 @@ bool WindowService::Initialize() {
         // 注册方法处理器
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, SET_WINDOW_POSITION_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleSetWindowPositionRequest(request);
+                DispatchRequest(request, &WindowService::HandleSetWindowPositionRequest);
             });
             
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, CONTROL_WINDOW_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleControlWindowRequest(request);
+                DispatchRequest(request, &WindowService::HandleControlWindowRequest);
             });
             
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, GET_WINDOW_POSITION_METHOD,
             [this](const std::shared_ptr<vsomeip::message>& request) {
-                HandleGetWindowPositionRequest(request);
+                DispatchRequest(request, &WindowService::HandleGetWindowPositionRequest);
             });
         
         // 注册事件
         std::set<vsomeip::eventgroup_t> event_groups;
         event_groups.insert(EVENT_GROUP);
         
-        app_->offer_event(SERVICE_ID, INSTANCE_ID, WINDOW_POSITION_CHANGED_EVENT, 
-                         event_groups, vsomeip::event_type_e::ET_EVENT, 
-                         std::chrono::milliseconds::zero(),
-                         false, true, nullptr, vsomeip::reliability_type_e::RT_RELIABLE);
+        position_notifier_ = OfferEvent(WINDOW_POSITION_CHANGED_EVENT, event_groups);
+        
+        // 发布字段初始值，新订阅者补发所有条目的当前值
+        PublishInitialValues();
+        app_->register_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP,
+            [this](vsomeip::client_t client, uid_t, gid_t, bool subscribed) {
+                if (subscribed) {
+                    position_notifier_->ScheduleReplay(client);
+                }
+                return true;
+            });
         
         // 设置硬件模拟器回调
         if (hardware_simulator_) {
@@ -89,6 +95,10 @@ bool WindowService::Start() {
     }
     
     running_ = true;
+    
+    // 启动字段周期重发
+    if (position_notifier_) position_notifier_->Start();
+    
     std::cout << "[WindowService] Window service started" << std::endl;
     return true;
 }
@@ -100,9 +110,12 @@ void WindowService::Stop() {
     
     running_ = false;
     
+    if (position_notifier_) position_notifier_->Stop();
+    
     if (app_) {
         // 停止提供服务
         app_->stop_offer_service(SERVICE_ID, INSTANCE_ID, MAJOR_VERSION, MINOR_VERSION);
+        app_->unregister_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENT_GROUP);
         
         // 取消注册处理器
         app_->unregister_message_handler(SERVICE_ID, INSTANCE_ID, SET_WINDOW_POSITION_METHOD);
@@ -144,8 +157,9 @@ void WindowService::HandleSetWindowPositionRequest(const std::shared_ptr<vsomeip
         if (result == application::Result::SUCCESS && hardware_simulator_) {
             // 延迟触发事件，模拟硬件响应时间
             std::thread([this, req]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(200)); // 车窗移动需要时间
+                clock_->SleepFor(std::chrono::milliseconds(200)); // 车窗移动需要时间
                 hardware_simulator_->TriggerWindowPositionEvent(req.windowID, req.position);
+                clock_->Done();
             }).detach();
         }
         
@@ -203,8 +217,9 @@ void WindowService::HandleControlWindowRequest(const std::shared_ptr<vsomeip::me
             
             // 延迟触发事件
             std::thread([this, req, new_position]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(300));
+                clock_->SleepFor(std::chrono::milliseconds(300));
                 hardware_simulator_->TriggerWindowPositionEvent(req.windowID, new_position);
+                clock_->Done();
             }).detach();
         }
         
@@ -252,6 +267,41 @@ void WindowService::HandleGetWindowPositionRequest(const std::shared_ptr<vsomeip
     }
 }
 
+std::unique_ptr<FieldNotifier> WindowService::OfferEvent(vsomeip::event_t event_id,
+                                                         const std::set<vsomeip::eventgroup_t>& event_groups) {
+    EventNotificationConfig config = event_config_ ? event_config_->Get(SERVICE_ID, event_id) : EventNotificationConfig{};
+    auto notifier = std::make_unique<FieldNotifier>(app_, SERVICE_ID, INSTANCE_ID, event_id, config, clock_);
+    notifier->Offer(event_groups);
+    return notifier;
+}
+
+void WindowService::PublishInitialValues() {
+    for (size_t i = 0; i < VehicleState::WINDOW_COUNT; ++i) {
+        application::OnWindowPositionChangedData event_data;
+        event_data.windowID = static_cast<application::Position>(i);
+        event_data.newPosition = state_->GetWindowPosition(event_data.windowID);
+        position_notifier_->Publish(static_cast<uint32_t>(i), Serializer::Serialize(event_data));
+    }
+}
+
+void WindowService::DispatchRequest(const std::shared_ptr<vsomeip::message>& request,
+                                    void (WindowService::*handler)(const std::shared_ptr<vsomeip::message>&)) {
+    // 处理中可能在时钟上睡眠，处理完不再阻止虚拟时间前进
+    if (!executor_) {
+        (this->*handler)(request);
+        clock_->Done();
+        return;
+    }
+    
+    if (!executor_->Post([this, request, handler]() {
+            (this->*handler)(request);
+            clock_->Done();
+        })) {
+        std::cerr << "[WindowService] Executor queue full, rejecting request" << std::endl;
+        SendBusyResponse(app_, request);
+    }
+}
+
 void WindowService::SendResponse(const std::shared_ptr<vsomeip::message>& request,
                                 const std::vector<uint8_t>& payload) {
     if (!app_) return;
@@ -280,29 +330,24 @@ void WindowService::OnWindowPositionChanged(const application::OnWindowPositionC
               << static_cast<int>(event_data.windowID) << " -> " 
               << static_cast<int>(event_data.newPosition) << "%" << std::endl;
     
-    // 更新内部状态
-    current_positions_[static_cast<int>(event_data.windowID)] = event_data.newPosition;
-    
     // 发送事件到客户端
     SendWindowPositionChangedEvent(event_data);
 }
 
 void WindowService::SendWindowPositionChangedEvent(const application::OnWindowPositionChangedData& event_data) {
-    if (!app_) return;
+    if (!position_notifier_) return;
     
-    auto event_payload = Serializer::Serialize(event_data);
-    auto payload = vsomeip::runtime::get()->create_payload();
-    payload->set_data(event_payload.data(), static_cast<uint32_t>(event_payload.size()));
-    
-    app_->notify(SERVICE_ID, INSTANCE_ID, WINDOW_POSITION_CHANGED_EVENT, payload);
-    
-    std::cout << "[WindowService] Sent window position changed event to clients" << std::endl;
+    if (position_notifier_->Publish(static_cast<uint32_t>(event_data.windowID), Serializer::Serialize(event_data))) {
+        std::cout << "[WindowService] Sent window position changed event to clients" << std::endl;
+    } else {
+        std::cout << "[WindowService] Window position changed event unchanged, notification suppressed" << std::endl;
+    }
 }
 
 application::Result WindowService::SimulateSetPositionOperation(application::Position window_id, 
                                                               uint8_t target_position) {
     // 模拟操作延迟
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    clock_->SleepFor(std::chrono::milliseconds(50));
     
     int window_index = static_cast<int>(window_id);
     if (window_index < 0 || window_index >= 4 || target_position > 100) {
@@ -310,7 +355,7 @@ application::Result WindowService::SimulateSetPositionOperation(application::Pos
     }
     
     // 模拟95%成功率
-    static std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
+    thread_local std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
     if ((gen() % 100) < 95) {
         return application::Result::SUCCESS;
     } else {
@@ -322,7 +367,7 @@ application::Result WindowService::SimulateSetPositionOperation(application::Pos
 application::Result WindowService::SimulateControlOperation(application::Position window_id, 
                                                           application::WindowCommand command) {
     // 模拟操作延迟
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    clock_->SleepFor(std::chrono::milliseconds(50));
     
     int window_index = static_cast<int>(window_id);
     if (window_index < 0 || window_index >= 4) {
@@ -330,7 +375,7 @@ application::Result WindowService::SimulateControlOperation(application::Positio
     }
     
     // 模拟95%成功率
-    static std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
+    thread_local std::mt19937 gen(std::chrono::steady_clock::now().time_since_epoch().count());
     if ((gen() % 100) < 95) {
         return application::Result::SUCCESS;
     } else {
@@ -340,11 +385,7 @@ application::Result WindowService::SimulateControlOperation(application::Positio
 }
 
 uint8_t WindowService::GetCurrentPosition(application::Position window_id) const {
-    int window_index = static_cast<int>(window_id);
-    if (window_index >= 0 && window_index < 4) {
-        return current_positions_[window_index];
-    }
-    return 50; // 默认位置
+    return state_->GetWindowPosition(window_id);
 }
 
 } // namespace services